@@ -6,6 +6,7 @@
 #include <stdlib.h>
 #include <unistd.h>
 #include <time.h>
+#include <stdint.h>
 #include <string>
 #include <string.h>
 #include <boost/shared_array.hpp>
@@ -80,6 +81,55 @@ public:
         return (ts.tv_sec * 1000 + ts.tv_nsec / 1000000);
 #endif
     }
+    // 获取单调递增的时间,精度us,用于事件循环中的短时定时任务
+    static int64_t GetTickCountUs()
+    {
+#if defined (__APPLE__) || defined (__MACH__)
+        static mach_timebase_info_data_t sTimebaseInfo;
+        if(sTimebaseInfo.denom == 0)
+        {
+            mach_timebase_info(&sTimebaseInfo);
+        }
+        if(sTimebaseInfo.denom == 0)
+        {
+            return 0;
+        }
+        return mach_absolute_time() / 1000 / sTimebaseInfo.denom * sTimebaseInfo.numer;
+#else
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return ((int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000);
+#endif
+    }
+    // 粗粒度的单调时钟,精度ms,开销比GetTickCount小,用于事件循环中缓存当前时间
+    static time_t GetCoarseTickCount()
+    {
+#if defined(CLOCK_MONOTONIC_COARSE)
+        struct timespec ts;
+        if( -1 == clock_gettime(CLOCK_MONOTONIC_COARSE, &ts) )
+        {
+            return GetTickCount();
+        }
+        return (ts.tv_sec * 1000 + ts.tv_nsec / 1000000);
+#else
+        return GetTickCount();
+#endif
+    }
+    // murmur3 的 64 位混合函数, 连续的整数(fd)或者对齐的整数(指针)混合后也是均匀分布的
+    static uint64_t MixHash64(uint64_t key)
+    {
+        key ^= key >> 33;
+        key *= 0xff51afd7ed558ccdULL;
+        key ^= key >> 33;
+        key *= 0xc4ceb9fe1a85ec53ULL;
+        key ^= key >> 33;
+        return key;
+    }
+    // 按 key 在 shard_num 个分片中选择一个, shard_num 必须大于 0
+    static size_t HashShard(uint64_t key, size_t shard_num)
+    {
+        return (size_t)(MixHash64(key) % shard_num);
+    }
     // 获取执行文件所在路径
     static std::string GetModulePath()
     {
@@ -2,32 +2,32 @@
 #include "SockEvent.hpp"
 #include "SimpleLogger.h"
 
-#include <map>
+#include <errno.h>
+#include <string.h>
 
 #define EPOLL_QUEUE_LEN 32
+#define EPOLL_MAX_QUEUE_LEN 4096
 
 namespace core { namespace net { 
 
 static LoggerCategory g_log("EpollWaiter");
 
 EpollWaiter::EpollWaiter()
-    :m_epfd(-1)
+    :m_epfd(-1),
+    m_prealloc_events(EPOLL_QUEUE_LEN)
 {
-    m_epfd = epoll_create(EPOLL_QUEUE_LEN);
+    m_epfd = epoll_create1(EPOLL_CLOEXEC);
     if(m_epfd < 0)
     {
         g_log.Log(lv_error, "epoll create fd failed.");
     }
-    m_prealloc_events = (struct epoll_event*)calloc(EPOLL_QUEUE_LEN, sizeof(struct epoll_event));
-    if(m_prealloc_events == NULL)
-    {
-        g_log.Log(lv_error, "calloc returned null.");
-    }
     struct epoll_event ev;
+    memset(&ev, 0, sizeof(ev));
     if(m_notify_pipe[0] >= 0)
     {
         ev.events = EPOLLIN | EPOLLERR | EPOLLPRI | EPOLLET;
-        ev.data.fd = m_notify_pipe[0];
+        // the notify pipe is the only registered fd without a tcp.
+        ev.data.ptr = NULL;
         epoll_ctl(m_epfd, EPOLL_CTL_ADD, m_notify_pipe[0], &ev);
     }
 }
@@ -42,17 +42,15 @@ void EpollWaiter::DestroyWaiter()
     if(m_notify_pipe[0] != -1 && m_epfd >=0 )
     {
         struct epoll_event ev;
-        ev.events = EPOLLIN | EPOLLERR | EPOLLPRI | EPOLLET;
-        ev.data.fd = m_notify_pipe[0];
+        memset(&ev, 0, sizeof(ev));
         epoll_ctl(m_epfd, EPOLL_CTL_DEL, m_notify_pipe[0], &ev);
     }
     if(m_epfd >= 0)
-        close(m_epfd);
-    if(m_prealloc_events)
     {
-        free(m_prealloc_events);
-        m_prealloc_events = NULL;
+        close(m_epfd);
+        m_epfd = -1;
     }
+    std::vector<struct epoll_event>().swap(m_prealloc_events);
     SockWaiterBase::DestroyWaiter();
 }
 // note: can not be locked by caller.
@@ -68,11 +66,19 @@ bool EpollWaiter::UpdateTcpSockEvent(TcpSockSmartPtr sp_tcp)
     }
     SockEvent so_ev = sp_tcp->GetCaredSockEvent();
     struct epoll_event ev;
-    ev.events = EPOLLIN | EPOLLERR | EPOLLPRI | EPOLLET | EPOLLOUT;
-    ev.data.fd = fd;
-    epoll_ctl(m_epfd, EPOLL_CTL_DEL, fd, &ev);
+    memset(&ev, 0, sizeof(ev));
+    // the waiting container keep the tcp alive while it is registered in epoll, 
+    // so we can dispatch the ready event to the tcp directly without any lookup.
+    ev.data.ptr = sp_tcp.get();
 
-    ev.events = 0;
+    if(!so_ev.hasAny())
+    {
+        if(::epoll_ctl(m_epfd, EPOLL_CTL_DEL, fd, &ev) < 0 && errno != ENOENT)
+        {
+            g_log.Log(lv_error, "del epoll fd failed,fd:%d", fd);
+        }
+        return true;
+    }
 
     if(so_ev.hasRead())
     {
@@ -86,53 +92,65 @@ bool EpollWaiter::UpdateTcpSockEvent(TcpSockSmartPtr sp_tcp)
     {
         ev.events |= EPOLLERR | EPOLLET;
     }
-    if(so_ev.hasAny())
+
+    // a tcp in the waiting container has been added to epoll already, only the 
+    // cared event need to be modified.
+    TcpSockContainerT::const_iterator waitingit = m_waiting_tcpsocks.find((long)fd);
+    bool registered = (waitingit != m_waiting_tcpsocks.end()) && (waitingit->second == sp_tcp);
+    int op = registered ? EPOLL_CTL_MOD : EPOLL_CTL_ADD;
+    int ret = ::epoll_ctl(m_epfd, op, fd, &ev);
+    if(ret < 0)
     {
-        if(::epoll_ctl(m_epfd, EPOLL_CTL_ADD, fd, &ev) < 0)
-        {
-            g_log.Log(lv_error, "add epoll fd failed,fd:%d", fd);
-        }
+        // the fd may be reused by a new tcp before the closed one removed from the waiting container,
+        // or removed from epoll while still in the container, so try the other way.
+        if(op == EPOLL_CTL_MOD && errno == ENOENT)
+            ret = ::epoll_ctl(m_epfd, EPOLL_CTL_ADD, fd, &ev);
+        else if(op == EPOLL_CTL_ADD && errno == EEXIST)
+            ret = ::epoll_ctl(m_epfd, EPOLL_CTL_MOD, fd, &ev);
+    }
+    if(ret < 0)
+    {
+        g_log.Log(lv_error, "update epoll fd failed,fd:%d, errno:%d", fd, errno);
+        return false;
     }
     return true;
 }
 
 
-int EpollWaiter::Wait(TcpSockContainerT& allready, struct timeval& tv)
+int EpollWaiter::Wait(TcpSockReadyListT& allready, int timeout_ms)
 {
     if(m_epfd < 0)
         return -1;
     allready.clear();
 
-    struct epoll_event *events = m_prealloc_events;
-    memset(events, 0, EPOLL_QUEUE_LEN*sizeof(struct epoll_event));
+    struct epoll_event *events = &m_prealloc_events[0];
+    int maxevents = (int)m_prealloc_events.size();
     // the document said: the fd will be removed automatically when the fd is closed.
-    int ms = tv.tv_usec/1000 + tv.tv_sec*1000;
-    int retfds = ::epoll_wait(m_epfd, events, EPOLL_QUEUE_LEN, ms);
-    // clear immediately after select waking up to speed up eventloop.
-    int notifytype = GetAndClearNotify();
-    if(notifytype & REMOVED)
-    {
-        ClearClosedTcpSock();
-    }
+    int retfds = ::epoll_wait(m_epfd, events, maxevents, timeout_ms);
     if(retfds < 0)
     {
+        m_timing_wheel.UpdateNow();
+        GetAndClearNotify();
         //g_log.Log(lv_debug, "error happened while epoll wait");
         return retfds;
     }
-    TcpSockContainerT::iterator tcp_it = m_waiting_tcpsocks.begin();
-    // first update timeout for all waiting tcp.
-    while(tcp_it != m_waiting_tcpsocks.end())
-    {
-        (*tcp_it).second->UpdateTimeout();
-        ++tcp_it;
-    }
+    // read the clock only once for each wakeup, the ready tcps renew the timeout by it.
+    m_timing_wheel.UpdateNow();
+    bool notified = false;
     for(int i = 0; i < retfds; i++)
     {
         const struct epoll_event& ev = events[i];
-        if(ev.data.fd == m_notify_pipe[0])
+        if(ev.data.ptr == NULL)
+        {
+            notified = true;
+            continue;
+        }
+        TcpSock* ptcp = (TcpSock*)ev.data.ptr;
+        // closed tcp has been removed from epoll, but the event may be 
+        // already returned in the same batch.
+        if(ptcp->IsClosed())
             continue;
-        TcpSockSmartPtr sptcp = m_waiting_tcpsocks[ev.data.fd];
-        assert(sptcp);
+        TcpSockSmartPtr sptcp = ptcp->shared_from_this();
         sptcp->ClearEvent();
         bool isready = false;
         if( (ev.events & EPOLLIN) ||
@@ -157,12 +175,25 @@ int EpollWaiter::Wait(TcpSockContainerT& allready, struct timeval& tv)
         if(isready)
         {
             sptcp->RenewTimeout();
-            allready[(long)sptcp->GetFD()] = sptcp;
+            allready.push_back(sptcp);
             //g_log.Log(lv_debug, "fd:%d has been added to ready socket, total ready:%zu", sptcp->GetFD(), allready.size());
         }
     }
+    // only the tcps in the expired slots will be checked.
+    m_timing_wheel.Expire();
+    // the ready list hold the ready tcps now, so it is safe to clear the closed tcps.
+    int notifytype = GetAndClearNotify(notified);
+    if(notifytype & REMOVED)
+    {
+        ClearClosedTcpSock();
+    }
+    // the batch is saturated, more events may be pending, so enlarge it for next wait.
+    if(retfds == maxevents && maxevents < EPOLL_MAX_QUEUE_LEN)
+    {
+        m_prealloc_events.resize(maxevents*2);
+        g_log.Log(lv_debug, "epoll event batch grown to %d.", maxevents*2);
+    }
     return retfds;
 }
 
 } }
-
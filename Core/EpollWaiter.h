@@ -3,6 +3,7 @@
 
 #include "SockWaiterBase.h"
 #include <sys/epoll.h>
+#include <vector>
 
 namespace core { namespace net {
 
@@ -12,13 +13,15 @@ public:
     EpollWaiter();
     ~EpollWaiter();
     // must run in the event loop thread.
-    int  Wait(TcpSockContainerT& allready, struct timeval& tv);
+    int  Wait(TcpSockReadyListT& allready, int timeout_ms);
     void DestroyWaiter();
 protected:
     bool UpdateTcpSockEvent(TcpSockSmartPtr sp_tcp);
 private:
     int m_epfd;
-    struct epoll_event*  m_prealloc_events;
+    // the event batch for epoll_wait, doubled each time it is filled up
+    // by a single wait until EPOLL_MAX_QUEUE_LEN.
+    std::vector<struct epoll_event>  m_prealloc_events;
 };
 } }
 
@@ -1,15 +1,18 @@
 #include "EventLoop.h"
 #include "SockWaiterBase.h"
 #include "SimpleLogger.h"
-#include "threadpool.h"
+#include "CommonUtility.hpp"
 
 #include <errno.h>
 #include <stdio.h>
 #include <stdint.h>
+#include <sched.h>
+#include <sys/socket.h>
 #include <boost/bind.hpp>
-#include <boost/lexical_cast.hpp>
 
 #define TIMEOUT_SHORT 2
+// the interval in ms to update the io rate of the loop.
+#define IO_RATE_INTERVAL 1000
 
 using namespace boost;
 namespace core { namespace net { 
@@ -17,6 +20,13 @@ namespace core { namespace net {
 static LoggerCategory g_log("EventLoop");
 
 EventLoop::EventLoop()
+    :m_cpu(-1),
+    m_spin_us(0),
+    m_sock_busy_poll_us(0),
+    m_io_bytes(0),
+    m_last_io_bytes(0),
+    m_last_rate_tick(0),
+    m_io_bytes_persec(0)
 {
     m_event_waiter.reset();
     m_terminal = false;
@@ -43,20 +53,12 @@ bool EventLoop::IsInLoopThread()
     return pthread_equal(m_cur_looptid, pthread_self()) != 0;
 }
 
-bool EventLoop::IsInWriteLoopThread()
-{
-    return pthread_equal(m_write_thread_pid, pthread_self()) != 0;
-}
-
-void EventLoop::WriteLoopStartedNotify()
-{
-    g_log.Log(lv_debug, "write loop started!");
-}
-
 bool EventLoop::AddTcpSockToLoop(TcpSockSmartPtr sp_tcp)
 {
     if(m_terminal || m_event_waiter==NULL)
         return false;
+    if(m_sock_busy_poll_us > 0)
+        SetSockBusyPoll(sp_tcp);
     m_event_waiter->AddTcpSock(sp_tcp);
     return true;
 }
@@ -83,20 +85,159 @@ void EventLoop::RemoveTcpSock(TcpSockSmartPtr sp_tcp)
     m_event_waiter->RemoveTcpSock(sp_tcp);
 }
 
+int64_t EventLoop::GetCachedTickCount() const
+{
+    if(m_event_waiter==NULL)
+        return ::core::utility::GetTickCount();
+    return m_event_waiter->GetCachedTickCount();
+}
+
+void EventLoop::ScheduleTimeout(TcpSockSmartPtr sp_tcp)
+{
+    assert(IsInLoopThread());
+    if(m_event_waiter==NULL)
+        return;
+    m_event_waiter->ScheduleTimeout(sp_tcp);
+}
+
+void EventLoop::UpdateIORate()
+{
+    int64_t now = GetCachedTickCount();
+    int64_t elapsed = now - m_last_rate_tick;
+    if(elapsed < IO_RATE_INTERVAL)
+        return;
+    m_io_bytes_persec = (m_io_bytes - m_last_io_bytes)*1000/elapsed;
+    m_last_io_bytes = m_io_bytes;
+    m_last_rate_tick = now;
+}
+
+int64_t EventLoop::GetIOBytesPerSec() const
+{
+    // the rate is only updated while the loop is waked up, an idle loop may keep the old rate.
+    if(::core::utility::GetCoarseTickCount() - m_last_rate_tick > 2*IO_RATE_INTERVAL)
+        return 0;
+    return m_io_bytes_persec;
+}
+
 bool EventLoop::QueueTaskToLoop(EvTask task)
 {
     {
         common::locker_guard guard(m_lock);
         m_pendings.push_back(task);
     }
+    // only the first task since last wakeup will really write to the notify fd.
     if(m_event_waiter)
         m_event_waiter->NotifyNewActive(UPDATEEVENT);
     return true;
 }
 
-bool EventLoop::QueueTaskToWriteLoop(EvTask task)
+void EventLoop::RunTaskAfter(int delay_us, EvTask task)
+{
+    assert(IsInLoopThread());
+    if(delay_us < 0)
+        delay_us = 0;
+    m_timer_tasks.insert(std::make_pair(::core::utility::GetTickCountUs() + delay_us, task));
+}
+
+void EventLoop::SetBusyPoll(int spin_us, int sock_busy_poll_us)
+{
+    m_spin_us = spin_us > 0 ? spin_us : 0;
+    m_sock_busy_poll_us = sock_busy_poll_us > 0 ? sock_busy_poll_us : 0;
+}
+
+void EventLoop::SetSockBusyPoll(TcpSockSmartPtr sp_tcp)
+{
+#if defined(SO_BUSY_POLL)
+    int busy_poll = m_sock_busy_poll_us;
+    if(sp_tcp->GetFD() >= 0 &&
+        0 != setsockopt(sp_tcp->GetFD(), SOL_SOCKET, SO_BUSY_POLL, &busy_poll, sizeof(busy_poll)))
+    {
+        // raising the value above the sysctl net.core.busy_read needs CAP_NET_ADMIN.
+        g_log.Log(lv_warn, "set SO_BUSY_POLL failed, fd:%d, errno:%d.", sp_tcp->GetFD(), errno);
+    }
+#endif
+}
+
+int EventLoop::GetWaitTimeout() const
+{
+    // new tcp, tasks and terminate will wake up the waiter by notify, so we only 
+    // need to wake up for the next tcp timeout or timer task.
+    int timeout_ms = m_event_waiter->GetNextTimeout();
+    int timer_timeout = GetNextTimerTaskTimeout();
+    if(timer_timeout >= 0 && (timeout_ms < 0 || timer_timeout < timeout_ms))
+        timeout_ms = timer_timeout;
+    return timeout_ms;
+}
+
+int EventLoop::WaitReady(TcpSockReadyListT& readytcps, int timeout_ms)
+{
+    if(timeout_ms == 1 && !m_timer_tasks.empty())
+    {
+        // the waiter sleeps in ms, the timer task due within 1ms (such as a sub-ms batch window)
+        // is waited by spinning on the nonblock wait, instead of sleeping the whole 1ms.
+        int64_t due = m_timer_tasks.begin()->first;
+        int64_t now = ::core::utility::GetTickCountUs();
+        if(due - now < 1000)
+        {
+            while(now < due && !m_terminal)
+            {
+                int retcode = m_event_waiter->Wait(readytcps, 0);
+                if(retcode != 0)
+                    return retcode;
+                now = ::core::utility::GetTickCountUs();
+            }
+            return 0;
+        }
+    }
+    int spin_us = m_spin_us;
+    if(spin_us <= 0 || timeout_ms == 0)
+        return m_event_waiter->Wait(readytcps, timeout_ms);
+    // the tasks queued by other threads will make the notify fd ready, so spinning on 
+    // the nonblock wait covers both the tcps and the task queue.
+    int64_t start = ::core::utility::GetTickCountUs();
+    int64_t spin_end = start + spin_us;
+    if(timeout_ms > 0 && start + (int64_t)timeout_ms*1000 < spin_end)
+        spin_end = start + (int64_t)timeout_ms*1000;
+    int64_t now = start;
+    while(now < spin_end && !m_terminal)
+    {
+        int retcode = m_event_waiter->Wait(readytcps, 0);
+        if(retcode != 0)
+            return retcode;
+        now = ::core::utility::GetTickCountUs();
+    }
+    if(timeout_ms > 0)
+    {
+        // park for the left time of the timeout.
+        timeout_ms -= (int)((now - start)/1000);
+        if(timeout_ms <= 0)
+            return 0;
+    }
+    return m_event_waiter->Wait(readytcps, timeout_ms);
+}
+
+int EventLoop::GetNextTimerTaskTimeout() const
+{
+    if(m_timer_tasks.empty())
+        return -1;
+    int64_t left_us = m_timer_tasks.begin()->first - ::core::utility::GetTickCountUs();
+    if(left_us <= 0)
+        return 0;
+    return (int)((left_us + 999)/1000);
+}
+
+void EventLoop::RunTimerTasks()
 {
-    return threadpool::queue_work_task_to_named_thread(task, m_write_thread_name);
+    if(m_timer_tasks.empty())
+        return;
+    int64_t now = ::core::utility::GetTickCountUs();
+    while(!m_timer_tasks.empty() && m_timer_tasks.begin()->first <= now)
+    {
+        // the task may add new timer task, so remove it before running.
+        EvTask task = m_timer_tasks.begin()->second;
+        m_timer_tasks.erase(m_timer_tasks.begin());
+        task();
+    }
 }
 
 void EventLoop::TerminateLoop()
@@ -140,12 +281,7 @@ bool EventLoop::StartLoop(pthread_t& tid)
         //printf("event loop :%lld started.\n", (uint64_t)tid);
         g_log.Log(lv_debug, "event loop : %lld started.", (uint64_t)tid);
         m_cur_looptid = tid;
-        m_write_thread_name = boost::lexical_cast<std::string>(m_cur_looptid);
-        threadpool::queue_work_task_to_named_thread(boost::bind(&EventLoop::WriteLoopStartedNotify), m_write_thread_name);
-        if(threadpool::get_named_thread(m_write_thread_name, m_write_thread_pid))
-        {
-            return true;
-        }
+        return true;
     }
     m_terminal = true;
     g_log.Log(lv_error, "start event loop thread failed.");
@@ -162,22 +298,33 @@ void* EventLoop::Loop(void* param)
         g_log.Log(lv_debug, "null el or waiter in loop thread");
         return 0;
     }
-    TcpSockContainerT readytcps;
+#if !defined (__APPLE__) && !defined (__MACH__) 
+    if(el->m_cpu >= 0)
+    {
+        cpu_set_t cpus;
+        CPU_ZERO(&cpus);
+        CPU_SET(el->m_cpu, &cpus);
+        if(0 != pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus))
+            g_log.Log(lv_warn, "bind event loop to cpu:%d failed.", el->m_cpu);
+    }
+#endif
+    TcpSockReadyListT readytcps;
+    std::vector<EventLoop::EvTask> tmptasks;
     el->m_islooprunning = true;
     while(true)
     {
-        struct timeval tv;
-        tv.tv_sec = 1; //TIMEOUT_SHORT;
-        tv.tv_usec = 200000;
+        int timeout_ms = el->GetWaitTimeout();
 
         if(el->m_terminal)
         {// 关闭本地还活动的连接的写端,然后等待对方的响应后再彻底关闭连接,当所有的活动连接数都关闭后,再退出该事件循环体
             if(el->m_event_waiter->Empty())
                 break;
             el->CloseAllClient();
+            if(timeout_ms < 0 || timeout_ms > TIMEOUT_SHORT*1000)
+                timeout_ms = TIMEOUT_SHORT*1000;
         }
-        // 这里的超时应该尽量短，因为第一个过来的新客户端的响应需要等到下次超时才能处理
-        int retcode = el->m_event_waiter->Wait(readytcps, tv);
+        int retcode = el->WaitReady(readytcps, timeout_ms);
+        el->UpdateIORate();
 
         if(retcode == -1)
         {
@@ -187,7 +334,6 @@ void* EventLoop::Loop(void* param)
             continue;
         }
 
-        std::vector<EventLoop::EvTask> tmptasks;
         {
             common::locker_guard guard(el->m_lock);
             tmptasks.swap( el->m_pendings );
@@ -197,7 +343,9 @@ void* EventLoop::Loop(void* param)
         {
             tmptasks[i]();
         }
-        std::vector<EventLoop::EvTask>().swap(tmptasks);
+        // keep the capacity, the two vectors will be swapped again next time.
+        tmptasks.clear();
+        el->RunTimerTasks();
 
 
         if(el->m_terminal)
@@ -216,16 +364,13 @@ void* EventLoop::Loop(void* param)
             continue;
         }
 
-        TcpSockContainerT::iterator ready_tcp_it = readytcps.begin();
-        for( ; ready_tcp_it != readytcps.end(); ++ready_tcp_it) 
+        for(size_t i = 0; i < readytcps.size(); ++i) 
         {
-            TcpSockSmartPtr sp_tcp = (*ready_tcp_it).second;
+            const TcpSockSmartPtr& sp_tcp = readytcps[i];
+            // both read and write are handled in the loop thread, the data sent by
+            // other threads is queued in the tcp and flushed by the loop.
             if(sp_tcp)
             {
-                if(sp_tcp->GetCurrentEvent().hasWrite())
-                {
-                    threadpool::queue_work_task_to_named_thread(boost::bind(&TcpSock::HandleEvent, sp_tcp), el->m_write_thread_name);
-                }
                 sp_tcp->HandleEvent();
             }
         }// end of while of readytcps process.
@@ -233,7 +378,7 @@ void* EventLoop::Loop(void* param)
 
     }// end of while(true)
     el->m_event_waiter->DestroyWaiter();
-    threadpool::terminate_named_thread(el->m_write_thread_name);
+    el->m_timer_tasks.clear();
     g_log.Log(lv_debug, "event loop:%ld exit loop.", (long)el->m_cur_looptid);
     el->m_islooprunning = false;
     return 0;
@@ -4,11 +4,13 @@
 #include "lock.hpp"
 #include "TcpSock.h"
 #include <pthread.h>
+#include <stdint.h>
 #include <boost/shared_ptr.hpp>
 #include <boost/noncopyable.hpp>
 #include <boost/enable_shared_from_this.hpp>
 #include <boost/function.hpp>
 #include <vector>
+#include <map>
 
 namespace core { namespace net {
 
@@ -27,13 +29,36 @@ public:
     boost::shared_ptr<SockWaiterBase> GetEventWaiter() { return m_event_waiter; }
     //bool IsTcpExist(TcpSockSmartPtr sp_tcp);
     bool QueueTaskToLoop(EvTask task);
-    bool QueueTaskToWriteLoop(EvTask task);
+    // run the task in the loop thread after delay_us, must be called in loop thread.
+    // the loop waits in ms, the last 1ms before the task is due is waited by spinning.
+    void RunTaskAfter(int delay_us, EvTask task);
     bool IsInLoopThread();
-    bool IsInWriteLoopThread();
     bool UpdateTcpSock(TcpSockSmartPtr sp_tcp);
     void RemoveTcpSock(TcpSockSmartPtr sp_tcp);
+    // the time updated once each loop iteration, must be called in loop thread.
+    int64_t GetCachedTickCount() const;
+    // put the tcp timeout into the timing wheel of this loop, must be called in loop thread.
+    void ScheduleTimeout(TcpSockSmartPtr sp_tcp);
+    // count the bytes read and written by the tcps in this loop, must be called in loop thread.
+    void AddIOBytes(size_t bytes) { m_io_bytes += bytes; }
+    // the io bytes of the last second, can be read by other threads to balance the tcps between loops.
+    int64_t GetIOBytesPerSec() const;
+    // bind the loop thread to the cpu, should be set before StartLoop, -1 for no binding.
+    void SetCpuAffinity(int cpu) { m_cpu = cpu; }
+    // busy poll mode for low latency, the loop spins on the nonblock wait for spin_us before 
+    // blocking in the wait, and the tcps added to this loop are set SO_BUSY_POLL with sock_busy_poll_us
+    // if it is greater than 0. set spin_us to 0 to disable spinning. can be set in any thread.
+    void SetBusyPoll(int spin_us, int sock_busy_poll_us = 0);
 private:
-    static void WriteLoopStartedNotify();
+    void UpdateIORate();
+    // the wait timeout for the next tcp timeout or timer task, -1 for waiting until any event.
+    int  GetWaitTimeout() const;
+    // spin on the nonblock wait if busy poll is enabled, then block in the wait for timeout_ms.
+    int  WaitReady(std::vector<TcpSockSmartPtr>& readytcps, int timeout_ms);
+    void SetSockBusyPoll(TcpSockSmartPtr sp_tcp);
+    // the wait timeout for the next timer task, -1 if no timer task.
+    int  GetNextTimerTaskTimeout() const;
+    void RunTimerTasks();
     void AddTcpSockToLoopInLoopThread(TcpSockSmartPtr sp_tcp);
     static void* Loop(void*);
     void CloseAllClient();
@@ -42,10 +67,17 @@ private:
     volatile bool         m_islooprunning;
     pthread_t             m_cur_looptid;
     std::vector<EvTask>   m_pendings;
+    // the timer tasks ordered by the expire time in us, only used in loop thread.
+    std::multimap<int64_t, EvTask> m_timer_tasks;
     common::locker        m_lock;
     const SockEvent       m_handle_type;
-    std::string           m_write_thread_name;
-    pthread_t             m_write_thread_pid;
+    int                   m_cpu;
+    volatile int          m_spin_us;
+    volatile int          m_sock_busy_poll_us;
+    int64_t               m_io_bytes;
+    int64_t               m_last_io_bytes;
+    volatile int64_t      m_last_rate_tick;
+    volatile int64_t      m_io_bytes_persec;
 };
 } }
 
@@ -4,13 +4,17 @@
 #include <boost/shared_ptr.hpp>
 #include <vector>
 #include <stdio.h>
+#include <unistd.h>
+#include <errno.h>
+#include <sys/socket.h>
 #if defined (__APPLE__) || defined (__MACH__) 
 #include "SelectWaiter.h"
 #else
 #include "EpollWaiter.h"
+#ifdef USE_IOURING_WAITER
+#include "IoUringWaiter.h"
+#endif
 #endif
-
-#define MAX_TCPNUM 10
 
 namespace core { namespace net {
 
@@ -23,12 +27,26 @@ typedef std::map<std::string, EventLoopWrapper > EventLoopContainerT;
 
 
 static EventLoopContainerT  m_eventloop_pool;
-static EventLoopContainerT  m_innerloop_pool;
 static core::common::locker m_pool_locker;
-static int s_max_tcp_num_inloop = MAX_TCPNUM;
+typedef std::vector<EventLoopWrapper> InnerLoopContainerT;
+// the inner loops are published as an immutable snapshot, so they can be read without lock
+// while the pool is being destroyed.
+static boost::shared_ptr<const InnerLoopContainerT> s_innerloops(new InnerLoopContainerT());
+static volatile int s_innerloops_started = 0;
+static int s_innerloop_num = 0;
+static bool s_cpu_affinity = false;
+static kInnerLoopPlacement s_placement = PlaceRoundRobin;
+static int s_spin_us = 0;
+static int s_sock_busy_poll_us = 0;
+static volatile unsigned long s_next_innerloop = 0;
 
 static LoggerCategory g_log("EventLoopPool");
 
+static boost::shared_ptr<const InnerLoopContainerT> GetInnerLoops()
+{
+    return boost::atomic_load(&s_innerloops);
+}
+
 //static void new_tcp_sighandler(int sig)
 //{
 //    g_log.Log(lv_debug, "new tcp sig handler:%d", sig);
@@ -38,13 +56,51 @@ EventLoopPool::EventLoopPool()
 {
 }
 
-bool EventLoopPool::InitEventLoopPool( int tcp_in_each_innerloop)
+// choose the best waiter the system supported.
+static boost::shared_ptr< SockWaiterBase > NewSockWaiter()
+{
+#if defined (__APPLE__) || defined (__MACH__) 
+    return boost::shared_ptr< SockWaiterBase >(new SelectWaiter());
+#else
+#ifdef USE_IOURING_WAITER
+    if(IoUringWaiter::IsSupported())
+        return boost::shared_ptr< SockWaiterBase >(new IoUringWaiter());
+#endif
+    //return boost::shared_ptr< SockWaiterBase >(new SelectWaiter());
+    return boost::shared_ptr< SockWaiterBase >(new EpollWaiter());
+#endif
+}
+
+static int GetCpuNum()
 {
-    if(tcp_in_each_innerloop > 0)
-        s_max_tcp_num_inloop = tcp_in_each_innerloop;
+    long cpunum = sysconf(_SC_NPROCESSORS_ONLN);
+    return cpunum > 0 ? (int)cpunum : 1;
+}
+
+bool EventLoopPool::InitEventLoopPool(int innerloop_num, bool cpu_affinity, kInnerLoopPlacement placement)
+{
+    core::common::locker_guard guard(m_pool_locker);
+    if(s_innerloops_started)
+    {
+        g_log.Log(lv_warn, "inner loops already started, the new pool config is ignored.");
+        return false;
+    }
+    s_innerloop_num = innerloop_num > 0 ? innerloop_num : GetCpuNum();
+    s_cpu_affinity = cpu_affinity;
+    s_placement = placement;
     return true;
 }
 
+void EventLoopPool::SetInnerLoopsBusyPoll(int spin_us, int sock_busy_poll_us)
+{
+    core::common::locker_guard guard(m_pool_locker);
+    s_spin_us = spin_us;
+    s_sock_busy_poll_us = sock_busy_poll_us;
+    boost::shared_ptr<const InnerLoopContainerT> innerloops = GetInnerLoops();
+    for(size_t i = 0; i < innerloops->size(); ++i)
+        (*innerloops)[i].eventloop->SetBusyPoll(spin_us, sock_busy_poll_us);
+}
+
 void EventLoopPool::DestroyEventLoopPool()
 {
     EventLoopContainerT::iterator it = m_eventloop_pool.begin();
@@ -56,12 +112,17 @@ void EventLoopPool::DestroyEventLoopPool()
         jointids.push_back(it->second.looptid);
         ++it;
     }
-    EventLoopContainerT::iterator inner_it = m_innerloop_pool.begin();
-    while(inner_it != m_innerloop_pool.end())
+    boost::shared_ptr<const InnerLoopContainerT> innerloops;
     {
-        inner_it->second.eventloop->TerminateLoop();
-        jointids.push_back(inner_it->second.looptid);
-        ++inner_it;
+        core::common::locker_guard guard(m_pool_locker);
+        s_innerloops_started = 0;
+        innerloops = GetInnerLoops();
+        boost::atomic_store(&s_innerloops, boost::shared_ptr<const InnerLoopContainerT>(new InnerLoopContainerT()));
+    }
+    for(size_t i = 0; i < innerloops->size(); ++i)
+    {
+        (*innerloops)[i].eventloop->TerminateLoop();
+        jointids.push_back((*innerloops)[i].looptid);
     }
 
     for(size_t i = 0; i < jointids.size(); ++i)
@@ -72,12 +133,7 @@ void EventLoopPool::DestroyEventLoopPool()
 }
 bool EventLoopPool::CreateEventLoop(const std::string& name)
 {
-#if defined (__APPLE__) || defined (__MACH__) 
-        boost::shared_ptr< SockWaiterBase > spwaiter(new SelectWaiter());
-#else
-        //boost::shared_ptr< SockWaiterBase > spwaiter(new SelectWaiter());
-        boost::shared_ptr< SockWaiterBase > spwaiter(new EpollWaiter());
-#endif
+        boost::shared_ptr< SockWaiterBase > spwaiter = NewSockWaiter();
     core::common::locker_guard guard(m_pool_locker);
     if(m_eventloop_pool.find(name) != m_eventloop_pool.end())
     {// already created, just return true to indicate sucess.
@@ -99,56 +155,94 @@ bool EventLoopPool::CreateEventLoop(const std::string& name)
     return false;
 }
 
-bool EventLoopPool::AddTcpSockToInnerLoop(TcpSockSmartPtr sp_tcp)
+bool EventLoopPool::StartInnerLoops()
 {
+    if(s_innerloops_started)
+        return true;
     core::common::locker_guard guard(m_pool_locker);
-    EventLoopContainerT::iterator it = m_innerloop_pool.begin();
-    boost::shared_ptr<EventLoop> addedev;
-    while(it != m_innerloop_pool.end())
+    if(s_innerloops_started)
+        return true;
+    if(s_innerloop_num <= 0)
+        s_innerloop_num = GetCpuNum();
+    int cpunum = GetCpuNum();
+    boost::shared_ptr<InnerLoopContainerT> innerloops(new InnerLoopContainerT());
+    for(int i = 0; i < s_innerloop_num; ++i)
     {
-        if(it->second.eventloop)
+        boost::shared_ptr<EventLoop> sock_el(new EventLoop);
+        boost::shared_ptr< SockWaiterBase > spwaiter = NewSockWaiter();
+        sock_el->SetSockWaiter(spwaiter);
+        if(s_cpu_affinity)
+            sock_el->SetCpuAffinity(i % cpunum);
+        sock_el->SetBusyPoll(s_spin_us, s_sock_busy_poll_us);
+        pthread_t tid;
+        if (!sock_el->StartLoop(tid))
         {
-            if(it->second.eventloop->GetActiveTcpNum() < s_max_tcp_num_inloop)
-            {
-                addedev = it->second.eventloop;
-                break;
-            }
+            g_log.Log(lv_warn, "start inner event loop failed.");
+            break;
         }
-        ++it;
+        EventLoopWrapper wrapper;
+        wrapper.eventloop = sock_el;
+        wrapper.looptid = tid;
+        innerloops->push_back(wrapper);
+        g_log.Log(lv_debug, "new inner tcp event loop:%d started, tid:%ld.", i, (long)tid);
     }
-    if(addedev == NULL || addedev->GetActiveTcpNum() > s_max_tcp_num_inloop)
+    if(innerloops->empty())
+        return false;
+    boost::atomic_store(&s_innerloops, boost::shared_ptr<const InnerLoopContainerT>(innerloops));
+    // make sure the loops are visible before the flag.
+    __sync_synchronize();
+    s_innerloops_started = 1;
+    return true;
+}
+
+boost::shared_ptr<EventLoop> EventLoopPool::ChooseInnerLoop()
+{
+    if(!StartInnerLoops())
+        return boost::shared_ptr<EventLoop>();
+    // the snapshot keeps the loops alive even if the pool is destroyed at the same time.
+    boost::shared_ptr<const InnerLoopContainerT> innerloops = GetInnerLoops();
+    size_t loopnum = innerloops->size();
+    if(loopnum == 0)
+        return boost::shared_ptr<EventLoop>();
+    size_t chosen = __sync_fetch_and_add(&s_next_innerloop, 1) % loopnum;
+    if(s_placement == PlaceLeastConn)
     {
-        boost::shared_ptr<EventLoop> sock_el(new EventLoop);
-#if defined (__APPLE__) || defined (__MACH__) 
-        boost::shared_ptr< SockWaiterBase > spwaiter(new SelectWaiter());
-#else
-        //boost::shared_ptr< SockWaiterBase > spwaiter(new SelectWaiter());
-        boost::shared_ptr< SockWaiterBase > spwaiter(new EpollWaiter());
-#endif
-        sock_el->SetSockWaiter(spwaiter);
-        pthread_t tid;
-        if (sock_el->StartLoop(tid))
+        // start from the round robin one, so the equal loops will be used in turn.
+        int least = (*innerloops)[chosen].eventloop->GetActiveTcpNum();
+        for(size_t i = 1; i < loopnum && least > 0; ++i)
         {
-            addedev = sock_el;
-            std::string name = "innerloop_";
-            std::string id;
-            id.push_back('a' + m_innerloop_pool.size());
-            EventLoopWrapper wrapper;
-            wrapper.eventloop = sock_el;
-            wrapper.looptid = tid;
-            m_innerloop_pool[name + id] = wrapper;
-            g_log.Log(lv_debug, "new inner tcp event loop:%s started, tid:%ld.", id.c_str(), (long)tid);
+            size_t index = (chosen + i) % loopnum;
+            int tcpnum = (*innerloops)[index].eventloop->GetActiveTcpNum();
+            if(tcpnum < least)
+            {
+                least = tcpnum;
+                chosen = index;
+            }
         }
-        else
+    }
+    else if(s_placement == PlaceLeastBytes)
+    {
+        int64_t least = (*innerloops)[chosen].eventloop->GetIOBytesPerSec();
+        for(size_t i = 1; i < loopnum && least > 0; ++i)
         {
-            g_log.Log(lv_warn, "start inner event loop failed.");
-            return false;
+            size_t index = (chosen + i) % loopnum;
+            int64_t rate = (*innerloops)[index].eventloop->GetIOBytesPerSec();
+            if(rate < least)
+            {
+                least = rate;
+                chosen = index;
+            }
         }
     }
+    return (*innerloops)[chosen].eventloop;
+}
+
+bool EventLoopPool::AddTcpSockToInnerLoop(TcpSockSmartPtr sp_tcp)
+{
+    boost::shared_ptr<EventLoop> addedev = ChooseInnerLoop();
     if(!addedev)
         return false;
     return addedev->AddTcpSockToLoop(sp_tcp);
-    //g_log.Log(lv_debug, "inner tcp num:%d .", addedev->GetActiveTcpNum());
 }
 
 bool EventLoopPool::AddTcpSockToLoop(const std::string& loopname, TcpSockSmartPtr sp_tcp)
@@ -165,6 +259,66 @@ bool EventLoopPool::AddTcpSockToLoop(const std::string& loopname, TcpSockSmartPt
     return false;
 }
 
+bool EventLoopPool::ListenOnInnerLoops(const std::string& ip, unsigned short int& port, int backlog,
+    const SockHandler& listen_cb)
+{
+    if(!StartInnerLoops())
+        return false;
+    boost::shared_ptr<const InnerLoopContainerT> innerloops = GetInnerLoops();
+    if(innerloops->empty())
+        return false;
+#if defined (__APPLE__) || defined (__MACH__) 
+    // SO_REUSEPORT will not balance the connections between the listeners on mac.
+    size_t loopnum = 1;
+#else
+    size_t loopnum = innerloops->size();
+#endif
+    // the first listener binds the port without SO_REUSEPORT, which fails if any other socket is
+    // listening on it, so the listeners will not share the port with another server silently.
+    // the others join it by SO_REUSEPORT set after it is listening.
+    std::vector<TcpSockSmartPtr> listeners;
+    for(size_t i = 0; i < loopnum; ++i)
+    {
+        TcpSockSmartPtr sp_listen(new TcpSock());
+        if(!sp_listen->Listen(ip, port, backlog, i > 0))
+        {
+            g_log.Log(lv_error, "listen on port:%d failed in inner loop:%zu.", port, i);
+            break;
+        }
+        if(i == 0)
+        {
+            // the port 0 is resolved by the first listener, and the same port is used by the others.
+            std::string listen_ip;
+            sp_listen->GetDestHost(listen_ip, port);
+#ifdef SO_REUSEPORT
+            int optval = 1;
+            if(loopnum > 1 && 0 != setsockopt(sp_listen->GetFD(), SOL_SOCKET, SO_REUSEPORT, &optval, sizeof(optval)))
+            {
+                g_log.Log(lv_error, "set SO_REUSEPORT failed on port:%d, errno:%d.", port, errno);
+                sp_listen->Close();
+                break;
+            }
+#endif
+        }
+        sp_listen->SetSockHandler(listen_cb);
+        if(!(*innerloops)[i].eventloop->AddTcpSockToLoop(sp_listen))
+        {
+            sp_listen->Close();
+            break;
+        }
+        listeners.push_back(sp_listen);
+    }
+    if(listeners.size() < loopnum)
+    {
+        // the listeners opened are closed, so the port is released for the next try.
+        for(size_t i = 0; i < listeners.size(); ++i)
+            listeners[i]->Close();
+        return false;
+    }
+    g_log.Log(lv_debug, "listening on port:%d in %zu inner loops.", port, loopnum);
+    return true;
+}
+
 boost::shared_ptr<EventLoop> EventLoopPool::GetEventLoop(const std::string& name)
 {
     {
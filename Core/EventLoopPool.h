@@ -11,20 +11,44 @@
 
 namespace core { namespace net {
 
+// how to choose the inner loop for a new tcp.
+enum kInnerLoopPlacement
+{
+    PlaceRoundRobin = 0,
+    // the loop with the least active tcps.
+    PlaceLeastConn,
+    // the loop with the least io bytes in the last second.
+    PlaceLeastBytes
+};
+
 class EventLoopPool : private boost::noncopyable
 {
 public:
-    static bool  InitEventLoopPool(int tcp_in_each_innerloop = 0);
+    // the inner loops are a fixed pool started at the first use, innerloop_num <= 0 means one loop for
+    // each cpu. if cpu_affinity is true, each inner loop will be bound to one cpu.
+    static bool  InitEventLoopPool(int innerloop_num = 0, bool cpu_affinity = false, 
+        kInnerLoopPlacement placement = PlaceRoundRobin);
     static void  DestroyEventLoopPool();
+    // busy poll mode for all the inner loops, see EventLoop::SetBusyPoll. 
+    // the loops already started are changed too.
+    static void SetInnerLoopsBusyPoll(int spin_us, int sock_busy_poll_us = 0);
     static bool CreateEventLoop(const std::string& name);
     static void TerminateLoop(const std::string& name);
     static boost::shared_ptr< EventLoop > GetEventLoop(const std::string& name);
 
     //boost::shared_ptr< EventLoop > GetInnerEventLoop(TcpSockSmartPtr sp_tcp);
+    // choose the inner loop by the placement policy without any lock.
     static bool AddTcpSockToInnerLoop(TcpSockSmartPtr sp_tcp);
     static bool AddTcpSockToLoop(const std::string& loopname, TcpSockSmartPtr sp_tcp);
+    // start one listener with SO_REUSEPORT in each inner loop, so the new tcp will be accepted
+    // directly by the loop which will serve it. listen_cb.onAccept should be set. 
+    // the listeners are closed while destroying the pool. the port 0 is set to the port listened.
+    static bool ListenOnInnerLoops(const std::string& ip, unsigned short int& port, int backlog,
+        const SockHandler& listen_cb);
 
 private:
+    static bool StartInnerLoops();
+    static boost::shared_ptr<EventLoop> ChooseInnerLoop();
     EventLoopPool();
     ~EventLoopPool();
 };
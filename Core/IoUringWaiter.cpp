@@ -0,0 +1,404 @@
+#include "IoUringWaiter.h"
+#include "SockEvent.hpp"
+#include "SimpleLogger.h"
+
+#include <errno.h>
+#include <string.h>
+#include <poll.h>
+#include <endian.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <linux/io_uring.h>
+
+#define IOURING_QUEUE_LEN 256
+// the user data of the poll on the notify fd.
+#define NOTIFY_USER_DATA 0
+// the user data of the poll removing, the completion is ignored.
+#define IGNORED_USER_DATA 1
+#define FIRST_POLL_ID 2
+
+namespace core { namespace net {
+
+static LoggerCategory g_log("IoUringWaiter");
+
+static int sys_io_uring_setup(unsigned int entries, struct io_uring_params* p)
+{
+    return (int)syscall(__NR_io_uring_setup, entries, p);
+}
+
+static int sys_io_uring_enter(int ringfd, unsigned int to_submit, unsigned int min_complete,
+    unsigned int flags, void* arg, size_t argsz)
+{
+    return (int)syscall(__NR_io_uring_enter, ringfd, to_submit, min_complete, flags, arg, argsz);
+}
+
+bool IoUringWaiter::IsSupported()
+{
+    // -1 for unknown, checked only once.
+    static volatile int s_supported = -1;
+    if(s_supported >= 0)
+        return s_supported == 1;
+    struct io_uring_params p;
+    memset(&p, 0, sizeof(p));
+    int ringfd = sys_io_uring_setup(4, &p);
+    if(ringfd < 0)
+    {
+        g_log.Log(lv_debug, "io_uring is not available, errno:%d.", errno);
+        s_supported = 0;
+        return false;
+    }
+    close(ringfd);
+    // the timeout argument of io_uring_enter is supported since 5.11 and the multishot poll
+    // since 5.13, the same version as IORING_FEAT_RSRC_TAGS.
+    s_supported = ((p.features & IORING_FEAT_EXT_ARG) && (p.features & IORING_FEAT_RSRC_TAGS) &&
+        (p.features & IORING_FEAT_NODROP)) ? 1 : 0;
+    return s_supported == 1;
+}
+
+IoUringWaiter::IoUringWaiter()
+    :m_ringfd(-1),
+    m_sq_ring_ptr(MAP_FAILED),
+    m_sq_ring_size(0),
+    m_cq_ring_ptr(MAP_FAILED),
+    m_cq_ring_size(0),
+    m_sqes((struct io_uring_sqe*)MAP_FAILED),
+    m_sqes_size(0),
+    m_sq_pending(0),
+    m_next_pollid(FIRST_POLL_ID),
+    m_wait_round(0)
+{
+    if(!SetupRing(IOURING_QUEUE_LEN))
+    {
+        g_log.Log(lv_error, "io_uring setup failed.");
+        CloseRing();
+        return;
+    }
+    if(m_notify_pipe[0] >= 0)
+    {
+        QueuePollAdd(m_notify_pipe[0], POLLIN, NOTIFY_USER_DATA);
+    }
+}
+
+IoUringWaiter::~IoUringWaiter()
+{
+    DestroyWaiter();
+}
+
+bool IoUringWaiter::SetupRing(unsigned int entries)
+{
+    struct io_uring_params p;
+    memset(&p, 0, sizeof(p));
+    m_ringfd = sys_io_uring_setup(entries, &p);
+    if(m_ringfd < 0)
+        return false;
+    m_sq_entries = p.sq_entries;
+    m_sq_ring_size = p.sq_off.array + p.sq_entries*sizeof(unsigned int);
+    m_cq_ring_size = p.cq_off.cqes + p.cq_entries*sizeof(struct io_uring_cqe);
+    bool single_mmap = (p.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if(single_mmap)
+    {
+        if(m_cq_ring_size > m_sq_ring_size)
+            m_sq_ring_size = m_cq_ring_size;
+        m_cq_ring_size = m_sq_ring_size;
+    }
+    m_sq_ring_ptr = mmap(0, m_sq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+        m_ringfd, IORING_OFF_SQ_RING);
+    if(m_sq_ring_ptr == MAP_FAILED)
+        return false;
+    if(single_mmap)
+    {
+        m_cq_ring_ptr = m_sq_ring_ptr;
+    }
+    else
+    {
+        m_cq_ring_ptr = mmap(0, m_cq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+            m_ringfd, IORING_OFF_CQ_RING);
+        if(m_cq_ring_ptr == MAP_FAILED)
+            return false;
+    }
+    m_sqes_size = p.sq_entries*sizeof(struct io_uring_sqe);
+    m_sqes = (struct io_uring_sqe*)mmap(0, m_sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+        m_ringfd, IORING_OFF_SQES);
+    if(m_sqes == MAP_FAILED)
+        return false;
+
+    char* sq_ptr = (char*)m_sq_ring_ptr;
+    m_sq_head = (unsigned int*)(sq_ptr + p.sq_off.head);
+    m_sq_tail = (unsigned int*)(sq_ptr + p.sq_off.tail);
+    m_sq_mask = (unsigned int*)(sq_ptr + p.sq_off.ring_mask);
+    m_sq_array = (unsigned int*)(sq_ptr + p.sq_off.array);
+    char* cq_ptr = (char*)m_cq_ring_ptr;
+    m_cq_head = (unsigned int*)(cq_ptr + p.cq_off.head);
+    m_cq_tail = (unsigned int*)(cq_ptr + p.cq_off.tail);
+    m_cq_mask = (unsigned int*)(cq_ptr + p.cq_off.ring_mask);
+    m_cqes = (struct io_uring_cqe*)(cq_ptr + p.cq_off.cqes);
+    return true;
+}
+
+void IoUringWaiter::CloseRing()
+{
+    if(m_sqes != MAP_FAILED)
+        munmap(m_sqes, m_sqes_size);
+    if(m_cq_ring_ptr != MAP_FAILED && m_cq_ring_ptr != m_sq_ring_ptr)
+        munmap(m_cq_ring_ptr, m_cq_ring_size);
+    if(m_sq_ring_ptr != MAP_FAILED)
+        munmap(m_sq_ring_ptr, m_sq_ring_size);
+    m_sqes = (struct io_uring_sqe*)MAP_FAILED;
+    m_cq_ring_ptr = MAP_FAILED;
+    m_sq_ring_ptr = MAP_FAILED;
+    if(m_ringfd >= 0)
+    {
+        // all the polls in the ring are cancelled while closing.
+        close(m_ringfd);
+        m_ringfd = -1;
+    }
+    m_sq_pending = 0;
+}
+
+void IoUringWaiter::DestroyWaiter()
+{
+    CloseRing();
+    m_poll_entries.clear();
+    m_fd_pollids.clear();
+    SockWaiterBase::DestroyWaiter();
+}
+
+// the sqes are only consumed by the kernel in io_uring_enter called by the loop thread,
+// so the tail can be published before the sqe is filled.
+struct io_uring_sqe* IoUringWaiter::GetSqe()
+{
+    if(m_ringfd < 0)
+        return NULL;
+    unsigned int tail = *m_sq_tail;
+    if(tail - __atomic_load_n(m_sq_head, __ATOMIC_ACQUIRE) >= m_sq_entries)
+    {
+        // the submission ring is full, submit the queued sqes first.
+        sys_io_uring_enter(m_ringfd, m_sq_pending, 0, 0, NULL, 0);
+        m_sq_pending = tail - __atomic_load_n(m_sq_head, __ATOMIC_ACQUIRE);
+        if(m_sq_pending >= m_sq_entries)
+        {
+            g_log.Log(lv_error, "io_uring submission ring is full.");
+            return NULL;
+        }
+    }
+    unsigned int index = tail & *m_sq_mask;
+    struct io_uring_sqe* sqe = &m_sqes[index];
+    memset(sqe, 0, sizeof(*sqe));
+    m_sq_array[index] = index;
+    __atomic_store_n(m_sq_tail, tail + 1, __ATOMIC_RELEASE);
+    ++m_sq_pending;
+    return sqe;
+}
+
+void IoUringWaiter::QueuePollAdd(int fd, uint32_t mask, uint64_t user_data)
+{
+    struct io_uring_sqe* sqe = GetSqe();
+    if(sqe == NULL)
+        return;
+    sqe->opcode = IORING_OP_POLL_ADD;
+    sqe->fd = fd;
+#if __BYTE_ORDER == __BIG_ENDIAN
+    mask = (mask << 16) | (mask >> 16);
+#endif
+    sqe->poll32_events = mask;
+    // the multishot poll keeps posting the completion for each wakeup until removed,
+    // it is like the edge triggered mode in epoll.
+    sqe->len = IORING_POLL_ADD_MULTI;
+    sqe->user_data = user_data;
+}
+
+void IoUringWaiter::QueuePollRemove(uint64_t user_data)
+{
+    struct io_uring_sqe* sqe = GetSqe();
+    if(sqe == NULL)
+        return;
+    sqe->opcode = IORING_OP_POLL_REMOVE;
+    sqe->fd = -1;
+    sqe->addr = user_data;
+    sqe->user_data = IGNORED_USER_DATA;
+}
+
+void IoUringWaiter::RemovePoll(int fd)
+{
+    FdPollIdContainerT::iterator idit = m_fd_pollids.find(fd);
+    if(idit == m_fd_pollids.end())
+        return;
+    // the late completions of the removed poll will not find the entry and be ignored.
+    QueuePollRemove(idit->second);
+    m_poll_entries.erase(idit->second);
+    m_fd_pollids.erase(idit);
+}
+
+// note: can not be locked by caller.
+// only can be called in waiter thread.
+bool IoUringWaiter::UpdateTcpSockEvent(TcpSockSmartPtr sp_tcp)
+{
+    assert(sp_tcp);
+    int fd = sp_tcp->GetFD();
+    assert(fd != -1);
+    if( fd == -1 )
+    {
+        return false;
+    }
+    if(m_ringfd < 0)
+        return false;
+    SockEvent so_ev = sp_tcp->GetCaredSockEvent();
+    uint32_t mask = 0;
+    if(so_ev.hasRead())
+    {
+        mask |= POLLIN | POLLPRI | POLLRDHUP;
+    }
+    if(so_ev.hasWrite())
+    {
+        mask |= POLLOUT;
+    }
+    if(so_ev.hasException())
+    {
+        mask |= POLLERR;
+    }
+
+    FdPollIdContainerT::const_iterator idit = m_fd_pollids.find(fd);
+    if(idit != m_fd_pollids.end())
+    {
+        const PollEntry& entry = m_poll_entries[idit->second];
+        if(entry.ptcp == sp_tcp.get() && entry.mask == mask)
+            return true;
+        // the poll events can not be modified in place, so remove it and add a new one,
+        // both of them will be submitted with the next wait.
+        RemovePoll(fd);
+    }
+    if(mask == 0)
+        return true;
+    uint64_t pollid = m_next_pollid++;
+    PollEntry entry;
+    entry.ptcp = sp_tcp.get();
+    entry.fd = fd;
+    entry.mask = mask;
+    entry.ready_round = m_wait_round;
+    m_poll_entries[pollid] = entry;
+    m_fd_pollids[fd] = pollid;
+    QueuePollAdd(fd, mask, pollid);
+    return true;
+}
+
+void IoUringWaiter::HandleCqe(const struct io_uring_cqe& cqe, TcpSockReadyListT& allready, bool& notified)
+{
+    bool has_more = (cqe.flags & IORING_CQE_F_MORE) != 0;
+    if(cqe.user_data == NOTIFY_USER_DATA)
+    {
+        notified = true;
+        if(!has_more && m_notify_pipe[0] >= 0)
+            QueuePollAdd(m_notify_pipe[0], POLLIN, NOTIFY_USER_DATA);
+        return;
+    }
+    PollEntryContainerT::iterator it = m_poll_entries.find(cqe.user_data);
+    if(it == m_poll_entries.end())
+        return;
+    PollEntry& entry = it->second;
+    if(!has_more && cqe.res >= 0)
+    {
+        // the multishot poll is terminated by the kernel(such as the completion ring overflowed),
+        // arm it again.
+        QueuePollAdd(entry.fd, entry.mask, it->first);
+    }
+    // the waiting container keep the tcp alive while it is registered.
+    TcpSockContainerT::const_iterator waitingit = m_waiting_tcpsocks.find((long)entry.fd);
+    if(waitingit == m_waiting_tcpsocks.end() || waitingit->second.get() != entry.ptcp)
+        return;
+    const TcpSockSmartPtr& sptcp = waitingit->second;
+    // closed tcp has been removed from the ring, but the event may be
+    // already returned in the same batch.
+    if(sptcp->IsClosed())
+        return;
+    bool hasread = false;
+    bool haswrite = false;
+    bool hasexception = false;
+    if(cqe.res < 0)
+    {
+        if(cqe.res == -ECANCELED)
+            return;
+        g_log.Log(lv_warn, "poll error on fd:%d, err:%d.", entry.fd, -cqe.res);
+        hasexception = true;
+    }
+    else
+    {
+        uint32_t revents = (uint32_t)cqe.res;
+        hasread = (revents & (POLLIN | POLLPRI | POLLRDHUP | POLLHUP)) != 0;
+        haswrite = (revents & POLLOUT) != 0;
+        hasexception = (revents & POLLERR) != 0;
+    }
+    if(!hasread && !haswrite && !hasexception)
+        return;
+    // the tcp may be waked up more than once in one wait, only add to the ready list once.
+    if(entry.ready_round != m_wait_round)
+    {
+        entry.ready_round = m_wait_round;
+        sptcp->ClearEvent();
+        sptcp->RenewTimeout();
+        allready.push_back(sptcp);
+    }
+    if(hasread)
+        sptcp->AddEvent(EV_READ);
+    if(haswrite)
+        sptcp->AddEvent(EV_WRITE);
+    if(hasexception)
+        sptcp->AddEvent(EV_EXCEPTION);
+}
+
+int IoUringWaiter::Wait(TcpSockReadyListT& allready, int timeout_ms)
+{
+    if(m_ringfd < 0)
+        return -1;
+    allready.clear();
+
+    struct __kernel_timespec ts;
+    struct io_uring_getevents_arg arg;
+    memset(&arg, 0, sizeof(arg));
+    if(timeout_ms >= 0)
+    {
+        ts.tv_sec = timeout_ms/1000;
+        ts.tv_nsec = (timeout_ms%1000)*1000000LL;
+        arg.ts = (uint64_t)(uintptr_t)&ts;
+    }
+    // the completions left by last time need not to wait.
+    unsigned int min_complete = (*m_cq_head == __atomic_load_n(m_cq_tail, __ATOMIC_ACQUIRE)) ? 1 : 0;
+    // submit all the queued poll changes and wait for the completions by one syscall.
+    int ret = sys_io_uring_enter(m_ringfd, m_sq_pending, min_complete,
+        IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG, &arg, sizeof(arg));
+    int enter_err = errno;
+    m_sq_pending = *m_sq_tail - __atomic_load_n(m_sq_head, __ATOMIC_ACQUIRE);
+    // read the clock only once for each wakeup, the ready tcps renew the timeout by it.
+    m_timing_wheel.UpdateNow();
+    if(ret < 0 && enter_err != ETIME && enter_err != EINTR && enter_err != EBUSY && enter_err != EAGAIN)
+    {
+        GetAndClearNotify();
+        g_log.Log(lv_error, "io_uring_enter failed, errno:%d.", enter_err);
+        return -1;
+    }
+
+    ++m_wait_round;
+    bool notified = false;
+    unsigned int head = *m_cq_head;
+    unsigned int tail = __atomic_load_n(m_cq_tail, __ATOMIC_ACQUIRE);
+    int completed = 0;
+    while(head != tail)
+    {
+        HandleCqe(m_cqes[head & *m_cq_mask], allready, notified);
+        ++head;
+        ++completed;
+    }
+    __atomic_store_n(m_cq_head, head, __ATOMIC_RELEASE);
+
+    // only the tcps in the expired slots will be checked.
+    m_timing_wheel.Expire();
+    // the ready list hold the ready tcps now, so it is safe to clear the closed tcps.
+    int notifytype = GetAndClearNotify(notified);
+    if(notifytype & REMOVED)
+    {
+        ClearClosedTcpSock();
+    }
+    return completed;
+}
+
+} }
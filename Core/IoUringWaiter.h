@@ -0,0 +1,78 @@
+#ifndef  CORE_NET_IOURING_SOCKEVENTWAITER_H
+#define  CORE_NET_IOURING_SOCKEVENTWAITER_H
+
+#include "SockWaiterBase.h"
+#include <stdint.h>
+#include <boost/unordered_map.hpp>
+
+struct io_uring_sqe;
+struct io_uring_cqe;
+
+namespace core { namespace net {
+
+// the waiter using the multishot poll of io_uring by raw syscalls. all the event changes of
+// the tcps are queued in the submission ring and submitted with the wait by only one
+// io_uring_enter for each loop iteration, instead of one epoll_ctl for each change.
+// it only replaces the readiness notification of epoll, the accept, read and write are still
+// done by the TcpSock after the readiness. the multishot accept and recv are not used since
+// the TcpSock reads into its own buffer, while they need the buffers provided to the ring.
+class IoUringWaiter : public SockWaiterBase
+{
+public:
+    IoUringWaiter();
+    ~IoUringWaiter();
+    // whether the running kernel supports the io_uring features we needed.
+    static bool IsSupported();
+    // must run in the event loop thread.
+    int  Wait(TcpSockReadyListT& allready, int timeout_ms);
+    void DestroyWaiter();
+protected:
+    bool UpdateTcpSockEvent(TcpSockSmartPtr sp_tcp);
+private:
+    struct PollEntry
+    {
+        TcpSock* ptcp;
+        int fd;
+        uint32_t mask;
+        // the wait round in which the tcp has been added to the ready list.
+        uint32_t ready_round;
+    };
+    typedef boost::unordered_map<uint64_t, PollEntry> PollEntryContainerT;
+    typedef boost::unordered_map<int, uint64_t> FdPollIdContainerT;
+
+    bool SetupRing(unsigned int entries);
+    void CloseRing();
+    struct io_uring_sqe* GetSqe();
+    void QueuePollAdd(int fd, uint32_t mask, uint64_t user_data);
+    void QueuePollRemove(uint64_t user_data);
+    void RemovePoll(int fd);
+    void HandleCqe(const struct io_uring_cqe& cqe, TcpSockReadyListT& allready, bool& notified);
+
+    int m_ringfd;
+    void* m_sq_ring_ptr;
+    size_t m_sq_ring_size;
+    void* m_cq_ring_ptr;
+    size_t m_cq_ring_size;
+    struct io_uring_sqe* m_sqes;
+    size_t m_sqes_size;
+    unsigned int* m_sq_head;
+    unsigned int* m_sq_tail;
+    unsigned int* m_sq_mask;
+    unsigned int* m_sq_array;
+    unsigned int m_sq_entries;
+    unsigned int* m_cq_head;
+    unsigned int* m_cq_tail;
+    unsigned int* m_cq_mask;
+    struct io_uring_cqe* m_cqes;
+    // the sqes queued and not submitted yet.
+    unsigned int m_sq_pending;
+    // the user data of the poll is a increasing id, so the late completion of the
+    // removed poll can be found and ignored.
+    uint64_t m_next_pollid;
+    uint32_t m_wait_round;
+    PollEntryContainerT m_poll_entries;
+    FdPollIdContainerT m_fd_pollids;
+};
+} }
+
+#endif // end of CORE_NET_IOURING_SOCKEVENTWAITER_H
@@ -0,0 +1,215 @@
+#ifndef  MSGBUS_LOADBALANCER_H
+#define  MSGBUS_LOADBALANCER_H
+
+#include "msgbus_def.h"
+#include <stdlib.h>
+#include <string>
+#include <boost/shared_ptr.hpp>
+
+namespace NetMsgBus
+{
+
+// the load of one replica of a service, the lower the better.
+struct ReplicaLoad
+{
+    ReplicaLoad()
+        :busy_state(LOW),
+        inflight(0),
+        queued_bytes(0)
+    {
+    }
+    // the busy state reported by the replica itself.
+    kServerBusyState busy_state;
+    // the relayed requests queued to the replica and not written out yet.
+    long inflight;
+    // the bytes waiting in the outbound queue to the replica.
+    size_t queued_bytes;
+};
+
+// give the load of the index-th replica, implemented by the owner of the replicas.
+class ReplicaLoadGetter
+{
+public:
+    virtual ~ReplicaLoadGetter(){}
+    virtual ReplicaLoad operator()(size_t index) const = 0;
+};
+
+enum kLoadBalancePolicy {
+    LB_POWER_OF_TWO = 0,   // pick the less loaded one of two random replicas
+    LB_ROUND_ROBIN,        // pick the available replicas in turn
+    LB_LEAST_LOADED,       // pick the least loaded one of all the replicas
+    LB_WEIGHTED_RANDOM     // pick randomly by the busy state weights only
+};
+
+// select a replica from the replicas of a service. the selection may be done in many threads at
+// the same time, the per service state (the round robin cursor) is kept by the caller.
+class LoadBalancer
+{
+public:
+    virtual ~LoadBalancer(){}
+    // return the index of the selected replica, -1 if no replica is available.
+    virtual int Select(const ReplicaLoadGetter& loads, size_t count, volatile unsigned long& cursor) const = 0;
+
+    static boost::shared_ptr<LoadBalancer> Create(kLoadBalancePolicy policy);
+    // the policy names: p2c, rr, least, random.
+    static bool ParsePolicy(const std::string& name, kLoadBalancePolicy& policy)
+    {
+        if(name == "p2c")
+            policy = LB_POWER_OF_TWO;
+        else if(name == "rr")
+            policy = LB_ROUND_ROBIN;
+        else if(name == "least")
+            policy = LB_LEAST_LOADED;
+        else if(name == "random")
+            policy = LB_WEIGHTED_RANDOM;
+        else
+            return false;
+        return true;
+    }
+
+protected:
+    // the chance ratio of LOW, MIDDLE and HIGH is 4:3:2, the unavailable replica is never chosen.
+    static int BusyWeight(kServerBusyState state)
+    {
+        switch(state)
+        {
+        case LOW:
+            return 4;
+        case MIDDLE:
+            return 3;
+        case HIGH:
+            return 2;
+        default:
+            return 0;
+        }
+    }
+    // the pending work scaled by the capacity the busy state left, one pending request counts
+    // as much as 4KB waiting in the outbound queue.
+    static double LoadCost(const ReplicaLoad& load)
+    {
+        return (1.0 + load.inflight + load.queued_bytes/4096.0)/BusyWeight(load.busy_state);
+    }
+    static size_t RandIndex(size_t count)
+    {
+        return (size_t)((rand()/(RAND_MAX + 1.0))*count);
+    }
+};
+
+class PowerOfTwoBalancer : public LoadBalancer
+{
+public:
+    int Select(const ReplicaLoadGetter& loads, size_t count, volatile unsigned long& cursor) const
+    {
+        if(count == 0)
+            return -1;
+        size_t first = RandIndex(count);
+        ReplicaLoad first_load = loads(first);
+        if(count > 1)
+        {
+            size_t second = RandIndex(count - 1);
+            if(second >= first)
+                ++second;
+            ReplicaLoad second_load = loads(second);
+            if(BusyWeight(second_load.busy_state) > 0 &&
+                (BusyWeight(first_load.busy_state) == 0 || LoadCost(second_load) < LoadCost(first_load)))
+            {
+                return second;
+            }
+        }
+        if(BusyWeight(first_load.busy_state) > 0)
+            return first;
+        // both are unavailable, look for any available one.
+        for(size_t i = 0; i < count; ++i)
+        {
+            if(BusyWeight(loads(i).busy_state) > 0)
+                return i;
+        }
+        return -1;
+    }
+};
+
+class RoundRobinBalancer : public LoadBalancer
+{
+public:
+    int Select(const ReplicaLoadGetter& loads, size_t count, volatile unsigned long& cursor) const
+    {
+        for(size_t i = 0; i < count; ++i)
+        {
+            size_t index = __sync_fetch_and_add(&cursor, 1) % count;
+            if(BusyWeight(loads(index).busy_state) > 0)
+                return index;
+        }
+        return -1;
+    }
+};
+
+class LeastLoadedBalancer : public LoadBalancer
+{
+public:
+    int Select(const ReplicaLoadGetter& loads, size_t count, volatile unsigned long& cursor) const
+    {
+        int best = -1;
+        double best_cost = 0;
+        size_t best_num = 0;
+        for(size_t i = 0; i < count; ++i)
+        {
+            ReplicaLoad load = loads(i);
+            if(BusyWeight(load.busy_state) == 0)
+                continue;
+            double cost = LoadCost(load);
+            if(best < 0 || cost < best_cost)
+            {
+                best = i;
+                best_cost = cost;
+                best_num = 1;
+            }
+            else if(cost == best_cost && RandIndex(++best_num) == 0)
+            {
+                // keep the n-th equally loaded replica by the chance 1/n, so all of them are
+                // chosen evenly.
+                best = i;
+            }
+        }
+        return best;
+    }
+};
+
+class WeightedRandomBalancer : public LoadBalancer
+{
+public:
+    int Select(const ReplicaLoadGetter& loads, size_t count, volatile unsigned long& cursor) const
+    {
+        int total = 0;
+        for(size_t i = 0; i < count; ++i)
+            total += BusyWeight(loads(i).busy_state);
+        if(total == 0)
+            return -1;
+        int randweight = (int)RandIndex(total);
+        for(size_t i = 0; i < count; ++i)
+        {
+            randweight -= BusyWeight(loads(i).busy_state);
+            if(randweight < 0)
+                return i;
+        }
+        return -1;
+    }
+};
+
+inline boost::shared_ptr<LoadBalancer> LoadBalancer::Create(kLoadBalancePolicy policy)
+{
+    switch(policy)
+    {
+    case LB_ROUND_ROBIN:
+        return boost::shared_ptr<LoadBalancer>(new RoundRobinBalancer());
+    case LB_LEAST_LOADED:
+        return boost::shared_ptr<LoadBalancer>(new LeastLoadedBalancer());
+    case LB_WEIGHTED_RANDOM:
+        return boost::shared_ptr<LoadBalancer>(new WeightedRandomBalancer());
+    default:
+        return boost::shared_ptr<LoadBalancer>(new PowerOfTwoBalancer());
+    }
+}
+
+}
+
+#endif // end of MSGBUS_LOADBALANCER_H
@@ -0,0 +1,3868 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: NetMsgBus.PBParam.proto
+
+#include "NetMsgBus.PBParam.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace NetMsgBus {
+PROTOBUF_CONSTEXPR PBQueryServicesReq::PBQueryServicesReq(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.match_prefix_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
+struct PBQueryServicesReqDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PBQueryServicesReqDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PBQueryServicesReqDefaultTypeInternal() {}
+  union {
+    PBQueryServicesReq _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PBQueryServicesReqDefaultTypeInternal _PBQueryServicesReq_default_instance_;
+PROTOBUF_CONSTEXPR PBQueryServicesRsp::PBQueryServicesRsp(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.service_name_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PBQueryServicesRspDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PBQueryServicesRspDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PBQueryServicesRspDefaultTypeInternal() {}
+  union {
+    PBQueryServicesRsp _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PBQueryServicesRspDefaultTypeInternal _PBQueryServicesRsp_default_instance_;
+PROTOBUF_CONSTEXPR PBQueryMessagesReq::PBQueryMessagesReq(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.service_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.match_prefix_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
+struct PBQueryMessagesReqDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PBQueryMessagesReqDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PBQueryMessagesReqDefaultTypeInternal() {}
+  union {
+    PBQueryMessagesReq _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PBQueryMessagesReqDefaultTypeInternal _PBQueryMessagesReq_default_instance_;
+PROTOBUF_CONSTEXPR PBQueryMessagesRsp::PBQueryMessagesRsp(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.message_name_)*/{}
+  , /*decltype(_impl_.service_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
+struct PBQueryMessagesRspDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PBQueryMessagesRspDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PBQueryMessagesRspDefaultTypeInternal() {}
+  union {
+    PBQueryMessagesRsp _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PBQueryMessagesRspDefaultTypeInternal _PBQueryMessagesRsp_default_instance_;
+PROTOBUF_CONSTEXPR PBClientInfo::PBClientInfo(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.client_ip_)*/0u
+  , /*decltype(_impl_.client_port_)*/0u
+  , /*decltype(_impl_.client_state_)*/0} {}
+struct PBClientInfoDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PBClientInfoDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PBClientInfoDefaultTypeInternal() {}
+  union {
+    PBClientInfo _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PBClientInfoDefaultTypeInternal _PBClientInfo_default_instance_;
+PROTOBUF_CONSTEXPR PBServiceClients::PBServiceClients(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.client_info_)*/{}
+  , /*decltype(_impl_.service_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
+struct PBServiceClientsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PBServiceClientsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PBServiceClientsDefaultTypeInternal() {}
+  union {
+    PBServiceClients _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PBServiceClientsDefaultTypeInternal _PBServiceClients_default_instance_;
+PROTOBUF_CONSTEXPR PBSyncServerData::PBSyncServerData(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.service_info_)*/{}
+  , /*decltype(_impl_.server_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.full_sync_)*/false} {}
+struct PBSyncServerDataDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PBSyncServerDataDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PBSyncServerDataDefaultTypeInternal() {}
+  union {
+    PBSyncServerData _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PBSyncServerDataDefaultTypeInternal _PBSyncServerData_default_instance_;
+PROTOBUF_CONSTEXPR PBSubscribeServicesReq::PBSubscribeServicesReq(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.match_prefix_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.unsubscribe_)*/false} {}
+struct PBSubscribeServicesReqDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PBSubscribeServicesReqDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PBSubscribeServicesReqDefaultTypeInternal() {}
+  union {
+    PBSubscribeServicesReq _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PBSubscribeServicesReqDefaultTypeInternal _PBSubscribeServicesReq_default_instance_;
+PROTOBUF_CONSTEXPR PBServiceChangeNotify::PBServiceChangeNotify(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.service_info_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PBServiceChangeNotifyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PBServiceChangeNotifyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PBServiceChangeNotifyDefaultTypeInternal() {}
+  union {
+    PBServiceChangeNotify _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PBServiceChangeNotifyDefaultTypeInternal _PBServiceChangeNotify_default_instance_;
+PROTOBUF_CONSTEXPR PBAdvertiseMessagesReq::PBAdvertiseMessagesReq(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.message_name_)*/{}
+  , /*decltype(_impl_.message_prefix_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PBAdvertiseMessagesReqDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PBAdvertiseMessagesReqDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PBAdvertiseMessagesReqDefaultTypeInternal() {}
+  union {
+    PBAdvertiseMessagesReq _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PBAdvertiseMessagesReqDefaultTypeInternal _PBAdvertiseMessagesReq_default_instance_;
+PROTOBUF_CONSTEXPR PBGetClientsReq::PBGetClientsReq(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.service_name_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PBGetClientsReqDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PBGetClientsReqDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PBGetClientsReqDefaultTypeInternal() {}
+  union {
+    PBGetClientsReq _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PBGetClientsReqDefaultTypeInternal _PBGetClientsReq_default_instance_;
+PROTOBUF_CONSTEXPR PBRegisterServicesReq::PBRegisterServicesReq(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.service_name_)*/{}
+  , /*decltype(_impl_.client_info_)*/nullptr} {}
+struct PBRegisterServicesReqDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PBRegisterServicesReqDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PBRegisterServicesReqDefaultTypeInternal() {}
+  union {
+    PBRegisterServicesReq _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PBRegisterServicesReqDefaultTypeInternal _PBRegisterServicesReq_default_instance_;
+PROTOBUF_CONSTEXPR PBRegisterServicesRsp::PBRegisterServicesRsp(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.failed_service_name_)*/{}
+  , /*decltype(_impl_.err_msg_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PBRegisterServicesRspDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PBRegisterServicesRspDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PBRegisterServicesRspDefaultTypeInternal() {}
+  union {
+    PBRegisterServicesRsp _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PBRegisterServicesRspDefaultTypeInternal _PBRegisterServicesRsp_default_instance_;
+PROTOBUF_CONSTEXPR PBDisconnectNotify::PBDisconnectNotify(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.reason_code_)*/0} {}
+struct PBDisconnectNotifyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PBDisconnectNotifyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PBDisconnectNotifyDefaultTypeInternal() {}
+  union {
+    PBDisconnectNotify _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PBDisconnectNotifyDefaultTypeInternal _PBDisconnectNotify_default_instance_;
+}  // namespace NetMsgBus
+static ::_pb::Metadata file_level_metadata_NetMsgBus_2ePBParam_2eproto[14];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_NetMsgBus_2ePBParam_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_NetMsgBus_2ePBParam_2eproto = nullptr;
+
+const uint32_t TableStruct_NetMsgBus_2ePBParam_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::NetMsgBus::PBQueryServicesReq, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::NetMsgBus::PBQueryServicesReq, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::NetMsgBus::PBQueryServicesReq, _impl_.match_prefix_),
+  0,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::NetMsgBus::PBQueryServicesRsp, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::NetMsgBus::PBQueryServicesRsp, _impl_.service_name_),
+  PROTOBUF_FIELD_OFFSET(::NetMsgBus::PBQueryMessagesReq, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::NetMsgBus::PBQueryMessagesReq, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::NetMsgBus::PBQueryMessagesReq, _impl_.service_name_),
+  PROTOBUF_FIELD_OFFSET(::NetMsgBus::PBQueryMessagesReq, _impl_.match_prefix_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::NetMsgBus::PBQueryMessagesRsp, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::NetMsgBus::PBQueryMessagesRsp, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::NetMsgBus::PBQueryMessagesRsp, _impl_.service_name_),
+  PROTOBUF_FIELD_OFFSET(::NetMsgBus::PBQueryMessagesRsp, _impl_.message_name_),
+  0,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::NetMsgBus::PBClientInfo, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::NetMsgBus::PBClientInfo, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::NetMsgBus::PBClientInfo, _impl_.client_ip_),
+  PROTOBUF_FIELD_OFFSET(::NetMsgBus::PBClientInfo, _impl_.client_port_),
+  PROTOBUF_FIELD_OFFSET(::NetMsgBus::PBClientInfo, _impl_.client_state_),
+  0,
+  1,
+  2,
+  PROTOBUF_FIELD_OFFSET(::NetMsgBus::PBServiceClients, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::NetMsgBus::PBServiceClients, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::NetMsgBus::PBServiceClients, _impl_.service_name_),
+  PROTOBUF_FIELD_OFFSET(::NetMsgBus::PBServiceClients, _impl_.client_info_),
+  0,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::NetMsgBus::PBSyncServerData, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::NetMsgBus::PBSyncServerData, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::NetMsgBus::PBSyncServerData, _impl_.server_name_),
+  PROTOBUF_FIELD_OFFSET(::NetMsgBus::PBSyncServerData, _impl_.service_info_),
+  PROTOBUF_FIELD_OFFSET(::NetMsgBus::PBSyncServerData, _impl_.full_sync_),
+  0,
+  ~0u,
+  1,
+  PROTOBUF_FIELD_OFFSET(::NetMsgBus::PBSubscribeServicesReq, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::NetMsgBus::PBSubscribeServicesReq, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::NetMsgBus::PBSubscribeServicesReq, _impl_.match_prefix_),
+  PROTOBUF_FIELD_OFFSET(::NetMsgBus::PBSubscribeServicesReq, _impl_.unsubscribe_),
+  0,
+  1,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::NetMsgBus::PBServiceChangeNotify, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::NetMsgBus::PBServiceChangeNotify, _impl_.service_info_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::NetMsgBus::PBAdvertiseMessagesReq, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::NetMsgBus::PBAdvertiseMessagesReq, _impl_.message_name_),
+  PROTOBUF_FIELD_OFFSET(::NetMsgBus::PBAdvertiseMessagesReq, _impl_.message_prefix_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::NetMsgBus::PBGetClientsReq, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::NetMsgBus::PBGetClientsReq, _impl_.service_name_),
+  PROTOBUF_FIELD_OFFSET(::NetMsgBus::PBRegisterServicesReq, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::NetMsgBus::PBRegisterServicesReq, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::NetMsgBus::PBRegisterServicesReq, _impl_.service_name_),
+  PROTOBUF_FIELD_OFFSET(::NetMsgBus::PBRegisterServicesReq, _impl_.client_info_),
+  ~0u,
+  0,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::NetMsgBus::PBRegisterServicesRsp, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::NetMsgBus::PBRegisterServicesRsp, _impl_.failed_service_name_),
+  PROTOBUF_FIELD_OFFSET(::NetMsgBus::PBRegisterServicesRsp, _impl_.err_msg_),
+  PROTOBUF_FIELD_OFFSET(::NetMsgBus::PBDisconnectNotify, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::NetMsgBus::PBDisconnectNotify, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::NetMsgBus::PBDisconnectNotify, _impl_.reason_code_),
+  0,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 7, -1, sizeof(::NetMsgBus::PBQueryServicesReq)},
+  { 8, -1, -1, sizeof(::NetMsgBus::PBQueryServicesRsp)},
+  { 15, 23, -1, sizeof(::NetMsgBus::PBQueryMessagesReq)},
+  { 25, 33, -1, sizeof(::NetMsgBus::PBQueryMessagesRsp)},
+  { 35, 44, -1, sizeof(::NetMsgBus::PBClientInfo)},
+  { 47, 55, -1, sizeof(::NetMsgBus::PBServiceClients)},
+  { 57, 66, -1, sizeof(::NetMsgBus::PBSyncServerData)},
+  { 69, 77, -1, sizeof(::NetMsgBus::PBSubscribeServicesReq)},
+  { 79, -1, -1, sizeof(::NetMsgBus::PBServiceChangeNotify)},
+  { 86, -1, -1, sizeof(::NetMsgBus::PBAdvertiseMessagesReq)},
+  { 94, -1, -1, sizeof(::NetMsgBus::PBGetClientsReq)},
+  { 101, 109, -1, sizeof(::NetMsgBus::PBRegisterServicesReq)},
+  { 111, -1, -1, sizeof(::NetMsgBus::PBRegisterServicesRsp)},
+  { 119, 126, -1, sizeof(::NetMsgBus::PBDisconnectNotify)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::NetMsgBus::_PBQueryServicesReq_default_instance_._instance,
+  &::NetMsgBus::_PBQueryServicesRsp_default_instance_._instance,
+  &::NetMsgBus::_PBQueryMessagesReq_default_instance_._instance,
+  &::NetMsgBus::_PBQueryMessagesRsp_default_instance_._instance,
+  &::NetMsgBus::_PBClientInfo_default_instance_._instance,
+  &::NetMsgBus::_PBServiceClients_default_instance_._instance,
+  &::NetMsgBus::_PBSyncServerData_default_instance_._instance,
+  &::NetMsgBus::_PBSubscribeServicesReq_default_instance_._instance,
+  &::NetMsgBus::_PBServiceChangeNotify_default_instance_._instance,
+  &::NetMsgBus::_PBAdvertiseMessagesReq_default_instance_._instance,
+  &::NetMsgBus::_PBGetClientsReq_default_instance_._instance,
+  &::NetMsgBus::_PBRegisterServicesReq_default_instance_._instance,
+  &::NetMsgBus::_PBRegisterServicesRsp_default_instance_._instance,
+  &::NetMsgBus::_PBDisconnectNotify_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_NetMsgBus_2ePBParam_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\027NetMsgBus.PBParam.proto\022\tNetMsgBus\"*\n\022"
+  "PBQueryServicesReq\022\024\n\014match_prefix\030\001 \002(\t"
+  "\"*\n\022PBQueryServicesRsp\022\024\n\014service_name\030\001"
+  " \003(\t\"@\n\022PBQueryMessagesReq\022\024\n\014service_na"
+  "me\030\001 \002(\t\022\024\n\014match_prefix\030\002 \002(\t\"@\n\022PBQuer"
+  "yMessagesRsp\022\024\n\014service_name\030\001 \002(\t\022\024\n\014me"
+  "ssage_name\030\002 \003(\t\"L\n\014PBClientInfo\022\021\n\tclie"
+  "nt_ip\030\001 \002(\r\022\023\n\013client_port\030\002 \002(\r\022\024\n\014clie"
+  "nt_state\030\003 \002(\021\"V\n\020PBServiceClients\022\024\n\014se"
+  "rvice_name\030\001 \002(\t\022,\n\013client_info\030\002 \003(\0132\027."
+  "NetMsgBus.PBClientInfo\"t\n\020PBSyncServerDa"
+  "ta\022\023\n\013server_name\030\001 \002(\t\0221\n\014service_info\030"
+  "\002 \003(\0132\033.NetMsgBus.PBServiceClients\022\030\n\tfu"
+  "ll_sync\030\003 \001(\010:\005false\"J\n\026PBSubscribeServi"
+  "cesReq\022\024\n\014match_prefix\030\001 \002(\t\022\032\n\013unsubscr"
+  "ibe\030\002 \001(\010:\005false\"J\n\025PBServiceChangeNotif"
+  "y\0221\n\014service_info\030\001 \003(\0132\033.NetMsgBus.PBSe"
+  "rviceClients\"F\n\026PBAdvertiseMessagesReq\022\024"
+  "\n\014message_name\030\001 \003(\t\022\026\n\016message_prefix\030\002"
+  " \003(\t\"\'\n\017PBGetClientsReq\022\024\n\014service_name\030"
+  "\001 \003(\t\"[\n\025PBRegisterServicesReq\022\024\n\014servic"
+  "e_name\030\001 \003(\t\022,\n\013client_info\030\002 \002(\0132\027.NetM"
+  "sgBus.PBClientInfo\"E\n\025PBRegisterServices"
+  "Rsp\022\033\n\023failed_service_name\030\001 \003(\t\022\017\n\007err_"
+  "msg\030\002 \003(\t\")\n\022PBDisconnectNotify\022\023\n\013reaso"
+  "n_code\030\001 \002(\005"
+  ;
+static ::_pbi::once_flag descriptor_table_NetMsgBus_2ePBParam_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_NetMsgBus_2ePBParam_2eproto = {
+    false, false, 1012, descriptor_table_protodef_NetMsgBus_2ePBParam_2eproto,
+    "NetMsgBus.PBParam.proto",
+    &descriptor_table_NetMsgBus_2ePBParam_2eproto_once, nullptr, 0, 14,
+    schemas, file_default_instances, TableStruct_NetMsgBus_2ePBParam_2eproto::offsets,
+    file_level_metadata_NetMsgBus_2ePBParam_2eproto, file_level_enum_descriptors_NetMsgBus_2ePBParam_2eproto,
+    file_level_service_descriptors_NetMsgBus_2ePBParam_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_NetMsgBus_2ePBParam_2eproto_getter() {
+  return &descriptor_table_NetMsgBus_2ePBParam_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_NetMsgBus_2ePBParam_2eproto(&descriptor_table_NetMsgBus_2ePBParam_2eproto);
+namespace NetMsgBus {
+
+// ===================================================================
+
+class PBQueryServicesReq::_Internal {
+ public:
+  using HasBits = decltype(std::declval<PBQueryServicesReq>()._impl_._has_bits_);
+  static void set_has_match_prefix(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+PBQueryServicesReq::PBQueryServicesReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:NetMsgBus.PBQueryServicesReq)
+}
+PBQueryServicesReq::PBQueryServicesReq(const PBQueryServicesReq& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PBQueryServicesReq* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.match_prefix_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.match_prefix_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.match_prefix_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_match_prefix()) {
+    _this->_impl_.match_prefix_.Set(from._internal_match_prefix(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:NetMsgBus.PBQueryServicesReq)
+}
+
+inline void PBQueryServicesReq::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.match_prefix_){}
+  };
+  _impl_.match_prefix_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.match_prefix_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+PBQueryServicesReq::~PBQueryServicesReq() {
+  // @@protoc_insertion_point(destructor:NetMsgBus.PBQueryServicesReq)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PBQueryServicesReq::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.match_prefix_.Destroy();
+}
+
+void PBQueryServicesReq::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PBQueryServicesReq::Clear() {
+// @@protoc_insertion_point(message_clear_start:NetMsgBus.PBQueryServicesReq)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.match_prefix_.ClearNonDefaultToEmpty();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PBQueryServicesReq::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string match_prefix = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_match_prefix();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "NetMsgBus.PBQueryServicesReq.match_prefix");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PBQueryServicesReq::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:NetMsgBus.PBQueryServicesReq)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string match_prefix = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_match_prefix().data(), static_cast<int>(this->_internal_match_prefix().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "NetMsgBus.PBQueryServicesReq.match_prefix");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_match_prefix(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:NetMsgBus.PBQueryServicesReq)
+  return target;
+}
+
+size_t PBQueryServicesReq::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:NetMsgBus.PBQueryServicesReq)
+  size_t total_size = 0;
+
+  // required string match_prefix = 1;
+  if (_internal_has_match_prefix()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_match_prefix());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PBQueryServicesReq::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PBQueryServicesReq::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PBQueryServicesReq::GetClassData() const { return &_class_data_; }
+
+
+void PBQueryServicesReq::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PBQueryServicesReq*>(&to_msg);
+  auto& from = static_cast<const PBQueryServicesReq&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:NetMsgBus.PBQueryServicesReq)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_match_prefix()) {
+    _this->_internal_set_match_prefix(from._internal_match_prefix());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PBQueryServicesReq::CopyFrom(const PBQueryServicesReq& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:NetMsgBus.PBQueryServicesReq)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PBQueryServicesReq::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void PBQueryServicesReq::InternalSwap(PBQueryServicesReq* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.match_prefix_, lhs_arena,
+      &other->_impl_.match_prefix_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PBQueryServicesReq::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_NetMsgBus_2ePBParam_2eproto_getter, &descriptor_table_NetMsgBus_2ePBParam_2eproto_once,
+      file_level_metadata_NetMsgBus_2ePBParam_2eproto[0]);
+}
+
+// ===================================================================
+
+class PBQueryServicesRsp::_Internal {
+ public:
+};
+
+PBQueryServicesRsp::PBQueryServicesRsp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:NetMsgBus.PBQueryServicesRsp)
+}
+PBQueryServicesRsp::PBQueryServicesRsp(const PBQueryServicesRsp& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PBQueryServicesRsp* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.service_name_){from._impl_.service_name_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:NetMsgBus.PBQueryServicesRsp)
+}
+
+inline void PBQueryServicesRsp::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.service_name_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+PBQueryServicesRsp::~PBQueryServicesRsp() {
+  // @@protoc_insertion_point(destructor:NetMsgBus.PBQueryServicesRsp)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PBQueryServicesRsp::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.service_name_.~RepeatedPtrField();
+}
+
+void PBQueryServicesRsp::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PBQueryServicesRsp::Clear() {
+// @@protoc_insertion_point(message_clear_start:NetMsgBus.PBQueryServicesRsp)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.service_name_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PBQueryServicesRsp::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated string service_name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_service_name();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            #ifndef NDEBUG
+            ::_pbi::VerifyUTF8(str, "NetMsgBus.PBQueryServicesRsp.service_name");
+            #endif  // !NDEBUG
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PBQueryServicesRsp::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:NetMsgBus.PBQueryServicesRsp)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated string service_name = 1;
+  for (int i = 0, n = this->_internal_service_name_size(); i < n; i++) {
+    const auto& s = this->_internal_service_name(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "NetMsgBus.PBQueryServicesRsp.service_name");
+    target = stream->WriteString(1, s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:NetMsgBus.PBQueryServicesRsp)
+  return target;
+}
+
+size_t PBQueryServicesRsp::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:NetMsgBus.PBQueryServicesRsp)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated string service_name = 1;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.service_name_.size());
+  for (int i = 0, n = _impl_.service_name_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.service_name_.Get(i));
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PBQueryServicesRsp::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PBQueryServicesRsp::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PBQueryServicesRsp::GetClassData() const { return &_class_data_; }
+
+
+void PBQueryServicesRsp::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PBQueryServicesRsp*>(&to_msg);
+  auto& from = static_cast<const PBQueryServicesRsp&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:NetMsgBus.PBQueryServicesRsp)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.service_name_.MergeFrom(from._impl_.service_name_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PBQueryServicesRsp::CopyFrom(const PBQueryServicesRsp& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:NetMsgBus.PBQueryServicesRsp)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PBQueryServicesRsp::IsInitialized() const {
+  return true;
+}
+
+void PBQueryServicesRsp::InternalSwap(PBQueryServicesRsp* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.service_name_.InternalSwap(&other->_impl_.service_name_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PBQueryServicesRsp::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_NetMsgBus_2ePBParam_2eproto_getter, &descriptor_table_NetMsgBus_2ePBParam_2eproto_once,
+      file_level_metadata_NetMsgBus_2ePBParam_2eproto[1]);
+}
+
+// ===================================================================
+
+class PBQueryMessagesReq::_Internal {
+ public:
+  using HasBits = decltype(std::declval<PBQueryMessagesReq>()._impl_._has_bits_);
+  static void set_has_service_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_match_prefix(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+PBQueryMessagesReq::PBQueryMessagesReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:NetMsgBus.PBQueryMessagesReq)
+}
+PBQueryMessagesReq::PBQueryMessagesReq(const PBQueryMessagesReq& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PBQueryMessagesReq* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.service_name_){}
+    , decltype(_impl_.match_prefix_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.service_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.service_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_service_name()) {
+    _this->_impl_.service_name_.Set(from._internal_service_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.match_prefix_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.match_prefix_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_match_prefix()) {
+    _this->_impl_.match_prefix_.Set(from._internal_match_prefix(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:NetMsgBus.PBQueryMessagesReq)
+}
+
+inline void PBQueryMessagesReq::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.service_name_){}
+    , decltype(_impl_.match_prefix_){}
+  };
+  _impl_.service_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.service_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.match_prefix_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.match_prefix_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+PBQueryMessagesReq::~PBQueryMessagesReq() {
+  // @@protoc_insertion_point(destructor:NetMsgBus.PBQueryMessagesReq)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PBQueryMessagesReq::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.service_name_.Destroy();
+  _impl_.match_prefix_.Destroy();
+}
+
+void PBQueryMessagesReq::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PBQueryMessagesReq::Clear() {
+// @@protoc_insertion_point(message_clear_start:NetMsgBus.PBQueryMessagesReq)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.service_name_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.match_prefix_.ClearNonDefaultToEmpty();
+    }
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PBQueryMessagesReq::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string service_name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_service_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "NetMsgBus.PBQueryMessagesReq.service_name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required string match_prefix = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_match_prefix();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "NetMsgBus.PBQueryMessagesReq.match_prefix");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PBQueryMessagesReq::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:NetMsgBus.PBQueryMessagesReq)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string service_name = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_service_name().data(), static_cast<int>(this->_internal_service_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "NetMsgBus.PBQueryMessagesReq.service_name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_service_name(), target);
+  }
+
+  // required string match_prefix = 2;
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_match_prefix().data(), static_cast<int>(this->_internal_match_prefix().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "NetMsgBus.PBQueryMessagesReq.match_prefix");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_match_prefix(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:NetMsgBus.PBQueryMessagesReq)
+  return target;
+}
+
+size_t PBQueryMessagesReq::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:NetMsgBus.PBQueryMessagesReq)
+  size_t total_size = 0;
+
+  if (_internal_has_service_name()) {
+    // required string service_name = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_service_name());
+  }
+
+  if (_internal_has_match_prefix()) {
+    // required string match_prefix = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_match_prefix());
+  }
+
+  return total_size;
+}
+size_t PBQueryMessagesReq::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:NetMsgBus.PBQueryMessagesReq)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required string service_name = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_service_name());
+
+    // required string match_prefix = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_match_prefix());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PBQueryMessagesReq::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PBQueryMessagesReq::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PBQueryMessagesReq::GetClassData() const { return &_class_data_; }
+
+
+void PBQueryMessagesReq::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PBQueryMessagesReq*>(&to_msg);
+  auto& from = static_cast<const PBQueryMessagesReq&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:NetMsgBus.PBQueryMessagesReq)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_service_name(from._internal_service_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_match_prefix(from._internal_match_prefix());
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PBQueryMessagesReq::CopyFrom(const PBQueryMessagesReq& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:NetMsgBus.PBQueryMessagesReq)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PBQueryMessagesReq::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void PBQueryMessagesReq::InternalSwap(PBQueryMessagesReq* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.service_name_, lhs_arena,
+      &other->_impl_.service_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.match_prefix_, lhs_arena,
+      &other->_impl_.match_prefix_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PBQueryMessagesReq::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_NetMsgBus_2ePBParam_2eproto_getter, &descriptor_table_NetMsgBus_2ePBParam_2eproto_once,
+      file_level_metadata_NetMsgBus_2ePBParam_2eproto[2]);
+}
+
+// ===================================================================
+
+class PBQueryMessagesRsp::_Internal {
+ public:
+  using HasBits = decltype(std::declval<PBQueryMessagesRsp>()._impl_._has_bits_);
+  static void set_has_service_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+PBQueryMessagesRsp::PBQueryMessagesRsp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:NetMsgBus.PBQueryMessagesRsp)
+}
+PBQueryMessagesRsp::PBQueryMessagesRsp(const PBQueryMessagesRsp& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PBQueryMessagesRsp* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.message_name_){from._impl_.message_name_}
+    , decltype(_impl_.service_name_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.service_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.service_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_service_name()) {
+    _this->_impl_.service_name_.Set(from._internal_service_name(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:NetMsgBus.PBQueryMessagesRsp)
+}
+
+inline void PBQueryMessagesRsp::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.message_name_){arena}
+    , decltype(_impl_.service_name_){}
+  };
+  _impl_.service_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.service_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+PBQueryMessagesRsp::~PBQueryMessagesRsp() {
+  // @@protoc_insertion_point(destructor:NetMsgBus.PBQueryMessagesRsp)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PBQueryMessagesRsp::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.message_name_.~RepeatedPtrField();
+  _impl_.service_name_.Destroy();
+}
+
+void PBQueryMessagesRsp::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PBQueryMessagesRsp::Clear() {
+// @@protoc_insertion_point(message_clear_start:NetMsgBus.PBQueryMessagesRsp)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.message_name_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.service_name_.ClearNonDefaultToEmpty();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PBQueryMessagesRsp::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string service_name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_service_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "NetMsgBus.PBQueryMessagesRsp.service_name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string message_name = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_message_name();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            #ifndef NDEBUG
+            ::_pbi::VerifyUTF8(str, "NetMsgBus.PBQueryMessagesRsp.message_name");
+            #endif  // !NDEBUG
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PBQueryMessagesRsp::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:NetMsgBus.PBQueryMessagesRsp)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string service_name = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_service_name().data(), static_cast<int>(this->_internal_service_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "NetMsgBus.PBQueryMessagesRsp.service_name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_service_name(), target);
+  }
+
+  // repeated string message_name = 2;
+  for (int i = 0, n = this->_internal_message_name_size(); i < n; i++) {
+    const auto& s = this->_internal_message_name(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "NetMsgBus.PBQueryMessagesRsp.message_name");
+    target = stream->WriteString(2, s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:NetMsgBus.PBQueryMessagesRsp)
+  return target;
+}
+
+size_t PBQueryMessagesRsp::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:NetMsgBus.PBQueryMessagesRsp)
+  size_t total_size = 0;
+
+  // required string service_name = 1;
+  if (_internal_has_service_name()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_service_name());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated string message_name = 2;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.message_name_.size());
+  for (int i = 0, n = _impl_.message_name_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.message_name_.Get(i));
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PBQueryMessagesRsp::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PBQueryMessagesRsp::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PBQueryMessagesRsp::GetClassData() const { return &_class_data_; }
+
+
+void PBQueryMessagesRsp::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PBQueryMessagesRsp*>(&to_msg);
+  auto& from = static_cast<const PBQueryMessagesRsp&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:NetMsgBus.PBQueryMessagesRsp)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.message_name_.MergeFrom(from._impl_.message_name_);
+  if (from._internal_has_service_name()) {
+    _this->_internal_set_service_name(from._internal_service_name());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PBQueryMessagesRsp::CopyFrom(const PBQueryMessagesRsp& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:NetMsgBus.PBQueryMessagesRsp)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PBQueryMessagesRsp::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void PBQueryMessagesRsp::InternalSwap(PBQueryMessagesRsp* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.message_name_.InternalSwap(&other->_impl_.message_name_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.service_name_, lhs_arena,
+      &other->_impl_.service_name_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PBQueryMessagesRsp::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_NetMsgBus_2ePBParam_2eproto_getter, &descriptor_table_NetMsgBus_2ePBParam_2eproto_once,
+      file_level_metadata_NetMsgBus_2ePBParam_2eproto[3]);
+}
+
+// ===================================================================
+
+class PBClientInfo::_Internal {
+ public:
+  using HasBits = decltype(std::declval<PBClientInfo>()._impl_._has_bits_);
+  static void set_has_client_ip(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_client_port(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_client_state(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000007) ^ 0x00000007) != 0;
+  }
+};
+
+PBClientInfo::PBClientInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:NetMsgBus.PBClientInfo)
+}
+PBClientInfo::PBClientInfo(const PBClientInfo& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PBClientInfo* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.client_ip_){}
+    , decltype(_impl_.client_port_){}
+    , decltype(_impl_.client_state_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.client_ip_, &from._impl_.client_ip_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.client_state_) -
+    reinterpret_cast<char*>(&_impl_.client_ip_)) + sizeof(_impl_.client_state_));
+  // @@protoc_insertion_point(copy_constructor:NetMsgBus.PBClientInfo)
+}
+
+inline void PBClientInfo::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.client_ip_){0u}
+    , decltype(_impl_.client_port_){0u}
+    , decltype(_impl_.client_state_){0}
+  };
+}
+
+PBClientInfo::~PBClientInfo() {
+  // @@protoc_insertion_point(destructor:NetMsgBus.PBClientInfo)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PBClientInfo::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void PBClientInfo::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PBClientInfo::Clear() {
+// @@protoc_insertion_point(message_clear_start:NetMsgBus.PBClientInfo)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    ::memset(&_impl_.client_ip_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.client_state_) -
+        reinterpret_cast<char*>(&_impl_.client_ip_)) + sizeof(_impl_.client_state_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PBClientInfo::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint32 client_ip = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_client_ip(&has_bits);
+          _impl_.client_ip_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 client_port = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_client_port(&has_bits);
+          _impl_.client_port_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required sint32 client_state = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_client_state(&has_bits);
+          _impl_.client_state_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PBClientInfo::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:NetMsgBus.PBClientInfo)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint32 client_ip = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_client_ip(), target);
+  }
+
+  // required uint32 client_port = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_client_port(), target);
+  }
+
+  // required sint32 client_state = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteSInt32ToArray(3, this->_internal_client_state(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:NetMsgBus.PBClientInfo)
+  return target;
+}
+
+size_t PBClientInfo::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:NetMsgBus.PBClientInfo)
+  size_t total_size = 0;
+
+  if (_internal_has_client_ip()) {
+    // required uint32 client_ip = 1;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_client_ip());
+  }
+
+  if (_internal_has_client_port()) {
+    // required uint32 client_port = 2;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_client_port());
+  }
+
+  if (_internal_has_client_state()) {
+    // required sint32 client_state = 3;
+    total_size += ::_pbi::WireFormatLite::SInt32SizePlusOne(this->_internal_client_state());
+  }
+
+  return total_size;
+}
+size_t PBClientInfo::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:NetMsgBus.PBClientInfo)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000007) ^ 0x00000007) == 0) {  // All required fields are present.
+    // required uint32 client_ip = 1;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_client_ip());
+
+    // required uint32 client_port = 2;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_client_port());
+
+    // required sint32 client_state = 3;
+    total_size += ::_pbi::WireFormatLite::SInt32SizePlusOne(this->_internal_client_state());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PBClientInfo::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PBClientInfo::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PBClientInfo::GetClassData() const { return &_class_data_; }
+
+
+void PBClientInfo::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PBClientInfo*>(&to_msg);
+  auto& from = static_cast<const PBClientInfo&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:NetMsgBus.PBClientInfo)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.client_ip_ = from._impl_.client_ip_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.client_port_ = from._impl_.client_port_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.client_state_ = from._impl_.client_state_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PBClientInfo::CopyFrom(const PBClientInfo& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:NetMsgBus.PBClientInfo)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PBClientInfo::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void PBClientInfo::InternalSwap(PBClientInfo* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PBClientInfo, _impl_.client_state_)
+      + sizeof(PBClientInfo::_impl_.client_state_)
+      - PROTOBUF_FIELD_OFFSET(PBClientInfo, _impl_.client_ip_)>(
+          reinterpret_cast<char*>(&_impl_.client_ip_),
+          reinterpret_cast<char*>(&other->_impl_.client_ip_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PBClientInfo::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_NetMsgBus_2ePBParam_2eproto_getter, &descriptor_table_NetMsgBus_2ePBParam_2eproto_once,
+      file_level_metadata_NetMsgBus_2ePBParam_2eproto[4]);
+}
+
+// ===================================================================
+
+class PBServiceClients::_Internal {
+ public:
+  using HasBits = decltype(std::declval<PBServiceClients>()._impl_._has_bits_);
+  static void set_has_service_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+PBServiceClients::PBServiceClients(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:NetMsgBus.PBServiceClients)
+}
+PBServiceClients::PBServiceClients(const PBServiceClients& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PBServiceClients* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.client_info_){from._impl_.client_info_}
+    , decltype(_impl_.service_name_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.service_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.service_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_service_name()) {
+    _this->_impl_.service_name_.Set(from._internal_service_name(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:NetMsgBus.PBServiceClients)
+}
+
+inline void PBServiceClients::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.client_info_){arena}
+    , decltype(_impl_.service_name_){}
+  };
+  _impl_.service_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.service_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+PBServiceClients::~PBServiceClients() {
+  // @@protoc_insertion_point(destructor:NetMsgBus.PBServiceClients)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PBServiceClients::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.client_info_.~RepeatedPtrField();
+  _impl_.service_name_.Destroy();
+}
+
+void PBServiceClients::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PBServiceClients::Clear() {
+// @@protoc_insertion_point(message_clear_start:NetMsgBus.PBServiceClients)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.client_info_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.service_name_.ClearNonDefaultToEmpty();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PBServiceClients::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string service_name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_service_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "NetMsgBus.PBServiceClients.service_name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .NetMsgBus.PBClientInfo client_info = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_client_info(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PBServiceClients::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:NetMsgBus.PBServiceClients)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string service_name = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_service_name().data(), static_cast<int>(this->_internal_service_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "NetMsgBus.PBServiceClients.service_name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_service_name(), target);
+  }
+
+  // repeated .NetMsgBus.PBClientInfo client_info = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_client_info_size()); i < n; i++) {
+    const auto& repfield = this->_internal_client_info(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:NetMsgBus.PBServiceClients)
+  return target;
+}
+
+size_t PBServiceClients::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:NetMsgBus.PBServiceClients)
+  size_t total_size = 0;
+
+  // required string service_name = 1;
+  if (_internal_has_service_name()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_service_name());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .NetMsgBus.PBClientInfo client_info = 2;
+  total_size += 1UL * this->_internal_client_info_size();
+  for (const auto& msg : this->_impl_.client_info_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PBServiceClients::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PBServiceClients::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PBServiceClients::GetClassData() const { return &_class_data_; }
+
+
+void PBServiceClients::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PBServiceClients*>(&to_msg);
+  auto& from = static_cast<const PBServiceClients&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:NetMsgBus.PBServiceClients)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.client_info_.MergeFrom(from._impl_.client_info_);
+  if (from._internal_has_service_name()) {
+    _this->_internal_set_service_name(from._internal_service_name());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PBServiceClients::CopyFrom(const PBServiceClients& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:NetMsgBus.PBServiceClients)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PBServiceClients::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.client_info_))
+    return false;
+  return true;
+}
+
+void PBServiceClients::InternalSwap(PBServiceClients* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.client_info_.InternalSwap(&other->_impl_.client_info_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.service_name_, lhs_arena,
+      &other->_impl_.service_name_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PBServiceClients::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_NetMsgBus_2ePBParam_2eproto_getter, &descriptor_table_NetMsgBus_2ePBParam_2eproto_once,
+      file_level_metadata_NetMsgBus_2ePBParam_2eproto[5]);
+}
+
+// ===================================================================
+
+class PBSyncServerData::_Internal {
+ public:
+  using HasBits = decltype(std::declval<PBSyncServerData>()._impl_._has_bits_);
+  static void set_has_server_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_full_sync(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+PBSyncServerData::PBSyncServerData(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:NetMsgBus.PBSyncServerData)
+}
+PBSyncServerData::PBSyncServerData(const PBSyncServerData& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PBSyncServerData* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.service_info_){from._impl_.service_info_}
+    , decltype(_impl_.server_name_){}
+    , decltype(_impl_.full_sync_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.server_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.server_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_server_name()) {
+    _this->_impl_.server_name_.Set(from._internal_server_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.full_sync_ = from._impl_.full_sync_;
+  // @@protoc_insertion_point(copy_constructor:NetMsgBus.PBSyncServerData)
+}
+
+inline void PBSyncServerData::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.service_info_){arena}
+    , decltype(_impl_.server_name_){}
+    , decltype(_impl_.full_sync_){false}
+  };
+  _impl_.server_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.server_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+PBSyncServerData::~PBSyncServerData() {
+  // @@protoc_insertion_point(destructor:NetMsgBus.PBSyncServerData)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PBSyncServerData::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.service_info_.~RepeatedPtrField();
+  _impl_.server_name_.Destroy();
+}
+
+void PBSyncServerData::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PBSyncServerData::Clear() {
+// @@protoc_insertion_point(message_clear_start:NetMsgBus.PBSyncServerData)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.service_info_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.server_name_.ClearNonDefaultToEmpty();
+  }
+  _impl_.full_sync_ = false;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PBSyncServerData::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string server_name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_server_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "NetMsgBus.PBSyncServerData.server_name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .NetMsgBus.PBServiceClients service_info = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_service_info(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool full_sync = 3 [default = false];
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_full_sync(&has_bits);
+          _impl_.full_sync_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PBSyncServerData::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:NetMsgBus.PBSyncServerData)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string server_name = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_server_name().data(), static_cast<int>(this->_internal_server_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "NetMsgBus.PBSyncServerData.server_name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_server_name(), target);
+  }
+
+  // repeated .NetMsgBus.PBServiceClients service_info = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_service_info_size()); i < n; i++) {
+    const auto& repfield = this->_internal_service_info(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // optional bool full_sync = 3 [default = false];
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_full_sync(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:NetMsgBus.PBSyncServerData)
+  return target;
+}
+
+size_t PBSyncServerData::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:NetMsgBus.PBSyncServerData)
+  size_t total_size = 0;
+
+  // required string server_name = 1;
+  if (_internal_has_server_name()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_server_name());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .NetMsgBus.PBServiceClients service_info = 2;
+  total_size += 1UL * this->_internal_service_info_size();
+  for (const auto& msg : this->_impl_.service_info_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // optional bool full_sync = 3 [default = false];
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000002u) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PBSyncServerData::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PBSyncServerData::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PBSyncServerData::GetClassData() const { return &_class_data_; }
+
+
+void PBSyncServerData::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PBSyncServerData*>(&to_msg);
+  auto& from = static_cast<const PBSyncServerData&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:NetMsgBus.PBSyncServerData)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.service_info_.MergeFrom(from._impl_.service_info_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_server_name(from._internal_server_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.full_sync_ = from._impl_.full_sync_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PBSyncServerData::CopyFrom(const PBSyncServerData& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:NetMsgBus.PBSyncServerData)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PBSyncServerData::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.service_info_))
+    return false;
+  return true;
+}
+
+void PBSyncServerData::InternalSwap(PBSyncServerData* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.service_info_.InternalSwap(&other->_impl_.service_info_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.server_name_, lhs_arena,
+      &other->_impl_.server_name_, rhs_arena
+  );
+  swap(_impl_.full_sync_, other->_impl_.full_sync_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PBSyncServerData::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_NetMsgBus_2ePBParam_2eproto_getter, &descriptor_table_NetMsgBus_2ePBParam_2eproto_once,
+      file_level_metadata_NetMsgBus_2ePBParam_2eproto[6]);
+}
+
+// ===================================================================
+
+class PBSubscribeServicesReq::_Internal {
+ public:
+  using HasBits = decltype(std::declval<PBSubscribeServicesReq>()._impl_._has_bits_);
+  static void set_has_match_prefix(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_unsubscribe(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+PBSubscribeServicesReq::PBSubscribeServicesReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:NetMsgBus.PBSubscribeServicesReq)
+}
+PBSubscribeServicesReq::PBSubscribeServicesReq(const PBSubscribeServicesReq& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PBSubscribeServicesReq* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.match_prefix_){}
+    , decltype(_impl_.unsubscribe_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.match_prefix_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.match_prefix_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_match_prefix()) {
+    _this->_impl_.match_prefix_.Set(from._internal_match_prefix(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.unsubscribe_ = from._impl_.unsubscribe_;
+  // @@protoc_insertion_point(copy_constructor:NetMsgBus.PBSubscribeServicesReq)
+}
+
+inline void PBSubscribeServicesReq::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.match_prefix_){}
+    , decltype(_impl_.unsubscribe_){false}
+  };
+  _impl_.match_prefix_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.match_prefix_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+PBSubscribeServicesReq::~PBSubscribeServicesReq() {
+  // @@protoc_insertion_point(destructor:NetMsgBus.PBSubscribeServicesReq)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PBSubscribeServicesReq::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.match_prefix_.Destroy();
+}
+
+void PBSubscribeServicesReq::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PBSubscribeServicesReq::Clear() {
+// @@protoc_insertion_point(message_clear_start:NetMsgBus.PBSubscribeServicesReq)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.match_prefix_.ClearNonDefaultToEmpty();
+  }
+  _impl_.unsubscribe_ = false;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PBSubscribeServicesReq::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string match_prefix = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_match_prefix();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "NetMsgBus.PBSubscribeServicesReq.match_prefix");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool unsubscribe = 2 [default = false];
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_unsubscribe(&has_bits);
+          _impl_.unsubscribe_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PBSubscribeServicesReq::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:NetMsgBus.PBSubscribeServicesReq)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string match_prefix = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_match_prefix().data(), static_cast<int>(this->_internal_match_prefix().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "NetMsgBus.PBSubscribeServicesReq.match_prefix");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_match_prefix(), target);
+  }
+
+  // optional bool unsubscribe = 2 [default = false];
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_unsubscribe(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:NetMsgBus.PBSubscribeServicesReq)
+  return target;
+}
+
+size_t PBSubscribeServicesReq::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:NetMsgBus.PBSubscribeServicesReq)
+  size_t total_size = 0;
+
+  // required string match_prefix = 1;
+  if (_internal_has_match_prefix()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_match_prefix());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional bool unsubscribe = 2 [default = false];
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000002u) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PBSubscribeServicesReq::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PBSubscribeServicesReq::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PBSubscribeServicesReq::GetClassData() const { return &_class_data_; }
+
+
+void PBSubscribeServicesReq::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PBSubscribeServicesReq*>(&to_msg);
+  auto& from = static_cast<const PBSubscribeServicesReq&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:NetMsgBus.PBSubscribeServicesReq)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_match_prefix(from._internal_match_prefix());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.unsubscribe_ = from._impl_.unsubscribe_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PBSubscribeServicesReq::CopyFrom(const PBSubscribeServicesReq& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:NetMsgBus.PBSubscribeServicesReq)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PBSubscribeServicesReq::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void PBSubscribeServicesReq::InternalSwap(PBSubscribeServicesReq* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.match_prefix_, lhs_arena,
+      &other->_impl_.match_prefix_, rhs_arena
+  );
+  swap(_impl_.unsubscribe_, other->_impl_.unsubscribe_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PBSubscribeServicesReq::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_NetMsgBus_2ePBParam_2eproto_getter, &descriptor_table_NetMsgBus_2ePBParam_2eproto_once,
+      file_level_metadata_NetMsgBus_2ePBParam_2eproto[7]);
+}
+
+// ===================================================================
+
+class PBServiceChangeNotify::_Internal {
+ public:
+};
+
+PBServiceChangeNotify::PBServiceChangeNotify(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:NetMsgBus.PBServiceChangeNotify)
+}
+PBServiceChangeNotify::PBServiceChangeNotify(const PBServiceChangeNotify& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PBServiceChangeNotify* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.service_info_){from._impl_.service_info_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:NetMsgBus.PBServiceChangeNotify)
+}
+
+inline void PBServiceChangeNotify::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.service_info_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+PBServiceChangeNotify::~PBServiceChangeNotify() {
+  // @@protoc_insertion_point(destructor:NetMsgBus.PBServiceChangeNotify)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PBServiceChangeNotify::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.service_info_.~RepeatedPtrField();
+}
+
+void PBServiceChangeNotify::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PBServiceChangeNotify::Clear() {
+// @@protoc_insertion_point(message_clear_start:NetMsgBus.PBServiceChangeNotify)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.service_info_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PBServiceChangeNotify::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .NetMsgBus.PBServiceClients service_info = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_service_info(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PBServiceChangeNotify::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:NetMsgBus.PBServiceChangeNotify)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .NetMsgBus.PBServiceClients service_info = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_service_info_size()); i < n; i++) {
+    const auto& repfield = this->_internal_service_info(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:NetMsgBus.PBServiceChangeNotify)
+  return target;
+}
+
+size_t PBServiceChangeNotify::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:NetMsgBus.PBServiceChangeNotify)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .NetMsgBus.PBServiceClients service_info = 1;
+  total_size += 1UL * this->_internal_service_info_size();
+  for (const auto& msg : this->_impl_.service_info_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PBServiceChangeNotify::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PBServiceChangeNotify::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PBServiceChangeNotify::GetClassData() const { return &_class_data_; }
+
+
+void PBServiceChangeNotify::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PBServiceChangeNotify*>(&to_msg);
+  auto& from = static_cast<const PBServiceChangeNotify&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:NetMsgBus.PBServiceChangeNotify)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.service_info_.MergeFrom(from._impl_.service_info_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PBServiceChangeNotify::CopyFrom(const PBServiceChangeNotify& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:NetMsgBus.PBServiceChangeNotify)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PBServiceChangeNotify::IsInitialized() const {
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.service_info_))
+    return false;
+  return true;
+}
+
+void PBServiceChangeNotify::InternalSwap(PBServiceChangeNotify* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.service_info_.InternalSwap(&other->_impl_.service_info_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PBServiceChangeNotify::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_NetMsgBus_2ePBParam_2eproto_getter, &descriptor_table_NetMsgBus_2ePBParam_2eproto_once,
+      file_level_metadata_NetMsgBus_2ePBParam_2eproto[8]);
+}
+
+// ===================================================================
+
+class PBAdvertiseMessagesReq::_Internal {
+ public:
+};
+
+PBAdvertiseMessagesReq::PBAdvertiseMessagesReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:NetMsgBus.PBAdvertiseMessagesReq)
+}
+PBAdvertiseMessagesReq::PBAdvertiseMessagesReq(const PBAdvertiseMessagesReq& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PBAdvertiseMessagesReq* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.message_name_){from._impl_.message_name_}
+    , decltype(_impl_.message_prefix_){from._impl_.message_prefix_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:NetMsgBus.PBAdvertiseMessagesReq)
+}
+
+inline void PBAdvertiseMessagesReq::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.message_name_){arena}
+    , decltype(_impl_.message_prefix_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+PBAdvertiseMessagesReq::~PBAdvertiseMessagesReq() {
+  // @@protoc_insertion_point(destructor:NetMsgBus.PBAdvertiseMessagesReq)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PBAdvertiseMessagesReq::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.message_name_.~RepeatedPtrField();
+  _impl_.message_prefix_.~RepeatedPtrField();
+}
+
+void PBAdvertiseMessagesReq::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PBAdvertiseMessagesReq::Clear() {
+// @@protoc_insertion_point(message_clear_start:NetMsgBus.PBAdvertiseMessagesReq)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.message_name_.Clear();
+  _impl_.message_prefix_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PBAdvertiseMessagesReq::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated string message_name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_message_name();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            #ifndef NDEBUG
+            ::_pbi::VerifyUTF8(str, "NetMsgBus.PBAdvertiseMessagesReq.message_name");
+            #endif  // !NDEBUG
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string message_prefix = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_message_prefix();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            #ifndef NDEBUG
+            ::_pbi::VerifyUTF8(str, "NetMsgBus.PBAdvertiseMessagesReq.message_prefix");
+            #endif  // !NDEBUG
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PBAdvertiseMessagesReq::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:NetMsgBus.PBAdvertiseMessagesReq)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated string message_name = 1;
+  for (int i = 0, n = this->_internal_message_name_size(); i < n; i++) {
+    const auto& s = this->_internal_message_name(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "NetMsgBus.PBAdvertiseMessagesReq.message_name");
+    target = stream->WriteString(1, s, target);
+  }
+
+  // repeated string message_prefix = 2;
+  for (int i = 0, n = this->_internal_message_prefix_size(); i < n; i++) {
+    const auto& s = this->_internal_message_prefix(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "NetMsgBus.PBAdvertiseMessagesReq.message_prefix");
+    target = stream->WriteString(2, s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:NetMsgBus.PBAdvertiseMessagesReq)
+  return target;
+}
+
+size_t PBAdvertiseMessagesReq::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:NetMsgBus.PBAdvertiseMessagesReq)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated string message_name = 1;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.message_name_.size());
+  for (int i = 0, n = _impl_.message_name_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.message_name_.Get(i));
+  }
+
+  // repeated string message_prefix = 2;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.message_prefix_.size());
+  for (int i = 0, n = _impl_.message_prefix_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.message_prefix_.Get(i));
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PBAdvertiseMessagesReq::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PBAdvertiseMessagesReq::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PBAdvertiseMessagesReq::GetClassData() const { return &_class_data_; }
+
+
+void PBAdvertiseMessagesReq::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PBAdvertiseMessagesReq*>(&to_msg);
+  auto& from = static_cast<const PBAdvertiseMessagesReq&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:NetMsgBus.PBAdvertiseMessagesReq)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.message_name_.MergeFrom(from._impl_.message_name_);
+  _this->_impl_.message_prefix_.MergeFrom(from._impl_.message_prefix_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PBAdvertiseMessagesReq::CopyFrom(const PBAdvertiseMessagesReq& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:NetMsgBus.PBAdvertiseMessagesReq)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PBAdvertiseMessagesReq::IsInitialized() const {
+  return true;
+}
+
+void PBAdvertiseMessagesReq::InternalSwap(PBAdvertiseMessagesReq* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.message_name_.InternalSwap(&other->_impl_.message_name_);
+  _impl_.message_prefix_.InternalSwap(&other->_impl_.message_prefix_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PBAdvertiseMessagesReq::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_NetMsgBus_2ePBParam_2eproto_getter, &descriptor_table_NetMsgBus_2ePBParam_2eproto_once,
+      file_level_metadata_NetMsgBus_2ePBParam_2eproto[9]);
+}
+
+// ===================================================================
+
+class PBGetClientsReq::_Internal {
+ public:
+};
+
+PBGetClientsReq::PBGetClientsReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:NetMsgBus.PBGetClientsReq)
+}
+PBGetClientsReq::PBGetClientsReq(const PBGetClientsReq& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PBGetClientsReq* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.service_name_){from._impl_.service_name_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:NetMsgBus.PBGetClientsReq)
+}
+
+inline void PBGetClientsReq::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.service_name_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+PBGetClientsReq::~PBGetClientsReq() {
+  // @@protoc_insertion_point(destructor:NetMsgBus.PBGetClientsReq)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PBGetClientsReq::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.service_name_.~RepeatedPtrField();
+}
+
+void PBGetClientsReq::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PBGetClientsReq::Clear() {
+// @@protoc_insertion_point(message_clear_start:NetMsgBus.PBGetClientsReq)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.service_name_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PBGetClientsReq::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated string service_name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_service_name();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            #ifndef NDEBUG
+            ::_pbi::VerifyUTF8(str, "NetMsgBus.PBGetClientsReq.service_name");
+            #endif  // !NDEBUG
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PBGetClientsReq::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:NetMsgBus.PBGetClientsReq)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated string service_name = 1;
+  for (int i = 0, n = this->_internal_service_name_size(); i < n; i++) {
+    const auto& s = this->_internal_service_name(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "NetMsgBus.PBGetClientsReq.service_name");
+    target = stream->WriteString(1, s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:NetMsgBus.PBGetClientsReq)
+  return target;
+}
+
+size_t PBGetClientsReq::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:NetMsgBus.PBGetClientsReq)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated string service_name = 1;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.service_name_.size());
+  for (int i = 0, n = _impl_.service_name_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.service_name_.Get(i));
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PBGetClientsReq::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PBGetClientsReq::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PBGetClientsReq::GetClassData() const { return &_class_data_; }
+
+
+void PBGetClientsReq::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PBGetClientsReq*>(&to_msg);
+  auto& from = static_cast<const PBGetClientsReq&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:NetMsgBus.PBGetClientsReq)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.service_name_.MergeFrom(from._impl_.service_name_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PBGetClientsReq::CopyFrom(const PBGetClientsReq& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:NetMsgBus.PBGetClientsReq)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PBGetClientsReq::IsInitialized() const {
+  return true;
+}
+
+void PBGetClientsReq::InternalSwap(PBGetClientsReq* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.service_name_.InternalSwap(&other->_impl_.service_name_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PBGetClientsReq::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_NetMsgBus_2ePBParam_2eproto_getter, &descriptor_table_NetMsgBus_2ePBParam_2eproto_once,
+      file_level_metadata_NetMsgBus_2ePBParam_2eproto[10]);
+}
+
+// ===================================================================
+
+class PBRegisterServicesReq::_Internal {
+ public:
+  using HasBits = decltype(std::declval<PBRegisterServicesReq>()._impl_._has_bits_);
+  static const ::NetMsgBus::PBClientInfo& client_info(const PBRegisterServicesReq* msg);
+  static void set_has_client_info(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+const ::NetMsgBus::PBClientInfo&
+PBRegisterServicesReq::_Internal::client_info(const PBRegisterServicesReq* msg) {
+  return *msg->_impl_.client_info_;
+}
+PBRegisterServicesReq::PBRegisterServicesReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:NetMsgBus.PBRegisterServicesReq)
+}
+PBRegisterServicesReq::PBRegisterServicesReq(const PBRegisterServicesReq& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PBRegisterServicesReq* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.service_name_){from._impl_.service_name_}
+    , decltype(_impl_.client_info_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_client_info()) {
+    _this->_impl_.client_info_ = new ::NetMsgBus::PBClientInfo(*from._impl_.client_info_);
+  }
+  // @@protoc_insertion_point(copy_constructor:NetMsgBus.PBRegisterServicesReq)
+}
+
+inline void PBRegisterServicesReq::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.service_name_){arena}
+    , decltype(_impl_.client_info_){nullptr}
+  };
+}
+
+PBRegisterServicesReq::~PBRegisterServicesReq() {
+  // @@protoc_insertion_point(destructor:NetMsgBus.PBRegisterServicesReq)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PBRegisterServicesReq::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.service_name_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.client_info_;
+}
+
+void PBRegisterServicesReq::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PBRegisterServicesReq::Clear() {
+// @@protoc_insertion_point(message_clear_start:NetMsgBus.PBRegisterServicesReq)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.service_name_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.client_info_ != nullptr);
+    _impl_.client_info_->Clear();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PBRegisterServicesReq::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated string service_name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_service_name();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            #ifndef NDEBUG
+            ::_pbi::VerifyUTF8(str, "NetMsgBus.PBRegisterServicesReq.service_name");
+            #endif  // !NDEBUG
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // required .NetMsgBus.PBClientInfo client_info = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_client_info(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PBRegisterServicesReq::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:NetMsgBus.PBRegisterServicesReq)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated string service_name = 1;
+  for (int i = 0, n = this->_internal_service_name_size(); i < n; i++) {
+    const auto& s = this->_internal_service_name(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "NetMsgBus.PBRegisterServicesReq.service_name");
+    target = stream->WriteString(1, s, target);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .NetMsgBus.PBClientInfo client_info = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::client_info(this),
+        _Internal::client_info(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:NetMsgBus.PBRegisterServicesReq)
+  return target;
+}
+
+size_t PBRegisterServicesReq::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:NetMsgBus.PBRegisterServicesReq)
+  size_t total_size = 0;
+
+  // required .NetMsgBus.PBClientInfo client_info = 2;
+  if (_internal_has_client_info()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.client_info_);
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated string service_name = 1;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.service_name_.size());
+  for (int i = 0, n = _impl_.service_name_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.service_name_.Get(i));
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PBRegisterServicesReq::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PBRegisterServicesReq::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PBRegisterServicesReq::GetClassData() const { return &_class_data_; }
+
+
+void PBRegisterServicesReq::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PBRegisterServicesReq*>(&to_msg);
+  auto& from = static_cast<const PBRegisterServicesReq&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:NetMsgBus.PBRegisterServicesReq)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.service_name_.MergeFrom(from._impl_.service_name_);
+  if (from._internal_has_client_info()) {
+    _this->_internal_mutable_client_info()->::NetMsgBus::PBClientInfo::MergeFrom(
+        from._internal_client_info());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PBRegisterServicesReq::CopyFrom(const PBRegisterServicesReq& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:NetMsgBus.PBRegisterServicesReq)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PBRegisterServicesReq::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_client_info()) {
+    if (!_impl_.client_info_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void PBRegisterServicesReq::InternalSwap(PBRegisterServicesReq* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.service_name_.InternalSwap(&other->_impl_.service_name_);
+  swap(_impl_.client_info_, other->_impl_.client_info_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PBRegisterServicesReq::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_NetMsgBus_2ePBParam_2eproto_getter, &descriptor_table_NetMsgBus_2ePBParam_2eproto_once,
+      file_level_metadata_NetMsgBus_2ePBParam_2eproto[11]);
+}
+
+// ===================================================================
+
+class PBRegisterServicesRsp::_Internal {
+ public:
+};
+
+PBRegisterServicesRsp::PBRegisterServicesRsp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:NetMsgBus.PBRegisterServicesRsp)
+}
+PBRegisterServicesRsp::PBRegisterServicesRsp(const PBRegisterServicesRsp& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PBRegisterServicesRsp* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.failed_service_name_){from._impl_.failed_service_name_}
+    , decltype(_impl_.err_msg_){from._impl_.err_msg_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:NetMsgBus.PBRegisterServicesRsp)
+}
+
+inline void PBRegisterServicesRsp::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.failed_service_name_){arena}
+    , decltype(_impl_.err_msg_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+PBRegisterServicesRsp::~PBRegisterServicesRsp() {
+  // @@protoc_insertion_point(destructor:NetMsgBus.PBRegisterServicesRsp)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PBRegisterServicesRsp::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.failed_service_name_.~RepeatedPtrField();
+  _impl_.err_msg_.~RepeatedPtrField();
+}
+
+void PBRegisterServicesRsp::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PBRegisterServicesRsp::Clear() {
+// @@protoc_insertion_point(message_clear_start:NetMsgBus.PBRegisterServicesRsp)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.failed_service_name_.Clear();
+  _impl_.err_msg_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PBRegisterServicesRsp::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated string failed_service_name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_failed_service_name();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            #ifndef NDEBUG
+            ::_pbi::VerifyUTF8(str, "NetMsgBus.PBRegisterServicesRsp.failed_service_name");
+            #endif  // !NDEBUG
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string err_msg = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_err_msg();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            #ifndef NDEBUG
+            ::_pbi::VerifyUTF8(str, "NetMsgBus.PBRegisterServicesRsp.err_msg");
+            #endif  // !NDEBUG
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PBRegisterServicesRsp::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:NetMsgBus.PBRegisterServicesRsp)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated string failed_service_name = 1;
+  for (int i = 0, n = this->_internal_failed_service_name_size(); i < n; i++) {
+    const auto& s = this->_internal_failed_service_name(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "NetMsgBus.PBRegisterServicesRsp.failed_service_name");
+    target = stream->WriteString(1, s, target);
+  }
+
+  // repeated string err_msg = 2;
+  for (int i = 0, n = this->_internal_err_msg_size(); i < n; i++) {
+    const auto& s = this->_internal_err_msg(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "NetMsgBus.PBRegisterServicesRsp.err_msg");
+    target = stream->WriteString(2, s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:NetMsgBus.PBRegisterServicesRsp)
+  return target;
+}
+
+size_t PBRegisterServicesRsp::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:NetMsgBus.PBRegisterServicesRsp)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated string failed_service_name = 1;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.failed_service_name_.size());
+  for (int i = 0, n = _impl_.failed_service_name_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.failed_service_name_.Get(i));
+  }
+
+  // repeated string err_msg = 2;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.err_msg_.size());
+  for (int i = 0, n = _impl_.err_msg_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.err_msg_.Get(i));
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PBRegisterServicesRsp::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PBRegisterServicesRsp::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PBRegisterServicesRsp::GetClassData() const { return &_class_data_; }
+
+
+void PBRegisterServicesRsp::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PBRegisterServicesRsp*>(&to_msg);
+  auto& from = static_cast<const PBRegisterServicesRsp&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:NetMsgBus.PBRegisterServicesRsp)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.failed_service_name_.MergeFrom(from._impl_.failed_service_name_);
+  _this->_impl_.err_msg_.MergeFrom(from._impl_.err_msg_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PBRegisterServicesRsp::CopyFrom(const PBRegisterServicesRsp& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:NetMsgBus.PBRegisterServicesRsp)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PBRegisterServicesRsp::IsInitialized() const {
+  return true;
+}
+
+void PBRegisterServicesRsp::InternalSwap(PBRegisterServicesRsp* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.failed_service_name_.InternalSwap(&other->_impl_.failed_service_name_);
+  _impl_.err_msg_.InternalSwap(&other->_impl_.err_msg_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PBRegisterServicesRsp::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_NetMsgBus_2ePBParam_2eproto_getter, &descriptor_table_NetMsgBus_2ePBParam_2eproto_once,
+      file_level_metadata_NetMsgBus_2ePBParam_2eproto[12]);
+}
+
+// ===================================================================
+
+class PBDisconnectNotify::_Internal {
+ public:
+  using HasBits = decltype(std::declval<PBDisconnectNotify>()._impl_._has_bits_);
+  static void set_has_reason_code(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+PBDisconnectNotify::PBDisconnectNotify(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:NetMsgBus.PBDisconnectNotify)
+}
+PBDisconnectNotify::PBDisconnectNotify(const PBDisconnectNotify& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PBDisconnectNotify* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.reason_code_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.reason_code_ = from._impl_.reason_code_;
+  // @@protoc_insertion_point(copy_constructor:NetMsgBus.PBDisconnectNotify)
+}
+
+inline void PBDisconnectNotify::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.reason_code_){0}
+  };
+}
+
+PBDisconnectNotify::~PBDisconnectNotify() {
+  // @@protoc_insertion_point(destructor:NetMsgBus.PBDisconnectNotify)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PBDisconnectNotify::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void PBDisconnectNotify::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PBDisconnectNotify::Clear() {
+// @@protoc_insertion_point(message_clear_start:NetMsgBus.PBDisconnectNotify)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.reason_code_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PBDisconnectNotify::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required int32 reason_code = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_reason_code(&has_bits);
+          _impl_.reason_code_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PBDisconnectNotify::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:NetMsgBus.PBDisconnectNotify)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required int32 reason_code = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_reason_code(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:NetMsgBus.PBDisconnectNotify)
+  return target;
+}
+
+size_t PBDisconnectNotify::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:NetMsgBus.PBDisconnectNotify)
+  size_t total_size = 0;
+
+  // required int32 reason_code = 1;
+  if (_internal_has_reason_code()) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_reason_code());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PBDisconnectNotify::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PBDisconnectNotify::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PBDisconnectNotify::GetClassData() const { return &_class_data_; }
+
+
+void PBDisconnectNotify::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PBDisconnectNotify*>(&to_msg);
+  auto& from = static_cast<const PBDisconnectNotify&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:NetMsgBus.PBDisconnectNotify)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_reason_code()) {
+    _this->_internal_set_reason_code(from._internal_reason_code());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PBDisconnectNotify::CopyFrom(const PBDisconnectNotify& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:NetMsgBus.PBDisconnectNotify)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PBDisconnectNotify::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void PBDisconnectNotify::InternalSwap(PBDisconnectNotify* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.reason_code_, other->_impl_.reason_code_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PBDisconnectNotify::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_NetMsgBus_2ePBParam_2eproto_getter, &descriptor_table_NetMsgBus_2ePBParam_2eproto_once,
+      file_level_metadata_NetMsgBus_2ePBParam_2eproto[13]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace NetMsgBus
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::NetMsgBus::PBQueryServicesReq*
+Arena::CreateMaybeMessage< ::NetMsgBus::PBQueryServicesReq >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::NetMsgBus::PBQueryServicesReq >(arena);
+}
+template<> PROTOBUF_NOINLINE ::NetMsgBus::PBQueryServicesRsp*
+Arena::CreateMaybeMessage< ::NetMsgBus::PBQueryServicesRsp >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::NetMsgBus::PBQueryServicesRsp >(arena);
+}
+template<> PROTOBUF_NOINLINE ::NetMsgBus::PBQueryMessagesReq*
+Arena::CreateMaybeMessage< ::NetMsgBus::PBQueryMessagesReq >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::NetMsgBus::PBQueryMessagesReq >(arena);
+}
+template<> PROTOBUF_NOINLINE ::NetMsgBus::PBQueryMessagesRsp*
+Arena::CreateMaybeMessage< ::NetMsgBus::PBQueryMessagesRsp >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::NetMsgBus::PBQueryMessagesRsp >(arena);
+}
+template<> PROTOBUF_NOINLINE ::NetMsgBus::PBClientInfo*
+Arena::CreateMaybeMessage< ::NetMsgBus::PBClientInfo >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::NetMsgBus::PBClientInfo >(arena);
+}
+template<> PROTOBUF_NOINLINE ::NetMsgBus::PBServiceClients*
+Arena::CreateMaybeMessage< ::NetMsgBus::PBServiceClients >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::NetMsgBus::PBServiceClients >(arena);
+}
+template<> PROTOBUF_NOINLINE ::NetMsgBus::PBSyncServerData*
+Arena::CreateMaybeMessage< ::NetMsgBus::PBSyncServerData >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::NetMsgBus::PBSyncServerData >(arena);
+}
+template<> PROTOBUF_NOINLINE ::NetMsgBus::PBSubscribeServicesReq*
+Arena::CreateMaybeMessage< ::NetMsgBus::PBSubscribeServicesReq >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::NetMsgBus::PBSubscribeServicesReq >(arena);
+}
+template<> PROTOBUF_NOINLINE ::NetMsgBus::PBServiceChangeNotify*
+Arena::CreateMaybeMessage< ::NetMsgBus::PBServiceChangeNotify >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::NetMsgBus::PBServiceChangeNotify >(arena);
+}
+template<> PROTOBUF_NOINLINE ::NetMsgBus::PBAdvertiseMessagesReq*
+Arena::CreateMaybeMessage< ::NetMsgBus::PBAdvertiseMessagesReq >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::NetMsgBus::PBAdvertiseMessagesReq >(arena);
+}
+template<> PROTOBUF_NOINLINE ::NetMsgBus::PBGetClientsReq*
+Arena::CreateMaybeMessage< ::NetMsgBus::PBGetClientsReq >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::NetMsgBus::PBGetClientsReq >(arena);
+}
+template<> PROTOBUF_NOINLINE ::NetMsgBus::PBRegisterServicesReq*
+Arena::CreateMaybeMessage< ::NetMsgBus::PBRegisterServicesReq >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::NetMsgBus::PBRegisterServicesReq >(arena);
+}
+template<> PROTOBUF_NOINLINE ::NetMsgBus::PBRegisterServicesRsp*
+Arena::CreateMaybeMessage< ::NetMsgBus::PBRegisterServicesRsp >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::NetMsgBus::PBRegisterServicesRsp >(arena);
+}
+template<> PROTOBUF_NOINLINE ::NetMsgBus::PBDisconnectNotify*
+Arena::CreateMaybeMessage< ::NetMsgBus::PBDisconnectNotify >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::NetMsgBus::PBDisconnectNotify >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -0,0 +1,4212 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: NetMsgBus.PBParam.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_NetMsgBus_2ePBParam_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_NetMsgBus_2ePBParam_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_NetMsgBus_2ePBParam_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_NetMsgBus_2ePBParam_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_NetMsgBus_2ePBParam_2eproto;
+namespace NetMsgBus {
+class PBAdvertiseMessagesReq;
+struct PBAdvertiseMessagesReqDefaultTypeInternal;
+extern PBAdvertiseMessagesReqDefaultTypeInternal _PBAdvertiseMessagesReq_default_instance_;
+class PBClientInfo;
+struct PBClientInfoDefaultTypeInternal;
+extern PBClientInfoDefaultTypeInternal _PBClientInfo_default_instance_;
+class PBDisconnectNotify;
+struct PBDisconnectNotifyDefaultTypeInternal;
+extern PBDisconnectNotifyDefaultTypeInternal _PBDisconnectNotify_default_instance_;
+class PBGetClientsReq;
+struct PBGetClientsReqDefaultTypeInternal;
+extern PBGetClientsReqDefaultTypeInternal _PBGetClientsReq_default_instance_;
+class PBQueryMessagesReq;
+struct PBQueryMessagesReqDefaultTypeInternal;
+extern PBQueryMessagesReqDefaultTypeInternal _PBQueryMessagesReq_default_instance_;
+class PBQueryMessagesRsp;
+struct PBQueryMessagesRspDefaultTypeInternal;
+extern PBQueryMessagesRspDefaultTypeInternal _PBQueryMessagesRsp_default_instance_;
+class PBQueryServicesReq;
+struct PBQueryServicesReqDefaultTypeInternal;
+extern PBQueryServicesReqDefaultTypeInternal _PBQueryServicesReq_default_instance_;
+class PBQueryServicesRsp;
+struct PBQueryServicesRspDefaultTypeInternal;
+extern PBQueryServicesRspDefaultTypeInternal _PBQueryServicesRsp_default_instance_;
+class PBRegisterServicesReq;
+struct PBRegisterServicesReqDefaultTypeInternal;
+extern PBRegisterServicesReqDefaultTypeInternal _PBRegisterServicesReq_default_instance_;
+class PBRegisterServicesRsp;
+struct PBRegisterServicesRspDefaultTypeInternal;
+extern PBRegisterServicesRspDefaultTypeInternal _PBRegisterServicesRsp_default_instance_;
+class PBServiceChangeNotify;
+struct PBServiceChangeNotifyDefaultTypeInternal;
+extern PBServiceChangeNotifyDefaultTypeInternal _PBServiceChangeNotify_default_instance_;
+class PBServiceClients;
+struct PBServiceClientsDefaultTypeInternal;
+extern PBServiceClientsDefaultTypeInternal _PBServiceClients_default_instance_;
+class PBSubscribeServicesReq;
+struct PBSubscribeServicesReqDefaultTypeInternal;
+extern PBSubscribeServicesReqDefaultTypeInternal _PBSubscribeServicesReq_default_instance_;
+class PBSyncServerData;
+struct PBSyncServerDataDefaultTypeInternal;
+extern PBSyncServerDataDefaultTypeInternal _PBSyncServerData_default_instance_;
+}  // namespace NetMsgBus
+PROTOBUF_NAMESPACE_OPEN
+template<> ::NetMsgBus::PBAdvertiseMessagesReq* Arena::CreateMaybeMessage<::NetMsgBus::PBAdvertiseMessagesReq>(Arena*);
+template<> ::NetMsgBus::PBClientInfo* Arena::CreateMaybeMessage<::NetMsgBus::PBClientInfo>(Arena*);
+template<> ::NetMsgBus::PBDisconnectNotify* Arena::CreateMaybeMessage<::NetMsgBus::PBDisconnectNotify>(Arena*);
+template<> ::NetMsgBus::PBGetClientsReq* Arena::CreateMaybeMessage<::NetMsgBus::PBGetClientsReq>(Arena*);
+template<> ::NetMsgBus::PBQueryMessagesReq* Arena::CreateMaybeMessage<::NetMsgBus::PBQueryMessagesReq>(Arena*);
+template<> ::NetMsgBus::PBQueryMessagesRsp* Arena::CreateMaybeMessage<::NetMsgBus::PBQueryMessagesRsp>(Arena*);
+template<> ::NetMsgBus::PBQueryServicesReq* Arena::CreateMaybeMessage<::NetMsgBus::PBQueryServicesReq>(Arena*);
+template<> ::NetMsgBus::PBQueryServicesRsp* Arena::CreateMaybeMessage<::NetMsgBus::PBQueryServicesRsp>(Arena*);
+template<> ::NetMsgBus::PBRegisterServicesReq* Arena::CreateMaybeMessage<::NetMsgBus::PBRegisterServicesReq>(Arena*);
+template<> ::NetMsgBus::PBRegisterServicesRsp* Arena::CreateMaybeMessage<::NetMsgBus::PBRegisterServicesRsp>(Arena*);
+template<> ::NetMsgBus::PBServiceChangeNotify* Arena::CreateMaybeMessage<::NetMsgBus::PBServiceChangeNotify>(Arena*);
+template<> ::NetMsgBus::PBServiceClients* Arena::CreateMaybeMessage<::NetMsgBus::PBServiceClients>(Arena*);
+template<> ::NetMsgBus::PBSubscribeServicesReq* Arena::CreateMaybeMessage<::NetMsgBus::PBSubscribeServicesReq>(Arena*);
+template<> ::NetMsgBus::PBSyncServerData* Arena::CreateMaybeMessage<::NetMsgBus::PBSyncServerData>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace NetMsgBus {
+
+// ===================================================================
+
+class PBQueryServicesReq final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:NetMsgBus.PBQueryServicesReq) */ {
+ public:
+  inline PBQueryServicesReq() : PBQueryServicesReq(nullptr) {}
+  ~PBQueryServicesReq() override;
+  explicit PROTOBUF_CONSTEXPR PBQueryServicesReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PBQueryServicesReq(const PBQueryServicesReq& from);
+  PBQueryServicesReq(PBQueryServicesReq&& from) noexcept
+    : PBQueryServicesReq() {
+    *this = ::std::move(from);
+  }
+
+  inline PBQueryServicesReq& operator=(const PBQueryServicesReq& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PBQueryServicesReq& operator=(PBQueryServicesReq&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PBQueryServicesReq& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PBQueryServicesReq* internal_default_instance() {
+    return reinterpret_cast<const PBQueryServicesReq*>(
+               &_PBQueryServicesReq_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(PBQueryServicesReq& a, PBQueryServicesReq& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PBQueryServicesReq* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PBQueryServicesReq* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PBQueryServicesReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PBQueryServicesReq>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PBQueryServicesReq& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PBQueryServicesReq& from) {
+    PBQueryServicesReq::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PBQueryServicesReq* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "NetMsgBus.PBQueryServicesReq";
+  }
+  protected:
+  explicit PBQueryServicesReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMatchPrefixFieldNumber = 1,
+  };
+  // required string match_prefix = 1;
+  bool has_match_prefix() const;
+  private:
+  bool _internal_has_match_prefix() const;
+  public:
+  void clear_match_prefix();
+  const std::string& match_prefix() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_match_prefix(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_match_prefix();
+  PROTOBUF_NODISCARD std::string* release_match_prefix();
+  void set_allocated_match_prefix(std::string* match_prefix);
+  private:
+  const std::string& _internal_match_prefix() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_match_prefix(const std::string& value);
+  std::string* _internal_mutable_match_prefix();
+  public:
+
+  // @@protoc_insertion_point(class_scope:NetMsgBus.PBQueryServicesReq)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr match_prefix_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_NetMsgBus_2ePBParam_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PBQueryServicesRsp final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:NetMsgBus.PBQueryServicesRsp) */ {
+ public:
+  inline PBQueryServicesRsp() : PBQueryServicesRsp(nullptr) {}
+  ~PBQueryServicesRsp() override;
+  explicit PROTOBUF_CONSTEXPR PBQueryServicesRsp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PBQueryServicesRsp(const PBQueryServicesRsp& from);
+  PBQueryServicesRsp(PBQueryServicesRsp&& from) noexcept
+    : PBQueryServicesRsp() {
+    *this = ::std::move(from);
+  }
+
+  inline PBQueryServicesRsp& operator=(const PBQueryServicesRsp& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PBQueryServicesRsp& operator=(PBQueryServicesRsp&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PBQueryServicesRsp& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PBQueryServicesRsp* internal_default_instance() {
+    return reinterpret_cast<const PBQueryServicesRsp*>(
+               &_PBQueryServicesRsp_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(PBQueryServicesRsp& a, PBQueryServicesRsp& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PBQueryServicesRsp* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PBQueryServicesRsp* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PBQueryServicesRsp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PBQueryServicesRsp>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PBQueryServicesRsp& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PBQueryServicesRsp& from) {
+    PBQueryServicesRsp::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PBQueryServicesRsp* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "NetMsgBus.PBQueryServicesRsp";
+  }
+  protected:
+  explicit PBQueryServicesRsp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kServiceNameFieldNumber = 1,
+  };
+  // repeated string service_name = 1;
+  int service_name_size() const;
+  private:
+  int _internal_service_name_size() const;
+  public:
+  void clear_service_name();
+  const std::string& service_name(int index) const;
+  std::string* mutable_service_name(int index);
+  void set_service_name(int index, const std::string& value);
+  void set_service_name(int index, std::string&& value);
+  void set_service_name(int index, const char* value);
+  void set_service_name(int index, const char* value, size_t size);
+  std::string* add_service_name();
+  void add_service_name(const std::string& value);
+  void add_service_name(std::string&& value);
+  void add_service_name(const char* value);
+  void add_service_name(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& service_name() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_service_name();
+  private:
+  const std::string& _internal_service_name(int index) const;
+  std::string* _internal_add_service_name();
+  public:
+
+  // @@protoc_insertion_point(class_scope:NetMsgBus.PBQueryServicesRsp)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> service_name_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_NetMsgBus_2ePBParam_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PBQueryMessagesReq final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:NetMsgBus.PBQueryMessagesReq) */ {
+ public:
+  inline PBQueryMessagesReq() : PBQueryMessagesReq(nullptr) {}
+  ~PBQueryMessagesReq() override;
+  explicit PROTOBUF_CONSTEXPR PBQueryMessagesReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PBQueryMessagesReq(const PBQueryMessagesReq& from);
+  PBQueryMessagesReq(PBQueryMessagesReq&& from) noexcept
+    : PBQueryMessagesReq() {
+    *this = ::std::move(from);
+  }
+
+  inline PBQueryMessagesReq& operator=(const PBQueryMessagesReq& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PBQueryMessagesReq& operator=(PBQueryMessagesReq&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PBQueryMessagesReq& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PBQueryMessagesReq* internal_default_instance() {
+    return reinterpret_cast<const PBQueryMessagesReq*>(
+               &_PBQueryMessagesReq_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(PBQueryMessagesReq& a, PBQueryMessagesReq& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PBQueryMessagesReq* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PBQueryMessagesReq* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PBQueryMessagesReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PBQueryMessagesReq>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PBQueryMessagesReq& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PBQueryMessagesReq& from) {
+    PBQueryMessagesReq::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PBQueryMessagesReq* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "NetMsgBus.PBQueryMessagesReq";
+  }
+  protected:
+  explicit PBQueryMessagesReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kServiceNameFieldNumber = 1,
+    kMatchPrefixFieldNumber = 2,
+  };
+  // required string service_name = 1;
+  bool has_service_name() const;
+  private:
+  bool _internal_has_service_name() const;
+  public:
+  void clear_service_name();
+  const std::string& service_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_service_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_service_name();
+  PROTOBUF_NODISCARD std::string* release_service_name();
+  void set_allocated_service_name(std::string* service_name);
+  private:
+  const std::string& _internal_service_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_service_name(const std::string& value);
+  std::string* _internal_mutable_service_name();
+  public:
+
+  // required string match_prefix = 2;
+  bool has_match_prefix() const;
+  private:
+  bool _internal_has_match_prefix() const;
+  public:
+  void clear_match_prefix();
+  const std::string& match_prefix() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_match_prefix(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_match_prefix();
+  PROTOBUF_NODISCARD std::string* release_match_prefix();
+  void set_allocated_match_prefix(std::string* match_prefix);
+  private:
+  const std::string& _internal_match_prefix() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_match_prefix(const std::string& value);
+  std::string* _internal_mutable_match_prefix();
+  public:
+
+  // @@protoc_insertion_point(class_scope:NetMsgBus.PBQueryMessagesReq)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr service_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr match_prefix_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_NetMsgBus_2ePBParam_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PBQueryMessagesRsp final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:NetMsgBus.PBQueryMessagesRsp) */ {
+ public:
+  inline PBQueryMessagesRsp() : PBQueryMessagesRsp(nullptr) {}
+  ~PBQueryMessagesRsp() override;
+  explicit PROTOBUF_CONSTEXPR PBQueryMessagesRsp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PBQueryMessagesRsp(const PBQueryMessagesRsp& from);
+  PBQueryMessagesRsp(PBQueryMessagesRsp&& from) noexcept
+    : PBQueryMessagesRsp() {
+    *this = ::std::move(from);
+  }
+
+  inline PBQueryMessagesRsp& operator=(const PBQueryMessagesRsp& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PBQueryMessagesRsp& operator=(PBQueryMessagesRsp&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PBQueryMessagesRsp& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PBQueryMessagesRsp* internal_default_instance() {
+    return reinterpret_cast<const PBQueryMessagesRsp*>(
+               &_PBQueryMessagesRsp_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(PBQueryMessagesRsp& a, PBQueryMessagesRsp& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PBQueryMessagesRsp* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PBQueryMessagesRsp* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PBQueryMessagesRsp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PBQueryMessagesRsp>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PBQueryMessagesRsp& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PBQueryMessagesRsp& from) {
+    PBQueryMessagesRsp::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PBQueryMessagesRsp* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "NetMsgBus.PBQueryMessagesRsp";
+  }
+  protected:
+  explicit PBQueryMessagesRsp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMessageNameFieldNumber = 2,
+    kServiceNameFieldNumber = 1,
+  };
+  // repeated string message_name = 2;
+  int message_name_size() const;
+  private:
+  int _internal_message_name_size() const;
+  public:
+  void clear_message_name();
+  const std::string& message_name(int index) const;
+  std::string* mutable_message_name(int index);
+  void set_message_name(int index, const std::string& value);
+  void set_message_name(int index, std::string&& value);
+  void set_message_name(int index, const char* value);
+  void set_message_name(int index, const char* value, size_t size);
+  std::string* add_message_name();
+  void add_message_name(const std::string& value);
+  void add_message_name(std::string&& value);
+  void add_message_name(const char* value);
+  void add_message_name(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& message_name() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_message_name();
+  private:
+  const std::string& _internal_message_name(int index) const;
+  std::string* _internal_add_message_name();
+  public:
+
+  // required string service_name = 1;
+  bool has_service_name() const;
+  private:
+  bool _internal_has_service_name() const;
+  public:
+  void clear_service_name();
+  const std::string& service_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_service_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_service_name();
+  PROTOBUF_NODISCARD std::string* release_service_name();
+  void set_allocated_service_name(std::string* service_name);
+  private:
+  const std::string& _internal_service_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_service_name(const std::string& value);
+  std::string* _internal_mutable_service_name();
+  public:
+
+  // @@protoc_insertion_point(class_scope:NetMsgBus.PBQueryMessagesRsp)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> message_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr service_name_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_NetMsgBus_2ePBParam_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PBClientInfo final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:NetMsgBus.PBClientInfo) */ {
+ public:
+  inline PBClientInfo() : PBClientInfo(nullptr) {}
+  ~PBClientInfo() override;
+  explicit PROTOBUF_CONSTEXPR PBClientInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PBClientInfo(const PBClientInfo& from);
+  PBClientInfo(PBClientInfo&& from) noexcept
+    : PBClientInfo() {
+    *this = ::std::move(from);
+  }
+
+  inline PBClientInfo& operator=(const PBClientInfo& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PBClientInfo& operator=(PBClientInfo&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PBClientInfo& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PBClientInfo* internal_default_instance() {
+    return reinterpret_cast<const PBClientInfo*>(
+               &_PBClientInfo_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(PBClientInfo& a, PBClientInfo& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PBClientInfo* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PBClientInfo* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PBClientInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PBClientInfo>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PBClientInfo& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PBClientInfo& from) {
+    PBClientInfo::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PBClientInfo* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "NetMsgBus.PBClientInfo";
+  }
+  protected:
+  explicit PBClientInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kClientIpFieldNumber = 1,
+    kClientPortFieldNumber = 2,
+    kClientStateFieldNumber = 3,
+  };
+  // required uint32 client_ip = 1;
+  bool has_client_ip() const;
+  private:
+  bool _internal_has_client_ip() const;
+  public:
+  void clear_client_ip();
+  uint32_t client_ip() const;
+  void set_client_ip(uint32_t value);
+  private:
+  uint32_t _internal_client_ip() const;
+  void _internal_set_client_ip(uint32_t value);
+  public:
+
+  // required uint32 client_port = 2;
+  bool has_client_port() const;
+  private:
+  bool _internal_has_client_port() const;
+  public:
+  void clear_client_port();
+  uint32_t client_port() const;
+  void set_client_port(uint32_t value);
+  private:
+  uint32_t _internal_client_port() const;
+  void _internal_set_client_port(uint32_t value);
+  public:
+
+  // required sint32 client_state = 3;
+  bool has_client_state() const;
+  private:
+  bool _internal_has_client_state() const;
+  public:
+  void clear_client_state();
+  int32_t client_state() const;
+  void set_client_state(int32_t value);
+  private:
+  int32_t _internal_client_state() const;
+  void _internal_set_client_state(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:NetMsgBus.PBClientInfo)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t client_ip_;
+    uint32_t client_port_;
+    int32_t client_state_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_NetMsgBus_2ePBParam_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PBServiceClients final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:NetMsgBus.PBServiceClients) */ {
+ public:
+  inline PBServiceClients() : PBServiceClients(nullptr) {}
+  ~PBServiceClients() override;
+  explicit PROTOBUF_CONSTEXPR PBServiceClients(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PBServiceClients(const PBServiceClients& from);
+  PBServiceClients(PBServiceClients&& from) noexcept
+    : PBServiceClients() {
+    *this = ::std::move(from);
+  }
+
+  inline PBServiceClients& operator=(const PBServiceClients& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PBServiceClients& operator=(PBServiceClients&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PBServiceClients& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PBServiceClients* internal_default_instance() {
+    return reinterpret_cast<const PBServiceClients*>(
+               &_PBServiceClients_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(PBServiceClients& a, PBServiceClients& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PBServiceClients* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PBServiceClients* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PBServiceClients* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PBServiceClients>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PBServiceClients& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PBServiceClients& from) {
+    PBServiceClients::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PBServiceClients* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "NetMsgBus.PBServiceClients";
+  }
+  protected:
+  explicit PBServiceClients(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kClientInfoFieldNumber = 2,
+    kServiceNameFieldNumber = 1,
+  };
+  // repeated .NetMsgBus.PBClientInfo client_info = 2;
+  int client_info_size() const;
+  private:
+  int _internal_client_info_size() const;
+  public:
+  void clear_client_info();
+  ::NetMsgBus::PBClientInfo* mutable_client_info(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::NetMsgBus::PBClientInfo >*
+      mutable_client_info();
+  private:
+  const ::NetMsgBus::PBClientInfo& _internal_client_info(int index) const;
+  ::NetMsgBus::PBClientInfo* _internal_add_client_info();
+  public:
+  const ::NetMsgBus::PBClientInfo& client_info(int index) const;
+  ::NetMsgBus::PBClientInfo* add_client_info();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::NetMsgBus::PBClientInfo >&
+      client_info() const;
+
+  // required string service_name = 1;
+  bool has_service_name() const;
+  private:
+  bool _internal_has_service_name() const;
+  public:
+  void clear_service_name();
+  const std::string& service_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_service_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_service_name();
+  PROTOBUF_NODISCARD std::string* release_service_name();
+  void set_allocated_service_name(std::string* service_name);
+  private:
+  const std::string& _internal_service_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_service_name(const std::string& value);
+  std::string* _internal_mutable_service_name();
+  public:
+
+  // @@protoc_insertion_point(class_scope:NetMsgBus.PBServiceClients)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::NetMsgBus::PBClientInfo > client_info_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr service_name_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_NetMsgBus_2ePBParam_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PBSyncServerData final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:NetMsgBus.PBSyncServerData) */ {
+ public:
+  inline PBSyncServerData() : PBSyncServerData(nullptr) {}
+  ~PBSyncServerData() override;
+  explicit PROTOBUF_CONSTEXPR PBSyncServerData(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PBSyncServerData(const PBSyncServerData& from);
+  PBSyncServerData(PBSyncServerData&& from) noexcept
+    : PBSyncServerData() {
+    *this = ::std::move(from);
+  }
+
+  inline PBSyncServerData& operator=(const PBSyncServerData& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PBSyncServerData& operator=(PBSyncServerData&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PBSyncServerData& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PBSyncServerData* internal_default_instance() {
+    return reinterpret_cast<const PBSyncServerData*>(
+               &_PBSyncServerData_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(PBSyncServerData& a, PBSyncServerData& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PBSyncServerData* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PBSyncServerData* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PBSyncServerData* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PBSyncServerData>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PBSyncServerData& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PBSyncServerData& from) {
+    PBSyncServerData::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PBSyncServerData* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "NetMsgBus.PBSyncServerData";
+  }
+  protected:
+  explicit PBSyncServerData(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kServiceInfoFieldNumber = 2,
+    kServerNameFieldNumber = 1,
+    kFullSyncFieldNumber = 3,
+  };
+  // repeated .NetMsgBus.PBServiceClients service_info = 2;
+  int service_info_size() const;
+  private:
+  int _internal_service_info_size() const;
+  public:
+  void clear_service_info();
+  ::NetMsgBus::PBServiceClients* mutable_service_info(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::NetMsgBus::PBServiceClients >*
+      mutable_service_info();
+  private:
+  const ::NetMsgBus::PBServiceClients& _internal_service_info(int index) const;
+  ::NetMsgBus::PBServiceClients* _internal_add_service_info();
+  public:
+  const ::NetMsgBus::PBServiceClients& service_info(int index) const;
+  ::NetMsgBus::PBServiceClients* add_service_info();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::NetMsgBus::PBServiceClients >&
+      service_info() const;
+
+  // required string server_name = 1;
+  bool has_server_name() const;
+  private:
+  bool _internal_has_server_name() const;
+  public:
+  void clear_server_name();
+  const std::string& server_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_server_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_server_name();
+  PROTOBUF_NODISCARD std::string* release_server_name();
+  void set_allocated_server_name(std::string* server_name);
+  private:
+  const std::string& _internal_server_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_server_name(const std::string& value);
+  std::string* _internal_mutable_server_name();
+  public:
+
+  // optional bool full_sync = 3 [default = false];
+  bool has_full_sync() const;
+  private:
+  bool _internal_has_full_sync() const;
+  public:
+  void clear_full_sync();
+  bool full_sync() const;
+  void set_full_sync(bool value);
+  private:
+  bool _internal_full_sync() const;
+  void _internal_set_full_sync(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:NetMsgBus.PBSyncServerData)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::NetMsgBus::PBServiceClients > service_info_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr server_name_;
+    bool full_sync_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_NetMsgBus_2ePBParam_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PBSubscribeServicesReq final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:NetMsgBus.PBSubscribeServicesReq) */ {
+ public:
+  inline PBSubscribeServicesReq() : PBSubscribeServicesReq(nullptr) {}
+  ~PBSubscribeServicesReq() override;
+  explicit PROTOBUF_CONSTEXPR PBSubscribeServicesReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PBSubscribeServicesReq(const PBSubscribeServicesReq& from);
+  PBSubscribeServicesReq(PBSubscribeServicesReq&& from) noexcept
+    : PBSubscribeServicesReq() {
+    *this = ::std::move(from);
+  }
+
+  inline PBSubscribeServicesReq& operator=(const PBSubscribeServicesReq& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PBSubscribeServicesReq& operator=(PBSubscribeServicesReq&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PBSubscribeServicesReq& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PBSubscribeServicesReq* internal_default_instance() {
+    return reinterpret_cast<const PBSubscribeServicesReq*>(
+               &_PBSubscribeServicesReq_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(PBSubscribeServicesReq& a, PBSubscribeServicesReq& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PBSubscribeServicesReq* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PBSubscribeServicesReq* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PBSubscribeServicesReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PBSubscribeServicesReq>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PBSubscribeServicesReq& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PBSubscribeServicesReq& from) {
+    PBSubscribeServicesReq::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PBSubscribeServicesReq* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "NetMsgBus.PBSubscribeServicesReq";
+  }
+  protected:
+  explicit PBSubscribeServicesReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMatchPrefixFieldNumber = 1,
+    kUnsubscribeFieldNumber = 2,
+  };
+  // required string match_prefix = 1;
+  bool has_match_prefix() const;
+  private:
+  bool _internal_has_match_prefix() const;
+  public:
+  void clear_match_prefix();
+  const std::string& match_prefix() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_match_prefix(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_match_prefix();
+  PROTOBUF_NODISCARD std::string* release_match_prefix();
+  void set_allocated_match_prefix(std::string* match_prefix);
+  private:
+  const std::string& _internal_match_prefix() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_match_prefix(const std::string& value);
+  std::string* _internal_mutable_match_prefix();
+  public:
+
+  // optional bool unsubscribe = 2 [default = false];
+  bool has_unsubscribe() const;
+  private:
+  bool _internal_has_unsubscribe() const;
+  public:
+  void clear_unsubscribe();
+  bool unsubscribe() const;
+  void set_unsubscribe(bool value);
+  private:
+  bool _internal_unsubscribe() const;
+  void _internal_set_unsubscribe(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:NetMsgBus.PBSubscribeServicesReq)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr match_prefix_;
+    bool unsubscribe_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_NetMsgBus_2ePBParam_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PBServiceChangeNotify final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:NetMsgBus.PBServiceChangeNotify) */ {
+ public:
+  inline PBServiceChangeNotify() : PBServiceChangeNotify(nullptr) {}
+  ~PBServiceChangeNotify() override;
+  explicit PROTOBUF_CONSTEXPR PBServiceChangeNotify(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PBServiceChangeNotify(const PBServiceChangeNotify& from);
+  PBServiceChangeNotify(PBServiceChangeNotify&& from) noexcept
+    : PBServiceChangeNotify() {
+    *this = ::std::move(from);
+  }
+
+  inline PBServiceChangeNotify& operator=(const PBServiceChangeNotify& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PBServiceChangeNotify& operator=(PBServiceChangeNotify&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PBServiceChangeNotify& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PBServiceChangeNotify* internal_default_instance() {
+    return reinterpret_cast<const PBServiceChangeNotify*>(
+               &_PBServiceChangeNotify_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  friend void swap(PBServiceChangeNotify& a, PBServiceChangeNotify& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PBServiceChangeNotify* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PBServiceChangeNotify* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PBServiceChangeNotify* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PBServiceChangeNotify>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PBServiceChangeNotify& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PBServiceChangeNotify& from) {
+    PBServiceChangeNotify::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PBServiceChangeNotify* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "NetMsgBus.PBServiceChangeNotify";
+  }
+  protected:
+  explicit PBServiceChangeNotify(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kServiceInfoFieldNumber = 1,
+  };
+  // repeated .NetMsgBus.PBServiceClients service_info = 1;
+  int service_info_size() const;
+  private:
+  int _internal_service_info_size() const;
+  public:
+  void clear_service_info();
+  ::NetMsgBus::PBServiceClients* mutable_service_info(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::NetMsgBus::PBServiceClients >*
+      mutable_service_info();
+  private:
+  const ::NetMsgBus::PBServiceClients& _internal_service_info(int index) const;
+  ::NetMsgBus::PBServiceClients* _internal_add_service_info();
+  public:
+  const ::NetMsgBus::PBServiceClients& service_info(int index) const;
+  ::NetMsgBus::PBServiceClients* add_service_info();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::NetMsgBus::PBServiceClients >&
+      service_info() const;
+
+  // @@protoc_insertion_point(class_scope:NetMsgBus.PBServiceChangeNotify)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::NetMsgBus::PBServiceClients > service_info_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_NetMsgBus_2ePBParam_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PBAdvertiseMessagesReq final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:NetMsgBus.PBAdvertiseMessagesReq) */ {
+ public:
+  inline PBAdvertiseMessagesReq() : PBAdvertiseMessagesReq(nullptr) {}
+  ~PBAdvertiseMessagesReq() override;
+  explicit PROTOBUF_CONSTEXPR PBAdvertiseMessagesReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PBAdvertiseMessagesReq(const PBAdvertiseMessagesReq& from);
+  PBAdvertiseMessagesReq(PBAdvertiseMessagesReq&& from) noexcept
+    : PBAdvertiseMessagesReq() {
+    *this = ::std::move(from);
+  }
+
+  inline PBAdvertiseMessagesReq& operator=(const PBAdvertiseMessagesReq& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PBAdvertiseMessagesReq& operator=(PBAdvertiseMessagesReq&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PBAdvertiseMessagesReq& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PBAdvertiseMessagesReq* internal_default_instance() {
+    return reinterpret_cast<const PBAdvertiseMessagesReq*>(
+               &_PBAdvertiseMessagesReq_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
+
+  friend void swap(PBAdvertiseMessagesReq& a, PBAdvertiseMessagesReq& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PBAdvertiseMessagesReq* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PBAdvertiseMessagesReq* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PBAdvertiseMessagesReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PBAdvertiseMessagesReq>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PBAdvertiseMessagesReq& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PBAdvertiseMessagesReq& from) {
+    PBAdvertiseMessagesReq::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PBAdvertiseMessagesReq* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "NetMsgBus.PBAdvertiseMessagesReq";
+  }
+  protected:
+  explicit PBAdvertiseMessagesReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMessageNameFieldNumber = 1,
+    kMessagePrefixFieldNumber = 2,
+  };
+  // repeated string message_name = 1;
+  int message_name_size() const;
+  private:
+  int _internal_message_name_size() const;
+  public:
+  void clear_message_name();
+  const std::string& message_name(int index) const;
+  std::string* mutable_message_name(int index);
+  void set_message_name(int index, const std::string& value);
+  void set_message_name(int index, std::string&& value);
+  void set_message_name(int index, const char* value);
+  void set_message_name(int index, const char* value, size_t size);
+  std::string* add_message_name();
+  void add_message_name(const std::string& value);
+  void add_message_name(std::string&& value);
+  void add_message_name(const char* value);
+  void add_message_name(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& message_name() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_message_name();
+  private:
+  const std::string& _internal_message_name(int index) const;
+  std::string* _internal_add_message_name();
+  public:
+
+  // repeated string message_prefix = 2;
+  int message_prefix_size() const;
+  private:
+  int _internal_message_prefix_size() const;
+  public:
+  void clear_message_prefix();
+  const std::string& message_prefix(int index) const;
+  std::string* mutable_message_prefix(int index);
+  void set_message_prefix(int index, const std::string& value);
+  void set_message_prefix(int index, std::string&& value);
+  void set_message_prefix(int index, const char* value);
+  void set_message_prefix(int index, const char* value, size_t size);
+  std::string* add_message_prefix();
+  void add_message_prefix(const std::string& value);
+  void add_message_prefix(std::string&& value);
+  void add_message_prefix(const char* value);
+  void add_message_prefix(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& message_prefix() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_message_prefix();
+  private:
+  const std::string& _internal_message_prefix(int index) const;
+  std::string* _internal_add_message_prefix();
+  public:
+
+  // @@protoc_insertion_point(class_scope:NetMsgBus.PBAdvertiseMessagesReq)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> message_name_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> message_prefix_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_NetMsgBus_2ePBParam_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PBGetClientsReq final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:NetMsgBus.PBGetClientsReq) */ {
+ public:
+  inline PBGetClientsReq() : PBGetClientsReq(nullptr) {}
+  ~PBGetClientsReq() override;
+  explicit PROTOBUF_CONSTEXPR PBGetClientsReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PBGetClientsReq(const PBGetClientsReq& from);
+  PBGetClientsReq(PBGetClientsReq&& from) noexcept
+    : PBGetClientsReq() {
+    *this = ::std::move(from);
+  }
+
+  inline PBGetClientsReq& operator=(const PBGetClientsReq& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PBGetClientsReq& operator=(PBGetClientsReq&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PBGetClientsReq& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PBGetClientsReq* internal_default_instance() {
+    return reinterpret_cast<const PBGetClientsReq*>(
+               &_PBGetClientsReq_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
+
+  friend void swap(PBGetClientsReq& a, PBGetClientsReq& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PBGetClientsReq* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PBGetClientsReq* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PBGetClientsReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PBGetClientsReq>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PBGetClientsReq& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PBGetClientsReq& from) {
+    PBGetClientsReq::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PBGetClientsReq* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "NetMsgBus.PBGetClientsReq";
+  }
+  protected:
+  explicit PBGetClientsReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kServiceNameFieldNumber = 1,
+  };
+  // repeated string service_name = 1;
+  int service_name_size() const;
+  private:
+  int _internal_service_name_size() const;
+  public:
+  void clear_service_name();
+  const std::string& service_name(int index) const;
+  std::string* mutable_service_name(int index);
+  void set_service_name(int index, const std::string& value);
+  void set_service_name(int index, std::string&& value);
+  void set_service_name(int index, const char* value);
+  void set_service_name(int index, const char* value, size_t size);
+  std::string* add_service_name();
+  void add_service_name(const std::string& value);
+  void add_service_name(std::string&& value);
+  void add_service_name(const char* value);
+  void add_service_name(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& service_name() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_service_name();
+  private:
+  const std::string& _internal_service_name(int index) const;
+  std::string* _internal_add_service_name();
+  public:
+
+  // @@protoc_insertion_point(class_scope:NetMsgBus.PBGetClientsReq)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> service_name_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_NetMsgBus_2ePBParam_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PBRegisterServicesReq final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:NetMsgBus.PBRegisterServicesReq) */ {
+ public:
+  inline PBRegisterServicesReq() : PBRegisterServicesReq(nullptr) {}
+  ~PBRegisterServicesReq() override;
+  explicit PROTOBUF_CONSTEXPR PBRegisterServicesReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PBRegisterServicesReq(const PBRegisterServicesReq& from);
+  PBRegisterServicesReq(PBRegisterServicesReq&& from) noexcept
+    : PBRegisterServicesReq() {
+    *this = ::std::move(from);
+  }
+
+  inline PBRegisterServicesReq& operator=(const PBRegisterServicesReq& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PBRegisterServicesReq& operator=(PBRegisterServicesReq&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PBRegisterServicesReq& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PBRegisterServicesReq* internal_default_instance() {
+    return reinterpret_cast<const PBRegisterServicesReq*>(
+               &_PBRegisterServicesReq_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    11;
+
+  friend void swap(PBRegisterServicesReq& a, PBRegisterServicesReq& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PBRegisterServicesReq* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PBRegisterServicesReq* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PBRegisterServicesReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PBRegisterServicesReq>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PBRegisterServicesReq& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PBRegisterServicesReq& from) {
+    PBRegisterServicesReq::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PBRegisterServicesReq* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "NetMsgBus.PBRegisterServicesReq";
+  }
+  protected:
+  explicit PBRegisterServicesReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kServiceNameFieldNumber = 1,
+    kClientInfoFieldNumber = 2,
+  };
+  // repeated string service_name = 1;
+  int service_name_size() const;
+  private:
+  int _internal_service_name_size() const;
+  public:
+  void clear_service_name();
+  const std::string& service_name(int index) const;
+  std::string* mutable_service_name(int index);
+  void set_service_name(int index, const std::string& value);
+  void set_service_name(int index, std::string&& value);
+  void set_service_name(int index, const char* value);
+  void set_service_name(int index, const char* value, size_t size);
+  std::string* add_service_name();
+  void add_service_name(const std::string& value);
+  void add_service_name(std::string&& value);
+  void add_service_name(const char* value);
+  void add_service_name(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& service_name() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_service_name();
+  private:
+  const std::string& _internal_service_name(int index) const;
+  std::string* _internal_add_service_name();
+  public:
+
+  // required .NetMsgBus.PBClientInfo client_info = 2;
+  bool has_client_info() const;
+  private:
+  bool _internal_has_client_info() const;
+  public:
+  void clear_client_info();
+  const ::NetMsgBus::PBClientInfo& client_info() const;
+  PROTOBUF_NODISCARD ::NetMsgBus::PBClientInfo* release_client_info();
+  ::NetMsgBus::PBClientInfo* mutable_client_info();
+  void set_allocated_client_info(::NetMsgBus::PBClientInfo* client_info);
+  private:
+  const ::NetMsgBus::PBClientInfo& _internal_client_info() const;
+  ::NetMsgBus::PBClientInfo* _internal_mutable_client_info();
+  public:
+  void unsafe_arena_set_allocated_client_info(
+      ::NetMsgBus::PBClientInfo* client_info);
+  ::NetMsgBus::PBClientInfo* unsafe_arena_release_client_info();
+
+  // @@protoc_insertion_point(class_scope:NetMsgBus.PBRegisterServicesReq)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> service_name_;
+    ::NetMsgBus::PBClientInfo* client_info_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_NetMsgBus_2ePBParam_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PBRegisterServicesRsp final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:NetMsgBus.PBRegisterServicesRsp) */ {
+ public:
+  inline PBRegisterServicesRsp() : PBRegisterServicesRsp(nullptr) {}
+  ~PBRegisterServicesRsp() override;
+  explicit PROTOBUF_CONSTEXPR PBRegisterServicesRsp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PBRegisterServicesRsp(const PBRegisterServicesRsp& from);
+  PBRegisterServicesRsp(PBRegisterServicesRsp&& from) noexcept
+    : PBRegisterServicesRsp() {
+    *this = ::std::move(from);
+  }
+
+  inline PBRegisterServicesRsp& operator=(const PBRegisterServicesRsp& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PBRegisterServicesRsp& operator=(PBRegisterServicesRsp&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PBRegisterServicesRsp& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PBRegisterServicesRsp* internal_default_instance() {
+    return reinterpret_cast<const PBRegisterServicesRsp*>(
+               &_PBRegisterServicesRsp_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    12;
+
+  friend void swap(PBRegisterServicesRsp& a, PBRegisterServicesRsp& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PBRegisterServicesRsp* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PBRegisterServicesRsp* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PBRegisterServicesRsp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PBRegisterServicesRsp>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PBRegisterServicesRsp& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PBRegisterServicesRsp& from) {
+    PBRegisterServicesRsp::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PBRegisterServicesRsp* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "NetMsgBus.PBRegisterServicesRsp";
+  }
+  protected:
+  explicit PBRegisterServicesRsp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFailedServiceNameFieldNumber = 1,
+    kErrMsgFieldNumber = 2,
+  };
+  // repeated string failed_service_name = 1;
+  int failed_service_name_size() const;
+  private:
+  int _internal_failed_service_name_size() const;
+  public:
+  void clear_failed_service_name();
+  const std::string& failed_service_name(int index) const;
+  std::string* mutable_failed_service_name(int index);
+  void set_failed_service_name(int index, const std::string& value);
+  void set_failed_service_name(int index, std::string&& value);
+  void set_failed_service_name(int index, const char* value);
+  void set_failed_service_name(int index, const char* value, size_t size);
+  std::string* add_failed_service_name();
+  void add_failed_service_name(const std::string& value);
+  void add_failed_service_name(std::string&& value);
+  void add_failed_service_name(const char* value);
+  void add_failed_service_name(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& failed_service_name() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_failed_service_name();
+  private:
+  const std::string& _internal_failed_service_name(int index) const;
+  std::string* _internal_add_failed_service_name();
+  public:
+
+  // repeated string err_msg = 2;
+  int err_msg_size() const;
+  private:
+  int _internal_err_msg_size() const;
+  public:
+  void clear_err_msg();
+  const std::string& err_msg(int index) const;
+  std::string* mutable_err_msg(int index);
+  void set_err_msg(int index, const std::string& value);
+  void set_err_msg(int index, std::string&& value);
+  void set_err_msg(int index, const char* value);
+  void set_err_msg(int index, const char* value, size_t size);
+  std::string* add_err_msg();
+  void add_err_msg(const std::string& value);
+  void add_err_msg(std::string&& value);
+  void add_err_msg(const char* value);
+  void add_err_msg(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& err_msg() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_err_msg();
+  private:
+  const std::string& _internal_err_msg(int index) const;
+  std::string* _internal_add_err_msg();
+  public:
+
+  // @@protoc_insertion_point(class_scope:NetMsgBus.PBRegisterServicesRsp)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> failed_service_name_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> err_msg_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_NetMsgBus_2ePBParam_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PBDisconnectNotify final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:NetMsgBus.PBDisconnectNotify) */ {
+ public:
+  inline PBDisconnectNotify() : PBDisconnectNotify(nullptr) {}
+  ~PBDisconnectNotify() override;
+  explicit PROTOBUF_CONSTEXPR PBDisconnectNotify(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PBDisconnectNotify(const PBDisconnectNotify& from);
+  PBDisconnectNotify(PBDisconnectNotify&& from) noexcept
+    : PBDisconnectNotify() {
+    *this = ::std::move(from);
+  }
+
+  inline PBDisconnectNotify& operator=(const PBDisconnectNotify& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PBDisconnectNotify& operator=(PBDisconnectNotify&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PBDisconnectNotify& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PBDisconnectNotify* internal_default_instance() {
+    return reinterpret_cast<const PBDisconnectNotify*>(
+               &_PBDisconnectNotify_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    13;
+
+  friend void swap(PBDisconnectNotify& a, PBDisconnectNotify& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PBDisconnectNotify* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PBDisconnectNotify* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PBDisconnectNotify* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PBDisconnectNotify>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PBDisconnectNotify& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PBDisconnectNotify& from) {
+    PBDisconnectNotify::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PBDisconnectNotify* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "NetMsgBus.PBDisconnectNotify";
+  }
+  protected:
+  explicit PBDisconnectNotify(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kReasonCodeFieldNumber = 1,
+  };
+  // required int32 reason_code = 1;
+  bool has_reason_code() const;
+  private:
+  bool _internal_has_reason_code() const;
+  public:
+  void clear_reason_code();
+  int32_t reason_code() const;
+  void set_reason_code(int32_t value);
+  private:
+  int32_t _internal_reason_code() const;
+  void _internal_set_reason_code(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:NetMsgBus.PBDisconnectNotify)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int32_t reason_code_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_NetMsgBus_2ePBParam_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// PBQueryServicesReq
+
+// required string match_prefix = 1;
+inline bool PBQueryServicesReq::_internal_has_match_prefix() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool PBQueryServicesReq::has_match_prefix() const {
+  return _internal_has_match_prefix();
+}
+inline void PBQueryServicesReq::clear_match_prefix() {
+  _impl_.match_prefix_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& PBQueryServicesReq::match_prefix() const {
+  // @@protoc_insertion_point(field_get:NetMsgBus.PBQueryServicesReq.match_prefix)
+  return _internal_match_prefix();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PBQueryServicesReq::set_match_prefix(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.match_prefix_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:NetMsgBus.PBQueryServicesReq.match_prefix)
+}
+inline std::string* PBQueryServicesReq::mutable_match_prefix() {
+  std::string* _s = _internal_mutable_match_prefix();
+  // @@protoc_insertion_point(field_mutable:NetMsgBus.PBQueryServicesReq.match_prefix)
+  return _s;
+}
+inline const std::string& PBQueryServicesReq::_internal_match_prefix() const {
+  return _impl_.match_prefix_.Get();
+}
+inline void PBQueryServicesReq::_internal_set_match_prefix(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.match_prefix_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PBQueryServicesReq::_internal_mutable_match_prefix() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.match_prefix_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PBQueryServicesReq::release_match_prefix() {
+  // @@protoc_insertion_point(field_release:NetMsgBus.PBQueryServicesReq.match_prefix)
+  if (!_internal_has_match_prefix()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.match_prefix_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.match_prefix_.IsDefault()) {
+    _impl_.match_prefix_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void PBQueryServicesReq::set_allocated_match_prefix(std::string* match_prefix) {
+  if (match_prefix != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.match_prefix_.SetAllocated(match_prefix, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.match_prefix_.IsDefault()) {
+    _impl_.match_prefix_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:NetMsgBus.PBQueryServicesReq.match_prefix)
+}
+
+// -------------------------------------------------------------------
+
+// PBQueryServicesRsp
+
+// repeated string service_name = 1;
+inline int PBQueryServicesRsp::_internal_service_name_size() const {
+  return _impl_.service_name_.size();
+}
+inline int PBQueryServicesRsp::service_name_size() const {
+  return _internal_service_name_size();
+}
+inline void PBQueryServicesRsp::clear_service_name() {
+  _impl_.service_name_.Clear();
+}
+inline std::string* PBQueryServicesRsp::add_service_name() {
+  std::string* _s = _internal_add_service_name();
+  // @@protoc_insertion_point(field_add_mutable:NetMsgBus.PBQueryServicesRsp.service_name)
+  return _s;
+}
+inline const std::string& PBQueryServicesRsp::_internal_service_name(int index) const {
+  return _impl_.service_name_.Get(index);
+}
+inline const std::string& PBQueryServicesRsp::service_name(int index) const {
+  // @@protoc_insertion_point(field_get:NetMsgBus.PBQueryServicesRsp.service_name)
+  return _internal_service_name(index);
+}
+inline std::string* PBQueryServicesRsp::mutable_service_name(int index) {
+  // @@protoc_insertion_point(field_mutable:NetMsgBus.PBQueryServicesRsp.service_name)
+  return _impl_.service_name_.Mutable(index);
+}
+inline void PBQueryServicesRsp::set_service_name(int index, const std::string& value) {
+  _impl_.service_name_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:NetMsgBus.PBQueryServicesRsp.service_name)
+}
+inline void PBQueryServicesRsp::set_service_name(int index, std::string&& value) {
+  _impl_.service_name_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:NetMsgBus.PBQueryServicesRsp.service_name)
+}
+inline void PBQueryServicesRsp::set_service_name(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.service_name_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:NetMsgBus.PBQueryServicesRsp.service_name)
+}
+inline void PBQueryServicesRsp::set_service_name(int index, const char* value, size_t size) {
+  _impl_.service_name_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:NetMsgBus.PBQueryServicesRsp.service_name)
+}
+inline std::string* PBQueryServicesRsp::_internal_add_service_name() {
+  return _impl_.service_name_.Add();
+}
+inline void PBQueryServicesRsp::add_service_name(const std::string& value) {
+  _impl_.service_name_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:NetMsgBus.PBQueryServicesRsp.service_name)
+}
+inline void PBQueryServicesRsp::add_service_name(std::string&& value) {
+  _impl_.service_name_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:NetMsgBus.PBQueryServicesRsp.service_name)
+}
+inline void PBQueryServicesRsp::add_service_name(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.service_name_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:NetMsgBus.PBQueryServicesRsp.service_name)
+}
+inline void PBQueryServicesRsp::add_service_name(const char* value, size_t size) {
+  _impl_.service_name_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:NetMsgBus.PBQueryServicesRsp.service_name)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+PBQueryServicesRsp::service_name() const {
+  // @@protoc_insertion_point(field_list:NetMsgBus.PBQueryServicesRsp.service_name)
+  return _impl_.service_name_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+PBQueryServicesRsp::mutable_service_name() {
+  // @@protoc_insertion_point(field_mutable_list:NetMsgBus.PBQueryServicesRsp.service_name)
+  return &_impl_.service_name_;
+}
+
+// -------------------------------------------------------------------
+
+// PBQueryMessagesReq
+
+// required string service_name = 1;
+inline bool PBQueryMessagesReq::_internal_has_service_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool PBQueryMessagesReq::has_service_name() const {
+  return _internal_has_service_name();
+}
+inline void PBQueryMessagesReq::clear_service_name() {
+  _impl_.service_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& PBQueryMessagesReq::service_name() const {
+  // @@protoc_insertion_point(field_get:NetMsgBus.PBQueryMessagesReq.service_name)
+  return _internal_service_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PBQueryMessagesReq::set_service_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.service_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:NetMsgBus.PBQueryMessagesReq.service_name)
+}
+inline std::string* PBQueryMessagesReq::mutable_service_name() {
+  std::string* _s = _internal_mutable_service_name();
+  // @@protoc_insertion_point(field_mutable:NetMsgBus.PBQueryMessagesReq.service_name)
+  return _s;
+}
+inline const std::string& PBQueryMessagesReq::_internal_service_name() const {
+  return _impl_.service_name_.Get();
+}
+inline void PBQueryMessagesReq::_internal_set_service_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.service_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PBQueryMessagesReq::_internal_mutable_service_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.service_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PBQueryMessagesReq::release_service_name() {
+  // @@protoc_insertion_point(field_release:NetMsgBus.PBQueryMessagesReq.service_name)
+  if (!_internal_has_service_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.service_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.service_name_.IsDefault()) {
+    _impl_.service_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void PBQueryMessagesReq::set_allocated_service_name(std::string* service_name) {
+  if (service_name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.service_name_.SetAllocated(service_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.service_name_.IsDefault()) {
+    _impl_.service_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:NetMsgBus.PBQueryMessagesReq.service_name)
+}
+
+// required string match_prefix = 2;
+inline bool PBQueryMessagesReq::_internal_has_match_prefix() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool PBQueryMessagesReq::has_match_prefix() const {
+  return _internal_has_match_prefix();
+}
+inline void PBQueryMessagesReq::clear_match_prefix() {
+  _impl_.match_prefix_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& PBQueryMessagesReq::match_prefix() const {
+  // @@protoc_insertion_point(field_get:NetMsgBus.PBQueryMessagesReq.match_prefix)
+  return _internal_match_prefix();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PBQueryMessagesReq::set_match_prefix(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.match_prefix_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:NetMsgBus.PBQueryMessagesReq.match_prefix)
+}
+inline std::string* PBQueryMessagesReq::mutable_match_prefix() {
+  std::string* _s = _internal_mutable_match_prefix();
+  // @@protoc_insertion_point(field_mutable:NetMsgBus.PBQueryMessagesReq.match_prefix)
+  return _s;
+}
+inline const std::string& PBQueryMessagesReq::_internal_match_prefix() const {
+  return _impl_.match_prefix_.Get();
+}
+inline void PBQueryMessagesReq::_internal_set_match_prefix(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.match_prefix_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PBQueryMessagesReq::_internal_mutable_match_prefix() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.match_prefix_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PBQueryMessagesReq::release_match_prefix() {
+  // @@protoc_insertion_point(field_release:NetMsgBus.PBQueryMessagesReq.match_prefix)
+  if (!_internal_has_match_prefix()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.match_prefix_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.match_prefix_.IsDefault()) {
+    _impl_.match_prefix_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void PBQueryMessagesReq::set_allocated_match_prefix(std::string* match_prefix) {
+  if (match_prefix != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.match_prefix_.SetAllocated(match_prefix, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.match_prefix_.IsDefault()) {
+    _impl_.match_prefix_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:NetMsgBus.PBQueryMessagesReq.match_prefix)
+}
+
+// -------------------------------------------------------------------
+
+// PBQueryMessagesRsp
+
+// required string service_name = 1;
+inline bool PBQueryMessagesRsp::_internal_has_service_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool PBQueryMessagesRsp::has_service_name() const {
+  return _internal_has_service_name();
+}
+inline void PBQueryMessagesRsp::clear_service_name() {
+  _impl_.service_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& PBQueryMessagesRsp::service_name() const {
+  // @@protoc_insertion_point(field_get:NetMsgBus.PBQueryMessagesRsp.service_name)
+  return _internal_service_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PBQueryMessagesRsp::set_service_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.service_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:NetMsgBus.PBQueryMessagesRsp.service_name)
+}
+inline std::string* PBQueryMessagesRsp::mutable_service_name() {
+  std::string* _s = _internal_mutable_service_name();
+  // @@protoc_insertion_point(field_mutable:NetMsgBus.PBQueryMessagesRsp.service_name)
+  return _s;
+}
+inline const std::string& PBQueryMessagesRsp::_internal_service_name() const {
+  return _impl_.service_name_.Get();
+}
+inline void PBQueryMessagesRsp::_internal_set_service_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.service_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PBQueryMessagesRsp::_internal_mutable_service_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.service_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PBQueryMessagesRsp::release_service_name() {
+  // @@protoc_insertion_point(field_release:NetMsgBus.PBQueryMessagesRsp.service_name)
+  if (!_internal_has_service_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.service_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.service_name_.IsDefault()) {
+    _impl_.service_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void PBQueryMessagesRsp::set_allocated_service_name(std::string* service_name) {
+  if (service_name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.service_name_.SetAllocated(service_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.service_name_.IsDefault()) {
+    _impl_.service_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:NetMsgBus.PBQueryMessagesRsp.service_name)
+}
+
+// repeated string message_name = 2;
+inline int PBQueryMessagesRsp::_internal_message_name_size() const {
+  return _impl_.message_name_.size();
+}
+inline int PBQueryMessagesRsp::message_name_size() const {
+  return _internal_message_name_size();
+}
+inline void PBQueryMessagesRsp::clear_message_name() {
+  _impl_.message_name_.Clear();
+}
+inline std::string* PBQueryMessagesRsp::add_message_name() {
+  std::string* _s = _internal_add_message_name();
+  // @@protoc_insertion_point(field_add_mutable:NetMsgBus.PBQueryMessagesRsp.message_name)
+  return _s;
+}
+inline const std::string& PBQueryMessagesRsp::_internal_message_name(int index) const {
+  return _impl_.message_name_.Get(index);
+}
+inline const std::string& PBQueryMessagesRsp::message_name(int index) const {
+  // @@protoc_insertion_point(field_get:NetMsgBus.PBQueryMessagesRsp.message_name)
+  return _internal_message_name(index);
+}
+inline std::string* PBQueryMessagesRsp::mutable_message_name(int index) {
+  // @@protoc_insertion_point(field_mutable:NetMsgBus.PBQueryMessagesRsp.message_name)
+  return _impl_.message_name_.Mutable(index);
+}
+inline void PBQueryMessagesRsp::set_message_name(int index, const std::string& value) {
+  _impl_.message_name_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:NetMsgBus.PBQueryMessagesRsp.message_name)
+}
+inline void PBQueryMessagesRsp::set_message_name(int index, std::string&& value) {
+  _impl_.message_name_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:NetMsgBus.PBQueryMessagesRsp.message_name)
+}
+inline void PBQueryMessagesRsp::set_message_name(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.message_name_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:NetMsgBus.PBQueryMessagesRsp.message_name)
+}
+inline void PBQueryMessagesRsp::set_message_name(int index, const char* value, size_t size) {
+  _impl_.message_name_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:NetMsgBus.PBQueryMessagesRsp.message_name)
+}
+inline std::string* PBQueryMessagesRsp::_internal_add_message_name() {
+  return _impl_.message_name_.Add();
+}
+inline void PBQueryMessagesRsp::add_message_name(const std::string& value) {
+  _impl_.message_name_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:NetMsgBus.PBQueryMessagesRsp.message_name)
+}
+inline void PBQueryMessagesRsp::add_message_name(std::string&& value) {
+  _impl_.message_name_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:NetMsgBus.PBQueryMessagesRsp.message_name)
+}
+inline void PBQueryMessagesRsp::add_message_name(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.message_name_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:NetMsgBus.PBQueryMessagesRsp.message_name)
+}
+inline void PBQueryMessagesRsp::add_message_name(const char* value, size_t size) {
+  _impl_.message_name_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:NetMsgBus.PBQueryMessagesRsp.message_name)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+PBQueryMessagesRsp::message_name() const {
+  // @@protoc_insertion_point(field_list:NetMsgBus.PBQueryMessagesRsp.message_name)
+  return _impl_.message_name_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+PBQueryMessagesRsp::mutable_message_name() {
+  // @@protoc_insertion_point(field_mutable_list:NetMsgBus.PBQueryMessagesRsp.message_name)
+  return &_impl_.message_name_;
+}
+
+// -------------------------------------------------------------------
+
+// PBClientInfo
+
+// required uint32 client_ip = 1;
+inline bool PBClientInfo::_internal_has_client_ip() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool PBClientInfo::has_client_ip() const {
+  return _internal_has_client_ip();
+}
+inline void PBClientInfo::clear_client_ip() {
+  _impl_.client_ip_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint32_t PBClientInfo::_internal_client_ip() const {
+  return _impl_.client_ip_;
+}
+inline uint32_t PBClientInfo::client_ip() const {
+  // @@protoc_insertion_point(field_get:NetMsgBus.PBClientInfo.client_ip)
+  return _internal_client_ip();
+}
+inline void PBClientInfo::_internal_set_client_ip(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.client_ip_ = value;
+}
+inline void PBClientInfo::set_client_ip(uint32_t value) {
+  _internal_set_client_ip(value);
+  // @@protoc_insertion_point(field_set:NetMsgBus.PBClientInfo.client_ip)
+}
+
+// required uint32 client_port = 2;
+inline bool PBClientInfo::_internal_has_client_port() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool PBClientInfo::has_client_port() const {
+  return _internal_has_client_port();
+}
+inline void PBClientInfo::clear_client_port() {
+  _impl_.client_port_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t PBClientInfo::_internal_client_port() const {
+  return _impl_.client_port_;
+}
+inline uint32_t PBClientInfo::client_port() const {
+  // @@protoc_insertion_point(field_get:NetMsgBus.PBClientInfo.client_port)
+  return _internal_client_port();
+}
+inline void PBClientInfo::_internal_set_client_port(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.client_port_ = value;
+}
+inline void PBClientInfo::set_client_port(uint32_t value) {
+  _internal_set_client_port(value);
+  // @@protoc_insertion_point(field_set:NetMsgBus.PBClientInfo.client_port)
+}
+
+// required sint32 client_state = 3;
+inline bool PBClientInfo::_internal_has_client_state() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool PBClientInfo::has_client_state() const {
+  return _internal_has_client_state();
+}
+inline void PBClientInfo::clear_client_state() {
+  _impl_.client_state_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline int32_t PBClientInfo::_internal_client_state() const {
+  return _impl_.client_state_;
+}
+inline int32_t PBClientInfo::client_state() const {
+  // @@protoc_insertion_point(field_get:NetMsgBus.PBClientInfo.client_state)
+  return _internal_client_state();
+}
+inline void PBClientInfo::_internal_set_client_state(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.client_state_ = value;
+}
+inline void PBClientInfo::set_client_state(int32_t value) {
+  _internal_set_client_state(value);
+  // @@protoc_insertion_point(field_set:NetMsgBus.PBClientInfo.client_state)
+}
+
+// -------------------------------------------------------------------
+
+// PBServiceClients
+
+// required string service_name = 1;
+inline bool PBServiceClients::_internal_has_service_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool PBServiceClients::has_service_name() const {
+  return _internal_has_service_name();
+}
+inline void PBServiceClients::clear_service_name() {
+  _impl_.service_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& PBServiceClients::service_name() const {
+  // @@protoc_insertion_point(field_get:NetMsgBus.PBServiceClients.service_name)
+  return _internal_service_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PBServiceClients::set_service_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.service_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:NetMsgBus.PBServiceClients.service_name)
+}
+inline std::string* PBServiceClients::mutable_service_name() {
+  std::string* _s = _internal_mutable_service_name();
+  // @@protoc_insertion_point(field_mutable:NetMsgBus.PBServiceClients.service_name)
+  return _s;
+}
+inline const std::string& PBServiceClients::_internal_service_name() const {
+  return _impl_.service_name_.Get();
+}
+inline void PBServiceClients::_internal_set_service_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.service_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PBServiceClients::_internal_mutable_service_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.service_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PBServiceClients::release_service_name() {
+  // @@protoc_insertion_point(field_release:NetMsgBus.PBServiceClients.service_name)
+  if (!_internal_has_service_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.service_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.service_name_.IsDefault()) {
+    _impl_.service_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void PBServiceClients::set_allocated_service_name(std::string* service_name) {
+  if (service_name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.service_name_.SetAllocated(service_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.service_name_.IsDefault()) {
+    _impl_.service_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:NetMsgBus.PBServiceClients.service_name)
+}
+
+// repeated .NetMsgBus.PBClientInfo client_info = 2;
+inline int PBServiceClients::_internal_client_info_size() const {
+  return _impl_.client_info_.size();
+}
+inline int PBServiceClients::client_info_size() const {
+  return _internal_client_info_size();
+}
+inline void PBServiceClients::clear_client_info() {
+  _impl_.client_info_.Clear();
+}
+inline ::NetMsgBus::PBClientInfo* PBServiceClients::mutable_client_info(int index) {
+  // @@protoc_insertion_point(field_mutable:NetMsgBus.PBServiceClients.client_info)
+  return _impl_.client_info_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::NetMsgBus::PBClientInfo >*
+PBServiceClients::mutable_client_info() {
+  // @@protoc_insertion_point(field_mutable_list:NetMsgBus.PBServiceClients.client_info)
+  return &_impl_.client_info_;
+}
+inline const ::NetMsgBus::PBClientInfo& PBServiceClients::_internal_client_info(int index) const {
+  return _impl_.client_info_.Get(index);
+}
+inline const ::NetMsgBus::PBClientInfo& PBServiceClients::client_info(int index) const {
+  // @@protoc_insertion_point(field_get:NetMsgBus.PBServiceClients.client_info)
+  return _internal_client_info(index);
+}
+inline ::NetMsgBus::PBClientInfo* PBServiceClients::_internal_add_client_info() {
+  return _impl_.client_info_.Add();
+}
+inline ::NetMsgBus::PBClientInfo* PBServiceClients::add_client_info() {
+  ::NetMsgBus::PBClientInfo* _add = _internal_add_client_info();
+  // @@protoc_insertion_point(field_add:NetMsgBus.PBServiceClients.client_info)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::NetMsgBus::PBClientInfo >&
+PBServiceClients::client_info() const {
+  // @@protoc_insertion_point(field_list:NetMsgBus.PBServiceClients.client_info)
+  return _impl_.client_info_;
+}
+
+// -------------------------------------------------------------------
+
+// PBSyncServerData
+
+// required string server_name = 1;
+inline bool PBSyncServerData::_internal_has_server_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool PBSyncServerData::has_server_name() const {
+  return _internal_has_server_name();
+}
+inline void PBSyncServerData::clear_server_name() {
+  _impl_.server_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& PBSyncServerData::server_name() const {
+  // @@protoc_insertion_point(field_get:NetMsgBus.PBSyncServerData.server_name)
+  return _internal_server_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PBSyncServerData::set_server_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.server_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:NetMsgBus.PBSyncServerData.server_name)
+}
+inline std::string* PBSyncServerData::mutable_server_name() {
+  std::string* _s = _internal_mutable_server_name();
+  // @@protoc_insertion_point(field_mutable:NetMsgBus.PBSyncServerData.server_name)
+  return _s;
+}
+inline const std::string& PBSyncServerData::_internal_server_name() const {
+  return _impl_.server_name_.Get();
+}
+inline void PBSyncServerData::_internal_set_server_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.server_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PBSyncServerData::_internal_mutable_server_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.server_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PBSyncServerData::release_server_name() {
+  // @@protoc_insertion_point(field_release:NetMsgBus.PBSyncServerData.server_name)
+  if (!_internal_has_server_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.server_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.server_name_.IsDefault()) {
+    _impl_.server_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void PBSyncServerData::set_allocated_server_name(std::string* server_name) {
+  if (server_name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.server_name_.SetAllocated(server_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.server_name_.IsDefault()) {
+    _impl_.server_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:NetMsgBus.PBSyncServerData.server_name)
+}
+
+// repeated .NetMsgBus.PBServiceClients service_info = 2;
+inline int PBSyncServerData::_internal_service_info_size() const {
+  return _impl_.service_info_.size();
+}
+inline int PBSyncServerData::service_info_size() const {
+  return _internal_service_info_size();
+}
+inline void PBSyncServerData::clear_service_info() {
+  _impl_.service_info_.Clear();
+}
+inline ::NetMsgBus::PBServiceClients* PBSyncServerData::mutable_service_info(int index) {
+  // @@protoc_insertion_point(field_mutable:NetMsgBus.PBSyncServerData.service_info)
+  return _impl_.service_info_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::NetMsgBus::PBServiceClients >*
+PBSyncServerData::mutable_service_info() {
+  // @@protoc_insertion_point(field_mutable_list:NetMsgBus.PBSyncServerData.service_info)
+  return &_impl_.service_info_;
+}
+inline const ::NetMsgBus::PBServiceClients& PBSyncServerData::_internal_service_info(int index) const {
+  return _impl_.service_info_.Get(index);
+}
+inline const ::NetMsgBus::PBServiceClients& PBSyncServerData::service_info(int index) const {
+  // @@protoc_insertion_point(field_get:NetMsgBus.PBSyncServerData.service_info)
+  return _internal_service_info(index);
+}
+inline ::NetMsgBus::PBServiceClients* PBSyncServerData::_internal_add_service_info() {
+  return _impl_.service_info_.Add();
+}
+inline ::NetMsgBus::PBServiceClients* PBSyncServerData::add_service_info() {
+  ::NetMsgBus::PBServiceClients* _add = _internal_add_service_info();
+  // @@protoc_insertion_point(field_add:NetMsgBus.PBSyncServerData.service_info)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::NetMsgBus::PBServiceClients >&
+PBSyncServerData::service_info() const {
+  // @@protoc_insertion_point(field_list:NetMsgBus.PBSyncServerData.service_info)
+  return _impl_.service_info_;
+}
+
+// optional bool full_sync = 3 [default = false];
+inline bool PBSyncServerData::_internal_has_full_sync() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool PBSyncServerData::has_full_sync() const {
+  return _internal_has_full_sync();
+}
+inline void PBSyncServerData::clear_full_sync() {
+  _impl_.full_sync_ = false;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline bool PBSyncServerData::_internal_full_sync() const {
+  return _impl_.full_sync_;
+}
+inline bool PBSyncServerData::full_sync() const {
+  // @@protoc_insertion_point(field_get:NetMsgBus.PBSyncServerData.full_sync)
+  return _internal_full_sync();
+}
+inline void PBSyncServerData::_internal_set_full_sync(bool value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.full_sync_ = value;
+}
+inline void PBSyncServerData::set_full_sync(bool value) {
+  _internal_set_full_sync(value);
+  // @@protoc_insertion_point(field_set:NetMsgBus.PBSyncServerData.full_sync)
+}
+
+// -------------------------------------------------------------------
+
+// PBSubscribeServicesReq
+
+// required string match_prefix = 1;
+inline bool PBSubscribeServicesReq::_internal_has_match_prefix() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool PBSubscribeServicesReq::has_match_prefix() const {
+  return _internal_has_match_prefix();
+}
+inline void PBSubscribeServicesReq::clear_match_prefix() {
+  _impl_.match_prefix_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& PBSubscribeServicesReq::match_prefix() const {
+  // @@protoc_insertion_point(field_get:NetMsgBus.PBSubscribeServicesReq.match_prefix)
+  return _internal_match_prefix();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PBSubscribeServicesReq::set_match_prefix(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.match_prefix_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:NetMsgBus.PBSubscribeServicesReq.match_prefix)
+}
+inline std::string* PBSubscribeServicesReq::mutable_match_prefix() {
+  std::string* _s = _internal_mutable_match_prefix();
+  // @@protoc_insertion_point(field_mutable:NetMsgBus.PBSubscribeServicesReq.match_prefix)
+  return _s;
+}
+inline const std::string& PBSubscribeServicesReq::_internal_match_prefix() const {
+  return _impl_.match_prefix_.Get();
+}
+inline void PBSubscribeServicesReq::_internal_set_match_prefix(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.match_prefix_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PBSubscribeServicesReq::_internal_mutable_match_prefix() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.match_prefix_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PBSubscribeServicesReq::release_match_prefix() {
+  // @@protoc_insertion_point(field_release:NetMsgBus.PBSubscribeServicesReq.match_prefix)
+  if (!_internal_has_match_prefix()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.match_prefix_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.match_prefix_.IsDefault()) {
+    _impl_.match_prefix_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void PBSubscribeServicesReq::set_allocated_match_prefix(std::string* match_prefix) {
+  if (match_prefix != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.match_prefix_.SetAllocated(match_prefix, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.match_prefix_.IsDefault()) {
+    _impl_.match_prefix_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:NetMsgBus.PBSubscribeServicesReq.match_prefix)
+}
+
+// optional bool unsubscribe = 2 [default = false];
+inline bool PBSubscribeServicesReq::_internal_has_unsubscribe() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool PBSubscribeServicesReq::has_unsubscribe() const {
+  return _internal_has_unsubscribe();
+}
+inline void PBSubscribeServicesReq::clear_unsubscribe() {
+  _impl_.unsubscribe_ = false;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline bool PBSubscribeServicesReq::_internal_unsubscribe() const {
+  return _impl_.unsubscribe_;
+}
+inline bool PBSubscribeServicesReq::unsubscribe() const {
+  // @@protoc_insertion_point(field_get:NetMsgBus.PBSubscribeServicesReq.unsubscribe)
+  return _internal_unsubscribe();
+}
+inline void PBSubscribeServicesReq::_internal_set_unsubscribe(bool value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.unsubscribe_ = value;
+}
+inline void PBSubscribeServicesReq::set_unsubscribe(bool value) {
+  _internal_set_unsubscribe(value);
+  // @@protoc_insertion_point(field_set:NetMsgBus.PBSubscribeServicesReq.unsubscribe)
+}
+
+// -------------------------------------------------------------------
+
+// PBServiceChangeNotify
+
+// repeated .NetMsgBus.PBServiceClients service_info = 1;
+inline int PBServiceChangeNotify::_internal_service_info_size() const {
+  return _impl_.service_info_.size();
+}
+inline int PBServiceChangeNotify::service_info_size() const {
+  return _internal_service_info_size();
+}
+inline void PBServiceChangeNotify::clear_service_info() {
+  _impl_.service_info_.Clear();
+}
+inline ::NetMsgBus::PBServiceClients* PBServiceChangeNotify::mutable_service_info(int index) {
+  // @@protoc_insertion_point(field_mutable:NetMsgBus.PBServiceChangeNotify.service_info)
+  return _impl_.service_info_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::NetMsgBus::PBServiceClients >*
+PBServiceChangeNotify::mutable_service_info() {
+  // @@protoc_insertion_point(field_mutable_list:NetMsgBus.PBServiceChangeNotify.service_info)
+  return &_impl_.service_info_;
+}
+inline const ::NetMsgBus::PBServiceClients& PBServiceChangeNotify::_internal_service_info(int index) const {
+  return _impl_.service_info_.Get(index);
+}
+inline const ::NetMsgBus::PBServiceClients& PBServiceChangeNotify::service_info(int index) const {
+  // @@protoc_insertion_point(field_get:NetMsgBus.PBServiceChangeNotify.service_info)
+  return _internal_service_info(index);
+}
+inline ::NetMsgBus::PBServiceClients* PBServiceChangeNotify::_internal_add_service_info() {
+  return _impl_.service_info_.Add();
+}
+inline ::NetMsgBus::PBServiceClients* PBServiceChangeNotify::add_service_info() {
+  ::NetMsgBus::PBServiceClients* _add = _internal_add_service_info();
+  // @@protoc_insertion_point(field_add:NetMsgBus.PBServiceChangeNotify.service_info)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::NetMsgBus::PBServiceClients >&
+PBServiceChangeNotify::service_info() const {
+  // @@protoc_insertion_point(field_list:NetMsgBus.PBServiceChangeNotify.service_info)
+  return _impl_.service_info_;
+}
+
+// -------------------------------------------------------------------
+
+// PBAdvertiseMessagesReq
+
+// repeated string message_name = 1;
+inline int PBAdvertiseMessagesReq::_internal_message_name_size() const {
+  return _impl_.message_name_.size();
+}
+inline int PBAdvertiseMessagesReq::message_name_size() const {
+  return _internal_message_name_size();
+}
+inline void PBAdvertiseMessagesReq::clear_message_name() {
+  _impl_.message_name_.Clear();
+}
+inline std::string* PBAdvertiseMessagesReq::add_message_name() {
+  std::string* _s = _internal_add_message_name();
+  // @@protoc_insertion_point(field_add_mutable:NetMsgBus.PBAdvertiseMessagesReq.message_name)
+  return _s;
+}
+inline const std::string& PBAdvertiseMessagesReq::_internal_message_name(int index) const {
+  return _impl_.message_name_.Get(index);
+}
+inline const std::string& PBAdvertiseMessagesReq::message_name(int index) const {
+  // @@protoc_insertion_point(field_get:NetMsgBus.PBAdvertiseMessagesReq.message_name)
+  return _internal_message_name(index);
+}
+inline std::string* PBAdvertiseMessagesReq::mutable_message_name(int index) {
+  // @@protoc_insertion_point(field_mutable:NetMsgBus.PBAdvertiseMessagesReq.message_name)
+  return _impl_.message_name_.Mutable(index);
+}
+inline void PBAdvertiseMessagesReq::set_message_name(int index, const std::string& value) {
+  _impl_.message_name_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:NetMsgBus.PBAdvertiseMessagesReq.message_name)
+}
+inline void PBAdvertiseMessagesReq::set_message_name(int index, std::string&& value) {
+  _impl_.message_name_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:NetMsgBus.PBAdvertiseMessagesReq.message_name)
+}
+inline void PBAdvertiseMessagesReq::set_message_name(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.message_name_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:NetMsgBus.PBAdvertiseMessagesReq.message_name)
+}
+inline void PBAdvertiseMessagesReq::set_message_name(int index, const char* value, size_t size) {
+  _impl_.message_name_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:NetMsgBus.PBAdvertiseMessagesReq.message_name)
+}
+inline std::string* PBAdvertiseMessagesReq::_internal_add_message_name() {
+  return _impl_.message_name_.Add();
+}
+inline void PBAdvertiseMessagesReq::add_message_name(const std::string& value) {
+  _impl_.message_name_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:NetMsgBus.PBAdvertiseMessagesReq.message_name)
+}
+inline void PBAdvertiseMessagesReq::add_message_name(std::string&& value) {
+  _impl_.message_name_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:NetMsgBus.PBAdvertiseMessagesReq.message_name)
+}
+inline void PBAdvertiseMessagesReq::add_message_name(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.message_name_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:NetMsgBus.PBAdvertiseMessagesReq.message_name)
+}
+inline void PBAdvertiseMessagesReq::add_message_name(const char* value, size_t size) {
+  _impl_.message_name_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:NetMsgBus.PBAdvertiseMessagesReq.message_name)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+PBAdvertiseMessagesReq::message_name() const {
+  // @@protoc_insertion_point(field_list:NetMsgBus.PBAdvertiseMessagesReq.message_name)
+  return _impl_.message_name_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+PBAdvertiseMessagesReq::mutable_message_name() {
+  // @@protoc_insertion_point(field_mutable_list:NetMsgBus.PBAdvertiseMessagesReq.message_name)
+  return &_impl_.message_name_;
+}
+
+// repeated string message_prefix = 2;
+inline int PBAdvertiseMessagesReq::_internal_message_prefix_size() const {
+  return _impl_.message_prefix_.size();
+}
+inline int PBAdvertiseMessagesReq::message_prefix_size() const {
+  return _internal_message_prefix_size();
+}
+inline void PBAdvertiseMessagesReq::clear_message_prefix() {
+  _impl_.message_prefix_.Clear();
+}
+inline std::string* PBAdvertiseMessagesReq::add_message_prefix() {
+  std::string* _s = _internal_add_message_prefix();
+  // @@protoc_insertion_point(field_add_mutable:NetMsgBus.PBAdvertiseMessagesReq.message_prefix)
+  return _s;
+}
+inline const std::string& PBAdvertiseMessagesReq::_internal_message_prefix(int index) const {
+  return _impl_.message_prefix_.Get(index);
+}
+inline const std::string& PBAdvertiseMessagesReq::message_prefix(int index) const {
+  // @@protoc_insertion_point(field_get:NetMsgBus.PBAdvertiseMessagesReq.message_prefix)
+  return _internal_message_prefix(index);
+}
+inline std::string* PBAdvertiseMessagesReq::mutable_message_prefix(int index) {
+  // @@protoc_insertion_point(field_mutable:NetMsgBus.PBAdvertiseMessagesReq.message_prefix)
+  return _impl_.message_prefix_.Mutable(index);
+}
+inline void PBAdvertiseMessagesReq::set_message_prefix(int index, const std::string& value) {
+  _impl_.message_prefix_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:NetMsgBus.PBAdvertiseMessagesReq.message_prefix)
+}
+inline void PBAdvertiseMessagesReq::set_message_prefix(int index, std::string&& value) {
+  _impl_.message_prefix_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:NetMsgBus.PBAdvertiseMessagesReq.message_prefix)
+}
+inline void PBAdvertiseMessagesReq::set_message_prefix(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.message_prefix_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:NetMsgBus.PBAdvertiseMessagesReq.message_prefix)
+}
+inline void PBAdvertiseMessagesReq::set_message_prefix(int index, const char* value, size_t size) {
+  _impl_.message_prefix_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:NetMsgBus.PBAdvertiseMessagesReq.message_prefix)
+}
+inline std::string* PBAdvertiseMessagesReq::_internal_add_message_prefix() {
+  return _impl_.message_prefix_.Add();
+}
+inline void PBAdvertiseMessagesReq::add_message_prefix(const std::string& value) {
+  _impl_.message_prefix_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:NetMsgBus.PBAdvertiseMessagesReq.message_prefix)
+}
+inline void PBAdvertiseMessagesReq::add_message_prefix(std::string&& value) {
+  _impl_.message_prefix_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:NetMsgBus.PBAdvertiseMessagesReq.message_prefix)
+}
+inline void PBAdvertiseMessagesReq::add_message_prefix(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.message_prefix_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:NetMsgBus.PBAdvertiseMessagesReq.message_prefix)
+}
+inline void PBAdvertiseMessagesReq::add_message_prefix(const char* value, size_t size) {
+  _impl_.message_prefix_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:NetMsgBus.PBAdvertiseMessagesReq.message_prefix)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+PBAdvertiseMessagesReq::message_prefix() const {
+  // @@protoc_insertion_point(field_list:NetMsgBus.PBAdvertiseMessagesReq.message_prefix)
+  return _impl_.message_prefix_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+PBAdvertiseMessagesReq::mutable_message_prefix() {
+  // @@protoc_insertion_point(field_mutable_list:NetMsgBus.PBAdvertiseMessagesReq.message_prefix)
+  return &_impl_.message_prefix_;
+}
+
+// -------------------------------------------------------------------
+
+// PBGetClientsReq
+
+// repeated string service_name = 1;
+inline int PBGetClientsReq::_internal_service_name_size() const {
+  return _impl_.service_name_.size();
+}
+inline int PBGetClientsReq::service_name_size() const {
+  return _internal_service_name_size();
+}
+inline void PBGetClientsReq::clear_service_name() {
+  _impl_.service_name_.Clear();
+}
+inline std::string* PBGetClientsReq::add_service_name() {
+  std::string* _s = _internal_add_service_name();
+  // @@protoc_insertion_point(field_add_mutable:NetMsgBus.PBGetClientsReq.service_name)
+  return _s;
+}
+inline const std::string& PBGetClientsReq::_internal_service_name(int index) const {
+  return _impl_.service_name_.Get(index);
+}
+inline const std::string& PBGetClientsReq::service_name(int index) const {
+  // @@protoc_insertion_point(field_get:NetMsgBus.PBGetClientsReq.service_name)
+  return _internal_service_name(index);
+}
+inline std::string* PBGetClientsReq::mutable_service_name(int index) {
+  // @@protoc_insertion_point(field_mutable:NetMsgBus.PBGetClientsReq.service_name)
+  return _impl_.service_name_.Mutable(index);
+}
+inline void PBGetClientsReq::set_service_name(int index, const std::string& value) {
+  _impl_.service_name_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:NetMsgBus.PBGetClientsReq.service_name)
+}
+inline void PBGetClientsReq::set_service_name(int index, std::string&& value) {
+  _impl_.service_name_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:NetMsgBus.PBGetClientsReq.service_name)
+}
+inline void PBGetClientsReq::set_service_name(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.service_name_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:NetMsgBus.PBGetClientsReq.service_name)
+}
+inline void PBGetClientsReq::set_service_name(int index, const char* value, size_t size) {
+  _impl_.service_name_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:NetMsgBus.PBGetClientsReq.service_name)
+}
+inline std::string* PBGetClientsReq::_internal_add_service_name() {
+  return _impl_.service_name_.Add();
+}
+inline void PBGetClientsReq::add_service_name(const std::string& value) {
+  _impl_.service_name_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:NetMsgBus.PBGetClientsReq.service_name)
+}
+inline void PBGetClientsReq::add_service_name(std::string&& value) {
+  _impl_.service_name_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:NetMsgBus.PBGetClientsReq.service_name)
+}
+inline void PBGetClientsReq::add_service_name(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.service_name_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:NetMsgBus.PBGetClientsReq.service_name)
+}
+inline void PBGetClientsReq::add_service_name(const char* value, size_t size) {
+  _impl_.service_name_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:NetMsgBus.PBGetClientsReq.service_name)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+PBGetClientsReq::service_name() const {
+  // @@protoc_insertion_point(field_list:NetMsgBus.PBGetClientsReq.service_name)
+  return _impl_.service_name_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+PBGetClientsReq::mutable_service_name() {
+  // @@protoc_insertion_point(field_mutable_list:NetMsgBus.PBGetClientsReq.service_name)
+  return &_impl_.service_name_;
+}
+
+// -------------------------------------------------------------------
+
+// PBRegisterServicesReq
+
+// repeated string service_name = 1;
+inline int PBRegisterServicesReq::_internal_service_name_size() const {
+  return _impl_.service_name_.size();
+}
+inline int PBRegisterServicesReq::service_name_size() const {
+  return _internal_service_name_size();
+}
+inline void PBRegisterServicesReq::clear_service_name() {
+  _impl_.service_name_.Clear();
+}
+inline std::string* PBRegisterServicesReq::add_service_name() {
+  std::string* _s = _internal_add_service_name();
+  // @@protoc_insertion_point(field_add_mutable:NetMsgBus.PBRegisterServicesReq.service_name)
+  return _s;
+}
+inline const std::string& PBRegisterServicesReq::_internal_service_name(int index) const {
+  return _impl_.service_name_.Get(index);
+}
+inline const std::string& PBRegisterServicesReq::service_name(int index) const {
+  // @@protoc_insertion_point(field_get:NetMsgBus.PBRegisterServicesReq.service_name)
+  return _internal_service_name(index);
+}
+inline std::string* PBRegisterServicesReq::mutable_service_name(int index) {
+  // @@protoc_insertion_point(field_mutable:NetMsgBus.PBRegisterServicesReq.service_name)
+  return _impl_.service_name_.Mutable(index);
+}
+inline void PBRegisterServicesReq::set_service_name(int index, const std::string& value) {
+  _impl_.service_name_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:NetMsgBus.PBRegisterServicesReq.service_name)
+}
+inline void PBRegisterServicesReq::set_service_name(int index, std::string&& value) {
+  _impl_.service_name_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:NetMsgBus.PBRegisterServicesReq.service_name)
+}
+inline void PBRegisterServicesReq::set_service_name(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.service_name_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:NetMsgBus.PBRegisterServicesReq.service_name)
+}
+inline void PBRegisterServicesReq::set_service_name(int index, const char* value, size_t size) {
+  _impl_.service_name_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:NetMsgBus.PBRegisterServicesReq.service_name)
+}
+inline std::string* PBRegisterServicesReq::_internal_add_service_name() {
+  return _impl_.service_name_.Add();
+}
+inline void PBRegisterServicesReq::add_service_name(const std::string& value) {
+  _impl_.service_name_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:NetMsgBus.PBRegisterServicesReq.service_name)
+}
+inline void PBRegisterServicesReq::add_service_name(std::string&& value) {
+  _impl_.service_name_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:NetMsgBus.PBRegisterServicesReq.service_name)
+}
+inline void PBRegisterServicesReq::add_service_name(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.service_name_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:NetMsgBus.PBRegisterServicesReq.service_name)
+}
+inline void PBRegisterServicesReq::add_service_name(const char* value, size_t size) {
+  _impl_.service_name_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:NetMsgBus.PBRegisterServicesReq.service_name)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+PBRegisterServicesReq::service_name() const {
+  // @@protoc_insertion_point(field_list:NetMsgBus.PBRegisterServicesReq.service_name)
+  return _impl_.service_name_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+PBRegisterServicesReq::mutable_service_name() {
+  // @@protoc_insertion_point(field_mutable_list:NetMsgBus.PBRegisterServicesReq.service_name)
+  return &_impl_.service_name_;
+}
+
+// required .NetMsgBus.PBClientInfo client_info = 2;
+inline bool PBRegisterServicesReq::_internal_has_client_info() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.client_info_ != nullptr);
+  return value;
+}
+inline bool PBRegisterServicesReq::has_client_info() const {
+  return _internal_has_client_info();
+}
+inline void PBRegisterServicesReq::clear_client_info() {
+  if (_impl_.client_info_ != nullptr) _impl_.client_info_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::NetMsgBus::PBClientInfo& PBRegisterServicesReq::_internal_client_info() const {
+  const ::NetMsgBus::PBClientInfo* p = _impl_.client_info_;
+  return p != nullptr ? *p : reinterpret_cast<const ::NetMsgBus::PBClientInfo&>(
+      ::NetMsgBus::_PBClientInfo_default_instance_);
+}
+inline const ::NetMsgBus::PBClientInfo& PBRegisterServicesReq::client_info() const {
+  // @@protoc_insertion_point(field_get:NetMsgBus.PBRegisterServicesReq.client_info)
+  return _internal_client_info();
+}
+inline void PBRegisterServicesReq::unsafe_arena_set_allocated_client_info(
+    ::NetMsgBus::PBClientInfo* client_info) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.client_info_);
+  }
+  _impl_.client_info_ = client_info;
+  if (client_info) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:NetMsgBus.PBRegisterServicesReq.client_info)
+}
+inline ::NetMsgBus::PBClientInfo* PBRegisterServicesReq::release_client_info() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::NetMsgBus::PBClientInfo* temp = _impl_.client_info_;
+  _impl_.client_info_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::NetMsgBus::PBClientInfo* PBRegisterServicesReq::unsafe_arena_release_client_info() {
+  // @@protoc_insertion_point(field_release:NetMsgBus.PBRegisterServicesReq.client_info)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::NetMsgBus::PBClientInfo* temp = _impl_.client_info_;
+  _impl_.client_info_ = nullptr;
+  return temp;
+}
+inline ::NetMsgBus::PBClientInfo* PBRegisterServicesReq::_internal_mutable_client_info() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.client_info_ == nullptr) {
+    auto* p = CreateMaybeMessage<::NetMsgBus::PBClientInfo>(GetArenaForAllocation());
+    _impl_.client_info_ = p;
+  }
+  return _impl_.client_info_;
+}
+inline ::NetMsgBus::PBClientInfo* PBRegisterServicesReq::mutable_client_info() {
+  ::NetMsgBus::PBClientInfo* _msg = _internal_mutable_client_info();
+  // @@protoc_insertion_point(field_mutable:NetMsgBus.PBRegisterServicesReq.client_info)
+  return _msg;
+}
+inline void PBRegisterServicesReq::set_allocated_client_info(::NetMsgBus::PBClientInfo* client_info) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.client_info_;
+  }
+  if (client_info) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(client_info);
+    if (message_arena != submessage_arena) {
+      client_info = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, client_info, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.client_info_ = client_info;
+  // @@protoc_insertion_point(field_set_allocated:NetMsgBus.PBRegisterServicesReq.client_info)
+}
+
+// -------------------------------------------------------------------
+
+// PBRegisterServicesRsp
+
+// repeated string failed_service_name = 1;
+inline int PBRegisterServicesRsp::_internal_failed_service_name_size() const {
+  return _impl_.failed_service_name_.size();
+}
+inline int PBRegisterServicesRsp::failed_service_name_size() const {
+  return _internal_failed_service_name_size();
+}
+inline void PBRegisterServicesRsp::clear_failed_service_name() {
+  _impl_.failed_service_name_.Clear();
+}
+inline std::string* PBRegisterServicesRsp::add_failed_service_name() {
+  std::string* _s = _internal_add_failed_service_name();
+  // @@protoc_insertion_point(field_add_mutable:NetMsgBus.PBRegisterServicesRsp.failed_service_name)
+  return _s;
+}
+inline const std::string& PBRegisterServicesRsp::_internal_failed_service_name(int index) const {
+  return _impl_.failed_service_name_.Get(index);
+}
+inline const std::string& PBRegisterServicesRsp::failed_service_name(int index) const {
+  // @@protoc_insertion_point(field_get:NetMsgBus.PBRegisterServicesRsp.failed_service_name)
+  return _internal_failed_service_name(index);
+}
+inline std::string* PBRegisterServicesRsp::mutable_failed_service_name(int index) {
+  // @@protoc_insertion_point(field_mutable:NetMsgBus.PBRegisterServicesRsp.failed_service_name)
+  return _impl_.failed_service_name_.Mutable(index);
+}
+inline void PBRegisterServicesRsp::set_failed_service_name(int index, const std::string& value) {
+  _impl_.failed_service_name_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:NetMsgBus.PBRegisterServicesRsp.failed_service_name)
+}
+inline void PBRegisterServicesRsp::set_failed_service_name(int index, std::string&& value) {
+  _impl_.failed_service_name_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:NetMsgBus.PBRegisterServicesRsp.failed_service_name)
+}
+inline void PBRegisterServicesRsp::set_failed_service_name(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.failed_service_name_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:NetMsgBus.PBRegisterServicesRsp.failed_service_name)
+}
+inline void PBRegisterServicesRsp::set_failed_service_name(int index, const char* value, size_t size) {
+  _impl_.failed_service_name_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:NetMsgBus.PBRegisterServicesRsp.failed_service_name)
+}
+inline std::string* PBRegisterServicesRsp::_internal_add_failed_service_name() {
+  return _impl_.failed_service_name_.Add();
+}
+inline void PBRegisterServicesRsp::add_failed_service_name(const std::string& value) {
+  _impl_.failed_service_name_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:NetMsgBus.PBRegisterServicesRsp.failed_service_name)
+}
+inline void PBRegisterServicesRsp::add_failed_service_name(std::string&& value) {
+  _impl_.failed_service_name_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:NetMsgBus.PBRegisterServicesRsp.failed_service_name)
+}
+inline void PBRegisterServicesRsp::add_failed_service_name(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.failed_service_name_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:NetMsgBus.PBRegisterServicesRsp.failed_service_name)
+}
+inline void PBRegisterServicesRsp::add_failed_service_name(const char* value, size_t size) {
+  _impl_.failed_service_name_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:NetMsgBus.PBRegisterServicesRsp.failed_service_name)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+PBRegisterServicesRsp::failed_service_name() const {
+  // @@protoc_insertion_point(field_list:NetMsgBus.PBRegisterServicesRsp.failed_service_name)
+  return _impl_.failed_service_name_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+PBRegisterServicesRsp::mutable_failed_service_name() {
+  // @@protoc_insertion_point(field_mutable_list:NetMsgBus.PBRegisterServicesRsp.failed_service_name)
+  return &_impl_.failed_service_name_;
+}
+
+// repeated string err_msg = 2;
+inline int PBRegisterServicesRsp::_internal_err_msg_size() const {
+  return _impl_.err_msg_.size();
+}
+inline int PBRegisterServicesRsp::err_msg_size() const {
+  return _internal_err_msg_size();
+}
+inline void PBRegisterServicesRsp::clear_err_msg() {
+  _impl_.err_msg_.Clear();
+}
+inline std::string* PBRegisterServicesRsp::add_err_msg() {
+  std::string* _s = _internal_add_err_msg();
+  // @@protoc_insertion_point(field_add_mutable:NetMsgBus.PBRegisterServicesRsp.err_msg)
+  return _s;
+}
+inline const std::string& PBRegisterServicesRsp::_internal_err_msg(int index) const {
+  return _impl_.err_msg_.Get(index);
+}
+inline const std::string& PBRegisterServicesRsp::err_msg(int index) const {
+  // @@protoc_insertion_point(field_get:NetMsgBus.PBRegisterServicesRsp.err_msg)
+  return _internal_err_msg(index);
+}
+inline std::string* PBRegisterServicesRsp::mutable_err_msg(int index) {
+  // @@protoc_insertion_point(field_mutable:NetMsgBus.PBRegisterServicesRsp.err_msg)
+  return _impl_.err_msg_.Mutable(index);
+}
+inline void PBRegisterServicesRsp::set_err_msg(int index, const std::string& value) {
+  _impl_.err_msg_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:NetMsgBus.PBRegisterServicesRsp.err_msg)
+}
+inline void PBRegisterServicesRsp::set_err_msg(int index, std::string&& value) {
+  _impl_.err_msg_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:NetMsgBus.PBRegisterServicesRsp.err_msg)
+}
+inline void PBRegisterServicesRsp::set_err_msg(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.err_msg_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:NetMsgBus.PBRegisterServicesRsp.err_msg)
+}
+inline void PBRegisterServicesRsp::set_err_msg(int index, const char* value, size_t size) {
+  _impl_.err_msg_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:NetMsgBus.PBRegisterServicesRsp.err_msg)
+}
+inline std::string* PBRegisterServicesRsp::_internal_add_err_msg() {
+  return _impl_.err_msg_.Add();
+}
+inline void PBRegisterServicesRsp::add_err_msg(const std::string& value) {
+  _impl_.err_msg_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:NetMsgBus.PBRegisterServicesRsp.err_msg)
+}
+inline void PBRegisterServicesRsp::add_err_msg(std::string&& value) {
+  _impl_.err_msg_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:NetMsgBus.PBRegisterServicesRsp.err_msg)
+}
+inline void PBRegisterServicesRsp::add_err_msg(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.err_msg_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:NetMsgBus.PBRegisterServicesRsp.err_msg)
+}
+inline void PBRegisterServicesRsp::add_err_msg(const char* value, size_t size) {
+  _impl_.err_msg_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:NetMsgBus.PBRegisterServicesRsp.err_msg)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+PBRegisterServicesRsp::err_msg() const {
+  // @@protoc_insertion_point(field_list:NetMsgBus.PBRegisterServicesRsp.err_msg)
+  return _impl_.err_msg_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+PBRegisterServicesRsp::mutable_err_msg() {
+  // @@protoc_insertion_point(field_mutable_list:NetMsgBus.PBRegisterServicesRsp.err_msg)
+  return &_impl_.err_msg_;
+}
+
+// -------------------------------------------------------------------
+
+// PBDisconnectNotify
+
+// required int32 reason_code = 1;
+inline bool PBDisconnectNotify::_internal_has_reason_code() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool PBDisconnectNotify::has_reason_code() const {
+  return _internal_has_reason_code();
+}
+inline void PBDisconnectNotify::clear_reason_code() {
+  _impl_.reason_code_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline int32_t PBDisconnectNotify::_internal_reason_code() const {
+  return _impl_.reason_code_;
+}
+inline int32_t PBDisconnectNotify::reason_code() const {
+  // @@protoc_insertion_point(field_get:NetMsgBus.PBDisconnectNotify.reason_code)
+  return _internal_reason_code();
+}
+inline void PBDisconnectNotify::_internal_set_reason_code(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.reason_code_ = value;
+}
+inline void PBDisconnectNotify::set_reason_code(int32_t value) {
+  _internal_set_reason_code(value);
+  // @@protoc_insertion_point(field_set:NetMsgBus.PBDisconnectNotify.reason_code)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace NetMsgBus
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_NetMsgBus_2ePBParam_2eproto
@@ -0,0 +1,133 @@
+#ifndef  NETMSGBUS_BUSYSTATE_REPORTER_H
+#define  NETMSGBUS_BUSYSTATE_REPORTER_H
+
+#include "msgbus_def.h"
+#include "msgbus_interface.h"
+#include "NetMsgBusServerConnMgr.hpp"
+#include "NetMsgBusReceiverMgr.hpp"
+#include "threadpool.h"
+#include "lock.hpp"
+#include "SimpleLogger.h"
+#include <boost/bind.hpp>
+
+// the local load thresholds of the MIDDLE and HIGH busy state.
+#define BUSYSTATE_QUEUED_MSGS_MIDDLE   100
+#define BUSYSTATE_QUEUED_MSGS_HIGH     1000
+#define BUSYSTATE_HANDLE_US_MIDDLE     10000
+#define BUSYSTATE_HANDLE_US_HIGH       100000
+#define BUSYSTATE_PENDING_BYTES_MIDDLE (1024*1024)
+#define BUSYSTATE_PENDING_BYTES_HIGH   (16*1024*1024)
+
+namespace NetMsgBus
+{
+
+// check the local load of the receiver periodically and report the busy state to the server
+// when it changes. the state goes up as soon as any metric reaches the threshold of a higher
+// state, and goes down only after all the metrics fall below the half of the thresholds, so the
+// state will not flap around the thresholds. UNAVAILABLE is never reported automatically.
+class BusyStateReporter
+{
+public:
+    BusyStateReporter(ServerConnMgr& server_connmgr, ReceiverMgr& receiver_mgr)
+        :m_server_connmgr(server_connmgr),
+        m_receiver_mgr(receiver_mgr),
+        m_timerid(0),
+        m_cur_state(LOW),
+        m_reporting(false),
+        g_log("BusyStateReporter")
+    {
+    }
+    ~BusyStateReporter()
+    {
+        Stop();
+    }
+    bool Start(int interval_sec)
+    {
+        Stop();
+        if(interval_sec <= 0)
+            return true;
+        core::common::locker_guard guard(m_locker);
+        m_cur_state = LOW;
+        m_timerid = threadpool::queue_timer_task(boost::bind(&BusyStateReporter::Check, this), interval_sec, true);
+        return m_timerid != 0;
+    }
+    void Stop()
+    {
+        core::common::locker_guard guard(m_locker);
+        if(m_timerid != 0)
+        {
+            threadpool::deletetimerbyid(m_timerid);
+            m_timerid = 0;
+        }
+    }
+    void Check()
+    {
+        size_t queued_msgs = 0;
+        int64_t avg_handle_us = 0;
+        MsgBusGetLoad(queued_msgs, avg_handle_us);
+        size_t pending_bytes = m_receiver_mgr.GetPendingBytes();
+        // the average is only updated by the handled messages, it means nothing once idle.
+        if(queued_msgs == 0 && pending_bytes == 0)
+            avg_handle_us = 0;
+
+        kServerBusyState oldstate;
+        kServerBusyState newstate;
+        {
+            core::common::locker_guard guard(m_locker);
+            // the report may wait for the server long, the checks during it are skipped.
+            if(m_timerid == 0 || m_reporting)
+                return;
+            oldstate = m_cur_state;
+            newstate = ReachLevel(queued_msgs, avg_handle_us, pending_bytes, 1, 1);
+            if(newstate <= oldstate)
+            {
+                newstate = ReachLevel(queued_msgs, avg_handle_us, pending_bytes, 1, 2);
+                if(newstate >= oldstate)
+                    return;
+            }
+            m_reporting = true;
+        }
+        // report without the lock, so Start and Stop are not blocked by the server.
+        bool success = m_server_connmgr.UpdateReceiverBusyState(newstate);
+        core::common::locker_guard guard(m_locker);
+        m_reporting = false;
+        if(success)
+        {
+            LOG(g_log, core::lv_info, "receiver busy state changed from %d to %d, queued msgs:%zu, handle time:%lldus, pending bytes:%zu.",
+                (int)oldstate, (int)newstate, queued_msgs, (long long)avg_handle_us, pending_bytes);
+            m_cur_state = newstate;
+        }
+    }
+
+private:
+    // the highest state whose thresholds (scaled by num/den) is reached by any metric.
+    static kServerBusyState ReachLevel(size_t queued_msgs, int64_t avg_handle_us, size_t pending_bytes,
+        int num, int den)
+    {
+        if(queued_msgs*den >= (size_t)BUSYSTATE_QUEUED_MSGS_HIGH*num ||
+            avg_handle_us*den >= (int64_t)BUSYSTATE_HANDLE_US_HIGH*num ||
+            pending_bytes*den >= (size_t)BUSYSTATE_PENDING_BYTES_HIGH*num)
+        {
+            return HIGH;
+        }
+        if(queued_msgs*den >= (size_t)BUSYSTATE_QUEUED_MSGS_MIDDLE*num ||
+            avg_handle_us*den >= (int64_t)BUSYSTATE_HANDLE_US_MIDDLE*num ||
+            pending_bytes*den >= (size_t)BUSYSTATE_PENDING_BYTES_MIDDLE*num)
+        {
+            return MIDDLE;
+        }
+        return LOW;
+    }
+
+    ServerConnMgr& m_server_connmgr;
+    ReceiverMgr& m_receiver_mgr;
+    core::common::locker m_locker;
+    int m_timerid;
+    kServerBusyState m_cur_state;
+    bool m_reporting;
+    core::LoggerCategory g_log;
+};
+
+}
+
+#endif // end of NETMSGBUS_BUSYSTATE_REPORTER_H
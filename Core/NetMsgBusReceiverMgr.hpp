@@ -27,6 +27,7 @@
 using std::string;
 #define TIMEOUT_SHORT 5
 #define MAX_SENDMSG_CLIENT_NUM 1024
+#define RECEIVER_LISTEN_BACKLOG 128
 
 using namespace core::net;
 
@@ -38,170 +39,87 @@ class ReceiverMgr
 public:
     ReceiverMgr()
         :m_receiver_running(false),
-        m_receiver_terminate(false)
+        m_receiver_terminate(false),
+        m_pending_bytes(0)
     {
     }
+    // the bytes of the messages received and not handled yet.
+    size_t GetPendingBytes() const
+    {
+        long pending = m_pending_bytes;
+        return pending > 0 ? (size_t)pending : 0;
+    }
     // start receiver at local.
-    bool StartReceiver(unsigned short int& clientport)
+    bool StartReceiver(unsigned short int& clientport, int backlog = RECEIVER_LISTEN_BACKLOG)
     {
-        // first to start local receiving server thread.
-        if(!m_receiver_running)
+        if(m_receiver_running)
+            return false;
+        m_localport = clientport;
+        m_receiver_terminate = false;
+        // the receiver listens in the netmsgbus loop, the clients sending msgs to me will be 
+        // accepted and served by the same loop.
+        TcpSockSmartPtr listen_tcp(new TcpSock());
+        int retry = 10;
+        // the port is used to identify the receiver, so do not share it with other process by reuseport.
+        while(!listen_tcp->Listen("", m_localport, backlog, false))
         {
-            m_localport = clientport;
-            m_receiver_terminate = false;
-            if(0 != pthread_create(&m_receiver_tid, NULL, process_data_from_other_clients_thread_func, 
-                    (void*)this))
+            if(--retry < 0)
             {
-                perror("start the receive thread error.\n");
+                perror("failed to bind the port, start receiver mgr failed.");
                 return false;
             }
-            while(!m_receiver_running)
-            {
-                usleep(10);
-            }
-            clientport = m_localport;
-            return true;
+            ++m_localport;
+            printf("retry next bind port:%d\n", m_localport);
+        }
+
+        SockHandler callback;
+        callback.onAccept = boost::bind(&ReceiverMgr::receiver_onAccept, this, _1);
+        listen_tcp->SetSockHandler(callback);
+        m_sendmsg_clientnum = 0;
+        if(!EventLoopPool::AddTcpSockToLoop(NETMSGBUS_EVLOOP_NAME, listen_tcp))
+        {
+            printf("add receiver listener to event loop failed.\n");
+            listen_tcp->Close();
+            return false;
         }
-        return false;
+        m_listen_tcp = listen_tcp;
+        m_receiver_running = true;
+        clientport = m_localport;
+        return true;
     }
     void StopReceiver()
     {
         m_receiver_terminate = true;
         if(m_receiver_running)
         {
-            pthread_join(m_receiver_tid, NULL);
+            if(m_listen_tcp)
+                m_listen_tcp->Close();
+            m_listen_tcp.reset();
+            m_receiver_running = false;
         }
     }
 
 private:
-    // 响应其他的客户端发送过来的消息数据
-    static void* process_data_from_other_clients_thread_func(void *param)
+    // 响应其他的客户端发送过来的连接, called in the netmsgbus loop.
+    bool receiver_onAccept(TcpSockSmartPtr newtcp)
     {
-        ReceiverMgr* recv_mgr = (ReceiverMgr*)param; 
-        if( recv_mgr == NULL )
-        {
-            throw;
-            return 0;
-        }
-        int receive_server_sockfd;
-        struct sockaddr_in rec_address;
-        receive_server_sockfd = socket(AF_INET, SOCK_STREAM, 0);
-        // set SO_REUSEADDR in order to restart quickly after crash
-        int optval = 1;
-        setsockopt(receive_server_sockfd, SOL_SOCKET, SO_REUSEADDR, &optval, sizeof(optval));
-
-        rec_address.sin_family = AF_INET;
-        rec_address.sin_addr.s_addr = htonl(INADDR_ANY);
-        rec_address.sin_port = htons(recv_mgr->m_localport);
-
-        int ret = -1;
-        int retry = 10;
-        while(ret == -1)
-        {
-            ret = bind(receive_server_sockfd, (sockaddr *)&rec_address, sizeof(rec_address));
-            if(--retry < 0)
-            {
-                perror("failed to bind the port, start receiver mgr failed.");
-                exit(1);
-                return 0;
-            }
-            if(ret == -1)
-            {
-                ++recv_mgr->m_localport;
-                rec_address.sin_port = htons(recv_mgr->m_localport);
-                printf("retry next bind port:%d\n", recv_mgr->m_localport);
-            }
-        }
-        listen(receive_server_sockfd, 5);
-        fd_set readfds;
-        FD_ZERO(&readfds);
-        FD_SET(receive_server_sockfd, &readfds);
-
-        if( !core::utility::set_fd_close_onexec(receive_server_sockfd))
-        {
-            perror("set fd close on exec error.\n");
-            return 0;
-        }
-
-        if( !core::utility::set_fd_nonblock(receive_server_sockfd) )
+        // a new client connected and ready to send msgs to me.
+        if(m_sendmsg_clientnum >= MAX_SENDMSG_CLIENT_NUM)
         {
-            perror("set receiver fd nonblock error.\n");
-            return 0;
+            printf("------too many client connected. please wait for a while.-------\n");
+            return false;
         }
-
+        m_sendmsg_clientnum++;
+        //printf("a new client connected to sendmsg. fd = %d.\n", newtcp->GetFD());
         SockHandler callback;
-        callback.onRead = boost::bind(&ReceiverMgr::receiver_onRead, recv_mgr, _1, _2, _3);
-        callback.onSend = boost::bind(&ReceiverMgr::receiver_onSend, recv_mgr, _1);
-        callback.onClose = boost::bind(&ReceiverMgr::receiver_onClose, recv_mgr, _1);
-        callback.onError = boost::bind(&ReceiverMgr::receiver_onError, recv_mgr, _1);
-        callback.onTimeout = boost::bind(&ReceiverMgr::receiver_onTimeout, recv_mgr, _1);
-
-//#if defined (__APPLE__) || defined (__MACH__) 
-//        boost::shared_ptr<SockWaiterBase> spwaiter(new SelectWaiter());
-//#else
-//        boost::shared_ptr<SockWaiterBase> spwaiter(new EpollWaiter());
-//#endif
-        //EventLoopPool::CreateEventLoop("msg_receiver_loop", spwaiter);
-        // 这里先将正准备接收数据标记置位，如果注册接收服务失败，会把该标记位清除
-        recv_mgr->m_receiver_running = true;
-        //printf("client receiver waiting msgs from clients ...\n");
-
-        recv_mgr->m_sendmsg_clientnum = 0;
-        while(1)
-        {
-            fd_set testfds = readfds;
-            struct timeval tv;
-            tv.tv_sec = TIMEOUT_SHORT;
-            tv.tv_usec = 0;
-
-            int retcode;
-            if(-1 == (retcode = select(receive_server_sockfd + 1, &testfds, 0, 0, &tv)))
-            {
-                perror("client receive server select error.\n");
-                continue;
-            }
-            if(recv_mgr->m_receiver_terminate)
-            {
-                break;
-            }
-            if(retcode == 0)
-            {// timeout
-                continue;
-            }
-            if(FD_ISSET(receive_server_sockfd, &testfds))
-            {
-                // a new client connected and ready to send msgs to me.
-                struct sockaddr_in client_address;
-                int client_len = sizeof(client_address);
-                int client_sockfd = accept(receive_server_sockfd, (struct sockaddr *)&client_address,
-                    (socklen_t *)&client_len);
-                if(client_sockfd >= 0)
-                {
-                    recv_mgr->m_sendmsg_clientnum++;
-                    if(recv_mgr->m_sendmsg_clientnum > MAX_SENDMSG_CLIENT_NUM)
-                    {
-                        printf("------too many client connected. please wait for a while.-------\n");
-                        close(client_sockfd);
-                        continue;
-                    }
-                    //printf("a new client connected to sendmsg. fd = %d.\n", client_sockfd);
-                    //printf("a new client connected to sendmsg:%lld\n", (int64_t)core::utility::GetTickCount());
-                    char ip[INET_ADDRSTRLEN];
-                    TcpSockSmartPtr newtcp(new TcpSock(client_sockfd, 
-                            inet_ntop(AF_INET, &client_address.sin_addr, ip, sizeof(ip)), 
-                            ntohs(client_address.sin_port)));
-                    newtcp->SetSockHandler(callback);
-                    newtcp->SetNonBlock();
-                    newtcp->SetCloseAfterExec();
-                    newtcp->SetTimeout(KEEP_ALIVE_TIME);
-                    EventLoopPool::AddTcpSockToLoop(NETMSGBUS_EVLOOP_NAME, newtcp);
-                }
-            }
-        }
-        close(receive_server_sockfd);
-        //EventLoopPool::TerminateLoop("msg_receiver_loop");
-        recv_mgr->m_receiver_running = false;
-        return 0;
+        callback.onRead = boost::bind(&ReceiverMgr::receiver_onRead, this, _1, _2, _3);
+        callback.onSend = boost::bind(&ReceiverMgr::receiver_onSend, this, _1);
+        callback.onClose = boost::bind(&ReceiverMgr::receiver_onClose, this, _1);
+        callback.onError = boost::bind(&ReceiverMgr::receiver_onError, this, _1);
+        callback.onTimeout = boost::bind(&ReceiverMgr::receiver_onTimeout, this, _1);
+        newtcp->SetSockHandler(callback);
+        newtcp->SetTimeout(KEEP_ALIVE_TIME);
+        return true;
     }
 
     // got a message from other client connection.
@@ -267,7 +185,8 @@ private:
             if(sync_sid != 0)
             {
                 // 调用消息处理函数后，把数据写回
-                threadpool::queue_work_task(boost::bind(NetMsgBusRspSendMsg, sp_tcp, msgcontent, sync_sid), 0);
+                __sync_fetch_and_add(&m_pending_bytes, (long)data_len);
+                threadpool::queue_work_task(boost::bind(&ReceiverMgr::HandleSendMsg, this, sp_tcp, msgcontent, sync_sid), 0);
             }
             size -= needlen;
             readedlen += needlen;
@@ -275,6 +194,12 @@ private:
         }
     }
 
+    void HandleSendMsg(TcpSockSmartPtr sp_tcp, const std::string& msgcontent, uint32_t sync_sid)
+    {
+        NetMsgBusRspSendMsg(sp_tcp, msgcontent, sync_sid);
+        __sync_fetch_and_sub(&m_pending_bytes, (long)msgcontent.size());
+    }
+
     bool receiver_onSend(TcpSockSmartPtr sp_tcp)
     {
         //sp_tcp->SetTimeout(KEEP_ALIVE_TIME);
@@ -310,13 +235,14 @@ private:
 private:
     volatile bool m_receiver_running;
     volatile bool m_receiver_terminate;
-    // the thread running to receive the message from other client.
-    pthread_t m_receiver_tid;
+    // the listening tcp in the netmsgbus loop to accept the message from other client.
+    TcpSockSmartPtr m_listen_tcp;
     //EventLoopPool m_evpool;
     int m_sendmsg_clientnum;
     unsigned short int m_localport;
     // record the validate sender name of the tcp from client 
     boost::unordered_map< int, std::string >  m_client_senders;
+    volatile long m_pending_bytes;
     static const int KEEP_ALIVE_TIME = 120000;
 };
 
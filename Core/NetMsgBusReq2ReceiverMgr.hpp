@@ -171,6 +171,11 @@ public:
         }
         if(dest_ip.empty())
             return ret_future;
+        if(IsReceiverBlocked(dest_ip, dest_port))
+        {
+            errno = EWOULDBLOCK;
+            return ret_future;
+        }
 
         Req2ReceiverTask rtask;
         rtask.data = data;
@@ -194,6 +199,11 @@ public:
             LOG(g_log, lv_debug, "req2receiver not running when post message to receiver.");
             return boost::shared_ptr<NetFuture>();
         }
+        if(IsReceiverSendBlocked(clientname))
+        {
+            errno = EWOULDBLOCK;
+            return boost::shared_ptr<NetFuture>();
+        }
         Req2ReceiverTask rtask;
         rtask.clientname = clientname;
         rtask.data = data;
@@ -206,6 +216,26 @@ public:
         return future.second;
     }
 
+    // the data to the receiver has reached the high water of the tcp, the producer should slow down.
+    bool IsReceiverSendBlocked(const std::string& clientname)
+    {
+        LocalHostInfo destclient;
+        if(!safe_get_cached_host_info(clientname, destclient))
+            return false;
+        return IsReceiverBlocked(destclient.host_ip, destclient.host_port);
+    }
+
+    // batch the postmsg data to the receivers, the sync sendmsg is never batched.
+    void SetPostMsgBatchMode(int window_us, size_t max_batch_bytes)
+    {
+        m_postmsg_client_conn_pool.SetBatchMode(window_us, max_batch_bytes);
+    }
+
+    void FlushPostMsg()
+    {
+        m_postmsg_client_conn_pool.FlushAll();
+    }
+
     bool Start()
     {
         if( m_req2receiver_running )
@@ -356,8 +386,36 @@ private:
         return true;
     }
 
+    void Req2Receiver_onHighWater(TcpSockSmartPtr sp_tcp)
+    {
+        std::string ip;
+        unsigned short int port;
+        if(!sp_tcp->GetDestHost(ip, port))
+            return;
+        LOG(g_log, lv_info, "data to receiver %s:%d reach high water, fd:%d.", ip.c_str(), port, sp_tcp->GetFD());
+        core::common::locker_guard guard(m_blocked_receiver_locker);
+        ++m_blocked_receivers[std::make_pair(ip, port)];
+    }
+    void Req2Receiver_onLowWater(TcpSockSmartPtr sp_tcp)
+    {
+        std::string ip;
+        unsigned short int port;
+        if(!sp_tcp->GetDestHost(ip, port))
+            return;
+        core::common::locker_guard guard(m_blocked_receiver_locker);
+        BlockedReceiverT::iterator it = m_blocked_receivers.find(std::make_pair(ip, port));
+        if(it != m_blocked_receivers.end() && --it->second <= 0)
+            m_blocked_receivers.erase(it);
+    }
+    bool IsReceiverBlocked(const std::string& ip, unsigned short int port)
+    {
+        core::common::locker_guard guard(m_blocked_receiver_locker);
+        return m_blocked_receivers.find(std::make_pair(ip, port)) != m_blocked_receivers.end();
+    }
+
     void Req2Receiver_onClose(TcpSockSmartPtr sp_tcp)
     {
+        // the blocked receiver is released by the onLowWater called when the tcp is closed.
         //printf("req2receiver tcp disconnected.\n");
         m_sendmsg_client_conn_pool.RemoveTcpSock(sp_tcp);
         m_postmsg_client_conn_pool.RemoveTcpSock(sp_tcp);
@@ -386,18 +444,13 @@ private:
         identifytask.data = netmsg_param.paramdata;
         identifytask.data_len = netmsg_param.paramlen;
         string rsp;
-        return WriteTaskDataToReceiver(sp_tcp, identifytask, rsp);
+        return SendTaskDataToReceiver(sp_tcp, identifytask, rsp);
     }
-    bool WriteTaskDataToReceiver(TcpSockSmartPtr sp_tcp, const Req2ReceiverTask& task, string& rsp_content)
+    // only queue the task data to the tcp, never block.
+    bool SendTaskDataToReceiver(TcpSockSmartPtr sp_tcp, const Req2ReceiverTask& task, string& rsp_content)
     {
-        char syncflag = 0;
+        char syncflag = task.sync ? 1 : 0;
         uint32_t waiting_futureid = task.future_id;
-        boost::shared_ptr<NetFuture> cur_sendmsg_rsp;
-        if(task.sync)
-        {
-            syncflag = 1;
-            cur_sendmsg_rsp = future_mgr_.safe_get_future(waiting_futureid);
-        }
         //g_log.Log(lv_debug, "begin send data to receiver:%lld, sid:%u, datalen:%d, fd:%d", (int64_t)core::utility::GetTickCount(),
         //    task.future_id, 9 + task.data_len, sp_tcp->GetFD());
         uint32_t write_len = sizeof(syncflag) + sizeof(waiting_futureid) + sizeof(task.data_len) + task.data_len;
@@ -415,23 +468,74 @@ private:
             future_mgr_.safe_remove_future(waiting_futureid);
             return false;
         }
+        return true;
+    }
+    bool WriteTaskDataToReceiver(TcpSockSmartPtr sp_tcp, const Req2ReceiverTask& task, string& rsp_content)
+    {
+        boost::shared_ptr<NetFuture> cur_sendmsg_rsp;
+        if(task.sync)
+            cur_sendmsg_rsp = future_mgr_.safe_get_future(task.future_id);
+        if(!SendTaskDataToReceiver(sp_tcp, task, rsp_content))
+            return false;
         // 如果要求同步发送， 则等待
-        bool result = true;
         if(task.sync)
+            return WaitTaskRsp(cur_sendmsg_rsp, task, rsp_content);
+        return true;
+    }
+    bool WaitTaskRsp(boost::shared_ptr<NetFuture> cur_sendmsg_rsp, const Req2ReceiverTask& task, string& rsp_content)
+    {
+        if(!cur_sendmsg_rsp)
         {
-            if(!cur_sendmsg_rsp)
-            {
-                LOG(g_log, lv_warn, "get future session failed: %u.", waiting_futureid);
-                result = false;
-            }
-            else
-                result = cur_sendmsg_rsp->get(task.timeout, rsp_content);
-            //g_log.Log(lv_debug, "end send sync data to client:%lld, sid:%u\n", (int64_t)core::utility::GetTickCount(), waiting_futureid);
-            // future will erase in on-read event.
-            //core::common::locker_guard guard(m_rsp_sendmsg_lock);
-            //m_sendmsg_rsp_container.erase(waiting_futureid);
+            LOG(g_log, lv_warn, "get future session failed: %u.", task.future_id);
+            return false;
+        }
+        //g_log.Log(lv_debug, "end send sync data to client:%lld, sid:%u\n", (int64_t)core::utility::GetTickCount(), waiting_futureid);
+        // future will erase in on-read event.
+        if(!cur_sendmsg_rsp->get(task.timeout, rsp_content))
+            return false;
+        return !cur_sendmsg_rsp->has_err();
+    }
+
+    // 连接失败很可能是缓存的信息已经失效，因此我们把它加到等待列表中，并向服务器请求新的信息
+    bool HandleConnectReceiverFailed(const Req2ReceiverTask& task)
+    {
+        if(task.retry)
+        {
+            safe_queue_waiting_task(task);
+            safe_remove_cached_host_info(task.clientname);
+            if(m_server_connmgr)
+                m_server_connmgr->ReqReceiverInfo(task.clientname, boost::bind(&Req2ReceiverMgr::HandleRspGetClient, this, _1));
+            return true;
+        }
+        LOG(g_log, lv_warn, "error connect to receiver client. %s:%d", task.dest_client.host_ip.c_str(), task.dest_client.host_port);
+        PostMsg("netmsgbus.client.connectreceiver.failed", CustomType2Param(task.clientname));
+        if(task.sync)
+        {
+            // wake up the waiting sync sender.
+            boost::shared_ptr<NetFuture> cur_sendmsg_rsp = future_mgr_.safe_get_future(task.future_id);
+            if(cur_sendmsg_rsp)
+                cur_sendmsg_rsp->set_error("connect to receiver failed.");
+        }
+        future_mgr_.safe_remove_future(task.future_id);
+        return false;
+    }
+
+    // called while the connect to the receiver finished, in the loop thread or the caller thread, 
+    // so must not block here.
+    void OnReceiverTcpReady(TcpSockSmartPtr sp_tcp, const Req2ReceiverTask& task)
+    {
+        if(!sp_tcp)
+        {
+            HandleConnectReceiverFailed(task);
+            return;
+        }
+        std::string tmp;
+        if(!SendTaskDataToReceiver(sp_tcp, task, tmp) && task.sync)
+        {
+            boost::shared_ptr<NetFuture> cur_sendmsg_rsp = future_mgr_.safe_get_future(task.future_id);
+            if(cur_sendmsg_rsp)
+                cur_sendmsg_rsp->set_error(tmp);
         }
-        return result;
     }
 
     // 处理特定的到某个客户端的请求,retry stand for if failed to send the data , whether to update the client host info and resend the data.
@@ -484,47 +588,32 @@ private:
             callback.onSend = boost::bind(&Req2ReceiverMgr::Req2Receiver_onSend, this, _1);
             callback.onClose = boost::bind(&Req2ReceiverMgr::Req2Receiver_onClose, this, _1);
             callback.onError = boost::bind(&Req2ReceiverMgr::Req2Receiver_onError, this, _1);
+            callback.onHighWater = boost::bind(&Req2ReceiverMgr::Req2Receiver_onHighWater, this, _1);
+            callback.onLowWater = boost::bind(&Req2ReceiverMgr::Req2Receiver_onLowWater, this, _1);
 
             std::string loopname;
             if(task.sync)
             {
-                g_log.Log(lv_info, "NULL event waiter. use the default netmsgbus eventloop in the pool.");
                 loopname = NETMSGBUS_EVLOOP_NAME;
             }
             else
             {
                 loopname = "postmsg_event_loop";
             }
-            // first identify me to the receiver.
-            //IdentiySelfToReceiver(newtcp);
-            bool ret;
-            ret = pclient_conn_pool->CreateTcpSock(loopname, destclient.host_ip, destclient.host_port, CLIENT_POOL_SIZE, 
-                task.timeout, callback, boost::bind(&Req2ReceiverMgr::IdentiySelfToReceiver, this, _1));
-            if(!ret)
-            {
-                // 连接失败很可能是缓存的信息已经失效，因此我们把它加到等待列表中，并向服务器请求新的信息
-                if(task.retry)
-                {
-                    safe_queue_waiting_task(task);
-                    safe_remove_cached_host_info(task.clientname);
-                    if(m_server_connmgr)
-                        m_server_connmgr->ReqReceiverInfo(task.clientname, boost::bind(&Req2ReceiverMgr::HandleRspGetClient, this, _1));
-                }
-                else
-                {
-                    perror("error connect to receiver client.\n");
-                    PostMsg("netmsgbus.client.connectreceiver.failed", CustomType2Param(task.clientname));
-                    future_mgr_.safe_remove_future(task.future_id);
-                    return false;
-                }
-                return true;
-            }
-            newtcp = pclient_conn_pool->GetTcpSockByDestHost(destclient.host_ip, destclient.host_port);
-            if(!newtcp)
-            {
-                future_mgr_.safe_remove_future(task.future_id);
-                return false;
-            }
+            Req2ReceiverTask parked_task(task);
+            parked_task.dest_client = destclient;
+            boost::shared_ptr<NetFuture> cur_sendmsg_rsp;
+            if(task.sync)
+                cur_sendmsg_rsp = future_mgr_.safe_get_future(task.future_id);
+            // the task is parked until the connection is up, the connects are done in the loop,
+            // so this thread can go on to process the tasks to other receivers.
+            // first identify me to the receiver after connected.
+            pclient_conn_pool->AsyncGetTcpSock(loopname, destclient.host_ip, destclient.host_port, CLIENT_POOL_SIZE, 
+                task.timeout, callback, boost::bind(&Req2ReceiverMgr::IdentiySelfToReceiver, this, _1),
+                boost::bind(&Req2ReceiverMgr::OnReceiverTcpReady, this, _1, parked_task));
+            if(task.sync)
+                return WaitTaskRsp(cur_sendmsg_rsp, task, rsp_content);
+            return true;
         }
         if(WriteTaskDataToReceiver(newtcp, task, rsp_content))
         {
@@ -618,6 +707,35 @@ private:
         core::common::locker_guard guard(m_cached_receiver_locker);
         m_cached_client_info.erase(clientname);
     }
+public:
+    // update the cached host of the service by the receivers pushed from the server. the cached
+    // one is kept if it is still available, so the connections to it are reused, otherwise the
+    // least busy one is chosen, starting at a random one to spread the clients.
+    void UpdateCachedHostInfo(const std::string& clientname, const std::vector<ClientHost>& hosts)
+    {
+        core::common::locker_guard guard(m_cached_receiver_locker);
+        LocalHostContainerT::iterator it = m_cached_client_info.find(clientname);
+        const ClientHost* besthost = NULL;
+        size_t start = hosts.empty() ? 0 : rand() % hosts.size();
+        for(size_t i = 0; i < hosts.size(); ++i)
+        {
+            const ClientHost& host = hosts[(start + i) % hosts.size()];
+            if(host.state() == UNAVAILABLE || host.port() == 0)
+                continue;
+            if(it != m_cached_client_info.end() && it->second.host_ip == host.ip() &&
+                it->second.host_port == host.port())
+            {
+                return;
+            }
+            if(besthost == NULL || host.state() < besthost->state())
+                besthost = &host;
+        }
+        if(besthost)
+            m_cached_client_info[clientname] = LocalHostInfo(besthost->ip(), besthost->port());
+        else if(it != m_cached_client_info.end())
+            m_cached_client_info.erase(it);
+    }
+private:
 
     pthread_t m_req2receiver_tid;
 
@@ -634,6 +752,10 @@ private:
     LocalHostContainerT m_cached_client_info;
 
     core::common::locker    m_cached_receiver_locker;
+    typedef std::map< std::pair<std::string, unsigned short int>, int > BlockedReceiverT;
+    // the receivers with the number of the tcps which reach the high water.
+    BlockedReceiverT m_blocked_receivers;
+    core::common::locker    m_blocked_receiver_locker;
     core::common::locker    m_waitingtask_locker;
 
     FutureMgr future_mgr_;
@@ -17,6 +17,8 @@
 #include <google/protobuf/descriptor.h>
 #include <map>
 #include <string>
+#include <vector>
+#include <algorithm>
 #include <netinet/in.h>
 #include <time.h>
 #include <arpa/inet.h>
@@ -69,6 +71,8 @@ private:
 };
 
 typedef std::map<string, boost::shared_ptr<PBHandlerBase> > PBHandlerContainerT;
+// called with the current receivers of the service pushed by the server, empty if removed.
+typedef boost::function<void(const std::string& service_name, const std::vector<ClientHost>& hosts)> ServiceChangeHandlerT;
 
 // the server connection of the local message receiver client, each receiver will hold one 
 // server connection to communicate some control message with the message bus server.
@@ -76,7 +80,8 @@ class ServerConnMgr
 {
 public:
     ServerConnMgr()
-        :m_server_connecting(false),
+        :m_compress_min_bytes(0),
+        m_server_connecting(false),
         m_isreceiver_registered(false),
         g_log("ServerConnMgr")
     {
@@ -88,6 +93,10 @@ public:
         m_allrsphandlers[RSP_CONFIRM_ALIVE] = &ServerConnMgr::HandleRspConfirmAlive;
         m_allrsphandlers[BODY_PBTYPE] = &ServerConnMgr::HandleRspPBBody;
         regist_pbdata_handler<NetMsgBus::PBQueryServicesRsp>(boost::bind(&ServerConnMgr::HandleQueryServicesRsp, this, _1, _2));
+        regist_pbdata_handler<NetMsgBus::PBServiceChangeNotify>(boost::bind(&ServerConnMgr::HandleServiceChangeNotify, this, _1, _2));
+        regist_pbdata_handler<NetMsgBus::PBQueryMessagesRsp>(boost::bind(&ServerConnMgr::HandleQueryMessagesRsp, this, _1, _2));
+        regist_pbdata_handler<NetMsgBus::PBRegisterServicesRsp>(boost::bind(&ServerConnMgr::HandleRegisterServicesRsp, this, _1, _2));
+        regist_pbdata_handler<NetMsgBus::PBDisconnectNotify>(boost::bind(&ServerConnMgr::HandleDisconnectNotify, this, _1, _2));
     }
     ~ServerConnMgr()
     {
@@ -104,35 +113,29 @@ public:
         return true;
     }
 
-    size_t ServerRspProcess(TcpSockSmartPtr sp_tcp, const char* pdata, size_t size)
+    size_t ServerRspProcess(boost::shared_ptr<MsgBusWireCodec> codec, TcpSockSmartPtr sp_tcp, const char* pdata, size_t size)
     {
         size_t readedlen = 0;
         while(true)
         {
-            size_t needlen;
-            needlen = sizeof(MsgBusPackHead);
-            if(size < needlen)
+            MsgBusPackHead head;
+            const char* body = NULL;
+            int framelen = codec->DecodeFrame(pdata, size, head, body);
+            if(framelen == 0)
             {
                 return readedlen;
             }
-            MsgBusPackHead head;
-            if (-1 == head.UnPackHead(pdata))
+            if(framelen < 0)
             {
                 printf("unpack head error.\n");
-                return size;
-            }
-            pdata += sizeof(MsgBusPackHead);
-            needlen += head.body_len;
-            if(size < needlen )
-            {
-                return readedlen;
+                return readedlen + size;
             }
-            std::string server_rsp_body(pdata, head.body_len);
+            std::string server_rsp_body(body, head.body_len);
             ProcessRspBody(head.msg_id, head.body_type, server_rsp_body);
 
-            size -= needlen;
-            readedlen += needlen;
-            pdata += head.body_len;
+            size -= framelen;
+            readedlen += framelen;
+            pdata += framelen;
         }
     }
     void onServerTcpClose(TcpSockSmartPtr sp_tcp)
@@ -154,8 +157,7 @@ public:
         req.alive_flag = 0;
         boost::shared_array<char> buf(new char[req.Size()]);
         req.PackData(buf.get());
-        if(sp_tcp)
-            sp_tcp->SendData(buf.get(), req.Size());
+        SendFrameToServer(sp_tcp, buf.get(), req.Size());
     }
     bool StartServerCommunicateLoop(const std::string& serverip, unsigned short int serverport)
     {
@@ -175,8 +177,15 @@ public:
             return false;
         }
         m_server_connecting = true;
+        // each connection negotiates the protocol version from the beginning.
+        boost::shared_ptr<MsgBusWireCodec> codec(new MsgBusWireCodec());
+        codec->SetCompressThreshold(m_compress_min_bytes);
+        {
+            core::common::locker_guard guard(m_server_send_locker);
+            m_server_codec = codec;
+        }
         SockHandler callback;
-        callback.onRead = boost::bind(&ServerConnMgr::ServerRspProcess, this, _1, _2, _3);
+        callback.onRead = boost::bind(&ServerConnMgr::ServerRspProcess, this, codec, _1, _2, _3);
         callback.onSend = boost::bind(&ServerConnMgr::onServerSendReady, this, _1);
         callback.onClose = boost::bind(&ServerConnMgr::onServerTcpClose, this, _1);
         callback.onError = boost::bind(&ServerConnMgr::onServerTcpError, this, _1);
@@ -350,6 +359,81 @@ public:
         }
     }
 
+    void HandleQueryMessagesRsp(uint32_t msg_id, PBQueryMessagesRsp* pbrsp)
+    {
+        std::string message_name;
+        google::protobuf::RepeatedPtrField<std::string>::const_iterator cit = pbrsp->message_name().begin();
+        while(cit != pbrsp->message_name().end())
+        {
+            message_name += *cit + ",";
+            ++cit;
+        }
+        LOG(g_log, lv_debug, "msgid:%d, messages of service %s:%s", msg_id, pbrsp->service_name().c_str(), message_name.c_str());
+        boost::shared_ptr<NetFuture> ready_rsp = future_mgr_.safe_get_future(msg_id, true);
+        if(ready_rsp)
+        {
+            ready_rsp->set_result(message_name);
+        }
+    }
+
+    // the server is going to disconnect this client, the relayed messages were not received in time.
+    void HandleDisconnectNotify(uint32_t msg_id, PBDisconnectNotify* notify)
+    {
+        LOG(g_log, lv_warn, "disconnected by the server, reason:%d.", notify->reason_code());
+    }
+
+    void HandleRegisterServicesRsp(uint32_t msg_id, PBRegisterServicesRsp* pbrsp)
+    {
+        std::string errmsg;
+        for(int i = 0; i < pbrsp->failed_service_name_size(); ++i)
+        {
+            errmsg += pbrsp->failed_service_name(i) + ":" + (i < pbrsp->err_msg_size() ? pbrsp->err_msg(i) : "") + ",";
+        }
+        boost::shared_ptr<NetFuture> ready_rsp = future_mgr_.safe_get_future(msg_id, true);
+        if(ready_rsp)
+        {
+            if(errmsg.empty())
+                ready_rsp->set_result("success");
+            else
+                ready_rsp->set_error(errmsg);
+        }
+    }
+
+    // the snapshot responded to the subscribing with msg_id, or the changes pushed with msg_id 0,
+    // or the receivers responded to the batched getting clients.
+    void HandleServiceChangeNotify(uint32_t msg_id, PBServiceChangeNotify* notify)
+    {
+        ServiceChangeHandlerT handler;
+        {
+            core::common::locker_guard guard(m_service_change_locker);
+            handler = m_service_change_handler;
+        }
+        for(int i = 0; i < notify->service_info_size() && handler; ++i)
+        {
+            const PBServiceClients& service_info = notify->service_info(i);
+            std::vector<ClientHost> hosts;
+            for(int j = 0; j < service_info.client_info_size(); ++j)
+            {
+                const PBClientInfo& client_info = service_info.client_info(j);
+                uint32_t ip = client_info.client_ip();
+                char ipstr[INET_ADDRSTRLEN] = {0};
+                inet_ntop(AF_INET, &ip, ipstr, sizeof(ipstr));
+                ClientHost host(ipstr, client_info.client_port());
+                host.set_state((kServerBusyState)client_info.client_state());
+                hosts.push_back(host);
+            }
+            LOG(g_log, lv_debug, "service %s changed, %zu receivers.", service_info.service_name().c_str(), hosts.size());
+            handler(service_info.service_name(), hosts);
+        }
+        if(msg_id == 0)
+            return;
+        boost::shared_ptr<NetFuture> ready_sendmsg_rsp = future_mgr_.safe_get_future(msg_id, true);
+        if(ready_sendmsg_rsp)
+        {
+            ready_sendmsg_rsp->set_result("success");
+        }
+    }
+
     void HandleUnknown(uint32_t msg_id, const std::string& rsp_body)
     {
         LOG(g_log, lv_warn, "receive a unknown rsp from msgbus server.");
@@ -386,7 +470,7 @@ public:
         assert(m_server_tcp);
         if(m_server_tcp)
         {
-            bool ret = m_server_tcp->SendData(outbuffer.get(), reg_req.Size());
+            bool ret = SendFrameToServer(m_server_tcp, outbuffer.get(), reg_req.Size());
             if (!ret)
                 return false;
             std::string rsp;
@@ -402,12 +486,83 @@ public:
             return false;
     }
     bool UnRegisterNetMsgBusReceiver()
+    {
+        if(!m_server_connecting)
+            return false;
+        std::vector<std::string> service_names;
+        {
+            core::common::locker_guard guard(m_service_names_locker);
+            service_names.swap(m_service_names);
+        }
+        for(size_t i = 0; i < service_names.size(); ++i)
+            UnRegisterService(service_names[i]);
+        return UnRegisterService(m_receiver_name);
+    }
+    // 更新某个已经注册过的消息接收客户端的工作状态，以便服务器根据负载状态动态选择
+    // 如果没找到需要更新的客户端名字会返回错误
+    bool UpdateReceiverBusyState(kServerBusyState busy_state)
+    {
+        if( !m_isreceiver_registered )
+            return false;
+        if(!RegisterNetMsgBusReceiver(m_receiver_ip, m_receiver_port, m_receiver_name, busy_state))
+            return false;
+        std::vector<std::string> service_names;
+        {
+            core::common::locker_guard guard(m_service_names_locker);
+            service_names = m_service_names;
+        }
+        return service_names.empty() || RegisterServices(service_names, busy_state);
+    }
+    // register the receiver as more services in one request, the receiver must be registered
+    // before. the busy state of all the services is updated together with the receiver.
+    bool RegisterServices(const std::vector<std::string>& service_names, kServerBusyState busy_state = LOW)
+    {
+        if(!m_server_connecting || !m_isreceiver_registered)
+        {
+            LOG(g_log, lv_debug, "server not connecting or receiver not registered while register services.");
+            return false;
+        }
+        PBRegisterServicesReq pbreq;
+        for(size_t i = 0; i < service_names.size(); ++i)
+        {
+            assert(service_names[i].size() < MAX_SERVICE_NAME);
+            *pbreq.add_service_name() = service_names[i];
+        }
+        uint32_t ip = 0;
+        if(m_receiver_ip != "")
+            inet_pton(AF_INET, m_receiver_ip.c_str(), &ip);
+        pbreq.mutable_client_info()->set_client_ip(ip);
+        pbreq.mutable_client_info()->set_client_port(m_receiver_port);
+        pbreq.mutable_client_info()->set_client_state(busy_state);
+
+        std::pair<uint32_t, boost::shared_ptr<NetFuture> > future = future_mgr_.safe_insert_future();
+        if(!SendPBReqToServer(m_server_tcp, future.first, pbreq))
+        {
+            future_mgr_.safe_remove_future(future.first);
+            return false;
+        }
+        std::string rsp;
+        bool ret = future.second->get(SERVER_CALL_TIMEOUT, rsp);
+        if (!ret || future.second->has_err())
+        {
+            LOG(g_log, lv_warn, "register services failed.msgid:%d, err:%s", future.first, rsp.c_str());
+            return false;
+        }
+        core::common::locker_guard guard(m_service_names_locker);
+        for(size_t i = 0; i < service_names.size(); ++i)
+        {
+            if(std::find(m_service_names.begin(), m_service_names.end(), service_names[i]) == m_service_names.end())
+                m_service_names.push_back(service_names[i]);
+        }
+        return true;
+    }
+    bool UnRegisterService(const std::string& service_name)
     {
         if(!m_server_connecting)
             return false;
         MsgBusUnRegisterReq unreg_req;
-        strncpy(unreg_req.service_name, m_receiver_name.c_str(), MAX_SERVICE_NAME);
-        unreg_req.service_name[m_receiver_name.size()] = '\0';
+        strncpy(unreg_req.service_name, service_name.c_str(), MAX_SERVICE_NAME);
+        unreg_req.service_name[service_name.size()] = '\0';
         ClientHost host;
         if(m_receiver_ip != "")
         {
@@ -420,30 +575,43 @@ public:
         assert(m_server_tcp);
         if(m_server_tcp)
         {
-            bool success = m_server_tcp->SendData(outbuffer.get(), unreg_req.Size());
-            if(success)
+            bool success = SendFrameToServer(m_server_tcp, outbuffer.get(), unreg_req.Size());
+            if(success && service_name == m_receiver_name)
                 m_isreceiver_registered = false;
             return success;
         }
         return false;
     }
-    // 更新某个已经注册过的消息接收客户端的工作状态，以便服务器根据负载状态动态选择
-    // 如果没找到需要更新的客户端名字会返回错误
-    bool UpdateReceiverBusyState(kServerBusyState busy_state)
+
+    // compress the messages to server not less than min_bytes if the server supports, 0 to disable.
+    // the compression runs in the thread sending the message.
+    void SetCompressThreshold(uint32_t min_bytes)
     {
-        if( !m_isreceiver_registered )
-            return false;
-        return RegisterNetMsgBusReceiver(m_receiver_ip, m_receiver_port, 
-                m_receiver_name, busy_state);
+        core::common::locker_guard guard(m_server_send_locker);
+        m_compress_min_bytes = min_bytes;
+        if(m_server_codec)
+            m_server_codec->SetCompressThreshold(min_bytes);
+    }
+
+    // the data to server has reached the high water, the relay message will be refused.
+    bool IsServerSendBlocked()
+    {
+        TcpSockSmartPtr server_tcp = m_server_tcp;
+        return server_tcp && server_tcp->IsHighWater();
     }
 
-    // 使用服务器中转发送消息
+    // 使用服务器中转发送消息, 发送缓冲区达到高水位时返回false, 并设置errno为EWOULDBLOCK
     bool PostNetMsgUseServerRelay(const std::string& clientname, uint32_t data_len, boost::shared_array<char> data)
     {
         if(!m_server_connecting)
         {
             return false;
         }
+        if(IsServerSendBlocked())
+        {
+            errno = EWOULDBLOCK;
+            return false;
+        }
         MsgBusSendMsgReq sendmsg_req;
         assert(clientname.size() < MAX_SERVICE_NAME);
         strncpy(sendmsg_req.dest_name, clientname.c_str(), MAX_SERVICE_NAME);
@@ -462,9 +630,14 @@ public:
         assert(m_server_tcp);
         if(m_server_tcp)
         {
-            bool ret = m_server_tcp->SendData(req_data.get(), sendmsg_req.Size());
+            bool ret = SendFrameToServer(m_server_tcp, req_data.get(), sendmsg_req.Size());
             if (!ret)
+            {
+                future_mgr_.safe_remove_future(future.first);
+                if(m_server_tcp->GetLastError() == EWOULDBLOCK)
+                    errno = EWOULDBLOCK;
                 return false;
+            }
             std::string rsp;
             ret = future.second->get(SERVER_CALL_TIMEOUT, rsp);
             if (!ret || future.second->has_err())
@@ -490,6 +663,34 @@ public:
         return ReqReceiverInfo(clientname, ip, port, NULL);
     }
 
+    // resolve the services in one request, all the receivers of them are given to the service
+    // change handler to update the cache.
+    bool ReqReceiversInfo(const std::vector<std::string>& clientnames)
+    {
+        if(!m_server_connecting)
+        {
+            LOG(g_log, lv_debug, "server not connecting while req receivers info.");
+            return false;
+        }
+        std::pair<uint32_t, boost::shared_ptr<NetFuture> > future = future_mgr_.safe_insert_future();
+        PBGetClientsReq pbreq;
+        for(size_t i = 0; i < clientnames.size(); ++i)
+            *pbreq.add_service_name() = clientnames[i];
+        if(!SendPBReqToServer(m_server_tcp, future.first, pbreq))
+        {
+            future_mgr_.safe_remove_future(future.first);
+            return false;
+        }
+        std::string rsp;
+        bool ret = future.second->get(SERVER_CALL_TIMEOUT, rsp);
+        if (!ret || future.second->has_err())
+        {
+            LOG(g_log, lv_warn, "req receivers info failed.msgid:%d, err:%s", future.first, rsp.c_str());
+            return false;
+        }
+        return true;
+    }
+
     bool QueryAvailableServices(const std::string& match_str, std::string& rsp)
     {
         if(!m_server_connecting)
@@ -518,7 +719,7 @@ public:
         assert(m_server_tcp);
         if(m_server_tcp)
         {
-            bool ret = m_server_tcp->SendData(req_data.get(), services_query.Size());
+            bool ret = SendFrameToServer(m_server_tcp, req_data.get(), services_query.Size());
             if (!ret)
                 return false;
             ret = future.second->get(SERVER_CALL_TIMEOUT, rsp);
@@ -532,7 +733,114 @@ public:
         return false;
     }
 
+    void SetServiceChangeHandler(const ServiceChangeHandlerT& handler)
+    {
+        core::common::locker_guard guard(m_service_change_locker);
+        m_service_change_handler = handler;
+    }
+
+    // subscribe the changes of the services with the prefix, return after the current receivers
+    // of the matched services are given to the service change handler.
+    bool SubscribeServices(const std::string& match_prefix, bool unsubscribe)
+    {
+        if(!m_server_connecting)
+        {
+            LOG(g_log, lv_debug, "server not connecting while subscribe services.");
+            return false;
+        }
+        std::pair<uint32_t, boost::shared_ptr<NetFuture> > future = future_mgr_.safe_insert_future();
+        PBSubscribeServicesReq pbreq;
+        pbreq.set_match_prefix(match_prefix);
+        pbreq.set_unsubscribe(unsubscribe);
+        if(!SendPBReqToServer(m_server_tcp, future.first, pbreq))
+        {
+            future_mgr_.safe_remove_future(future.first);
+            return false;
+        }
+        std::string rsp;
+        bool ret = future.second->get(SERVER_CALL_TIMEOUT, rsp);
+        if (!ret || future.second->has_err())
+        {
+            LOG(g_log, lv_warn, "subscribe services failed.msgid:%d, err:%s", future.first, rsp.c_str());
+            return false;
+        }
+        return true;
+    }
+
+    // tell the server the messages handled by this client, so only the broadcasts of them are sent
+    // to it. no response, the broadcasts sent after it by this client are filtered already.
+    bool AdvertiseMessages(const std::vector<std::string>& msgids, const std::vector<std::string>& msgid_prefixes)
+    {
+        if(!m_server_connecting)
+        {
+            LOG(g_log, lv_debug, "server not connecting while advertise messages.");
+            return false;
+        }
+        PBAdvertiseMessagesReq pbreq;
+        for(size_t i = 0; i < msgids.size(); ++i)
+            *pbreq.add_message_name() = msgids[i];
+        for(size_t i = 0; i < msgid_prefixes.size(); ++i)
+            *pbreq.add_message_prefix() = msgid_prefixes[i];
+        return SendPBReqToServer(m_server_tcp, 0, pbreq);
+    }
+
+    // query the messages advertised by the service, the names are separated by ',' and the
+    // prefixes end with '*'.
+    bool QueryServiceMessages(const std::string& service_name, const std::string& match_prefix, std::string& rsp)
+    {
+        if(!m_server_connecting)
+        {
+            LOG(g_log, lv_debug, "server not connecting while query service messages.");
+            return false;
+        }
+        std::pair<uint32_t, boost::shared_ptr<NetFuture> > future = future_mgr_.safe_insert_future();
+        PBQueryMessagesReq pbreq;
+        pbreq.set_service_name(service_name);
+        pbreq.set_match_prefix(match_prefix);
+        if(!SendPBReqToServer(m_server_tcp, future.first, pbreq))
+        {
+            future_mgr_.safe_remove_future(future.first);
+            return false;
+        }
+        bool ret = future.second->get(SERVER_CALL_TIMEOUT, rsp);
+        if (!ret || future.second->has_err())
+        {
+            LOG(g_log, lv_warn, "query service messages failed.msgid:%d, err:%s", future.first, rsp.c_str());
+            return false;
+        }
+        return true;
+    }
+
 private:
+    bool SendPBReqToServer(TcpSockSmartPtr sp_tcp, uint32_t msg_id, const google::protobuf::Message& pbreq)
+    {
+        MsgBusPackPBType pbpack;
+        pbpack.msg_id = msg_id;
+        std::string pbtype = pbreq.GetDescriptor()->full_name();
+        pbpack.pbtype_len = pbtype.size() + 1;
+        pbtype.push_back('\0');
+        int pbsize = pbreq.ByteSize();
+        boost::shared_array<char> pbdata(new char[pbsize]);
+        pbreq.SerializeToArray(pbdata.get(), pbsize);
+        pbpack.pbdata_len = pbsize;
+        pbpack.SetVarData(&pbtype[0], pbdata.get());
+
+        boost::shared_array<char> req_data(new char[pbpack.Size()]);
+        pbpack.PackData(req_data.get());
+        return SendFrameToServer(sp_tcp, req_data.get(), pbpack.Size());
+    }
+    // send the packed v1 frame to the server, the frame is encoded to the compact v2 frame if the
+    // server supports. the lock keeps the interned names sent in the same order as they are assigned.
+    bool SendFrameToServer(TcpSockSmartPtr sp_tcp, const char* frame, uint32_t frame_len)
+    {
+        if(!sp_tcp)
+            return false;
+        core::common::locker_guard guard(m_server_send_locker);
+        std::string compact_frame;
+        if(m_server_codec && m_server_codec->EncodeFrame(frame, frame_len, compact_frame))
+            return sp_tcp->SendData(compact_frame.data(), compact_frame.size());
+        return sp_tcp->SendData(frame, frame_len);
+    }
     template<typename T> void regist_pbdata_handler(const typename PBHandlerT<T>::PBHandlerCB& cb)
     {
         boost::shared_ptr<PBHandlerT<T> > pbh(new PBHandlerT<T>(cb));
@@ -557,7 +865,7 @@ private:
         assert(m_server_tcp);
         if(m_server_tcp)
         {
-            bool ret = m_server_tcp->SendData(req_data.get(), get_client_req.Size());
+            bool ret = SendFrameToServer(m_server_tcp, req_data.get(), get_client_req.Size());
             if (!ret)
                 return false;
             if (cb == NULL)
@@ -589,6 +897,9 @@ private:
 
     //EventLoopPool m_evpool;
     TcpSockSmartPtr m_server_tcp;
+    boost::shared_ptr<MsgBusWireCodec> m_server_codec;
+    core::common::locker m_server_send_locker;
+    uint32_t m_compress_min_bytes;
     std::string m_serverip;
     unsigned short int m_serverport;
     // 该服务器连接对应的消息总线接收者的信息，每个服务器连接对应唯一的一个接收者
@@ -598,12 +909,17 @@ private:
     unsigned short int m_receiver_port;
     volatile bool m_server_connecting;
     bool m_isreceiver_registered;
+    // the other services registered by the receiver besides m_receiver_name.
+    std::vector<std::string> m_service_names;
+    core::common::locker m_service_names_locker;
     typedef void (ServerConnMgr::*RspBodyHandlerFunc)(uint32_t msg_id, const std::string& rsp_body);
     typedef std::map< int, RspBodyHandlerFunc > RspBodyHandlerContainerT;
     RspBodyHandlerContainerT  m_allrsphandlers;
     const static int KEEP_ALIVE_TIME = 30000; //  keep tcp alive
     LoggerCategory g_log;
     PBHandlerContainerT m_pb_handlers;
+    ServiceChangeHandlerT m_service_change_handler;
+    core::common::locker m_service_change_locker;
     FutureMgr future_mgr_;
 };
 }
@@ -0,0 +1,210 @@
+#ifndef  CORE_COMMON_RADIXTRIE_H
+#define  CORE_COMMON_RADIXTRIE_H
+
+#include <string>
+#include <map>
+#include <boost/shared_ptr.hpp>
+
+namespace core { namespace common {
+
+// an immutable radix trie from string keys to the shared values. Set returns a new trie which
+// copies only the nodes on the path of the key and shares all the other nodes with the old one,
+// so the writer can build a new version while the readers are still using the old version
+// without any lock. the lookups cost O(key length) plus the matched nodes.
+template <typename T> class RadixTrie
+{
+public:
+    typedef boost::shared_ptr<const T> ValuePtr;
+
+private:
+    struct Node;
+    typedef boost::shared_ptr<const Node> NodePtr;
+    typedef std::map<char, NodePtr> ChildrenT;
+    struct Node
+    {
+        // the label of the edge from the parent, empty for the root.
+        std::string label;
+        ValuePtr value;
+        ChildrenT children;
+    };
+
+public:
+    RadixTrie()
+        :m_root(new Node()),
+        m_size(0)
+    {
+    }
+    size_t Size() const
+    {
+        return m_size;
+    }
+    bool Empty() const
+    {
+        return m_size == 0;
+    }
+    ValuePtr Find(const std::string& key) const
+    {
+        const Node* node = m_root.get();
+        size_t pos = 0;
+        while(pos < key.size())
+        {
+            typename ChildrenT::const_iterator cit = node->children.find(key[pos]);
+            if(cit == node->children.end())
+                return ValuePtr();
+            node = cit->second.get();
+            if(key.compare(pos, node->label.size(), node->label) != 0)
+                return ValuePtr();
+            pos += node->label.size();
+        }
+        return node->value;
+    }
+    // return a new trie with the value of key replaced, a null value removes the key.
+    RadixTrie Set(const std::string& key, const ValuePtr& value) const
+    {
+        bool existed = false;
+        RadixTrie newtrie;
+        newtrie.m_root = SetNode(m_root, key, 0, value, true, existed);
+        newtrie.m_size = m_size + (value ? 1 : 0) - (existed ? 1 : 0);
+        return newtrie;
+    }
+    // visit the values of the keys which are the prefix of key or have key as the prefix, so a
+    // name matches both the group it belongs to and the members of it. the empty key matches all.
+    // the visitor returns false to stop visiting.
+    template <typename Visitor> void VisitPrefixMatching(const std::string& key, Visitor& visitor) const
+    {
+        Visit(key, true, visitor);
+    }
+    // visit the values of the keys which have prefix as the prefix.
+    template <typename Visitor> void VisitWithPrefix(const std::string& prefix, Visitor& visitor) const
+    {
+        Visit(prefix, false, visitor);
+    }
+
+private:
+    template <typename Visitor> void Visit(const std::string& key, bool with_shorter, Visitor& visitor) const
+    {
+        const Node* node = m_root.get();
+        size_t pos = 0;
+        while(pos < key.size())
+        {
+            if(with_shorter && node->value && !visitor(node->value))
+                return;
+            typename ChildrenT::const_iterator cit = node->children.find(key[pos]);
+            if(cit == node->children.end())
+                return;
+            node = cit->second.get();
+            size_t remaining = key.size() - pos;
+            if(remaining <= node->label.size())
+            {
+                // the key ends in the edge, all the keys below have it as the prefix.
+                if(node->label.compare(0, remaining, key, pos, remaining) == 0)
+                    VisitSubTree(node, visitor);
+                return;
+            }
+            if(key.compare(pos, node->label.size(), node->label) != 0)
+                return;
+            pos += node->label.size();
+        }
+        VisitSubTree(node, visitor);
+    }
+    template <typename Visitor> static bool VisitSubTree(const Node* node, Visitor& visitor)
+    {
+        if(node->value && !visitor(node->value))
+            return false;
+        typename ChildrenT::const_iterator cit = node->children.begin();
+        while(cit != node->children.end())
+        {
+            if(!VisitSubTree(cit->second.get(), visitor))
+                return false;
+            ++cit;
+        }
+        return true;
+    }
+    static size_t CommonPrefixLen(const std::string& label, const std::string& key, size_t pos)
+    {
+        size_t i = 0;
+        while(i < label.size() && pos + i < key.size() && label[i] == key[pos + i])
+            ++i;
+        return i;
+    }
+    // return the copy of the node with the value of key[pos...] replaced, null if the node
+    // has nothing left.
+    static NodePtr SetNode(const NodePtr& node, const std::string& key, size_t pos,
+        const ValuePtr& value, bool is_root, bool& existed)
+    {
+        boost::shared_ptr<Node> newnode(new Node(*node));
+        if(pos == key.size())
+        {
+            existed = node->value.get() != NULL;
+            newnode->value = value;
+        }
+        else
+        {
+            typename ChildrenT::iterator it = newnode->children.find(key[pos]);
+            if(it == newnode->children.end())
+            {
+                if(!value)
+                    return node;
+                boost::shared_ptr<Node> leaf(new Node());
+                leaf->label = key.substr(pos);
+                leaf->value = value;
+                newnode->children[key[pos]] = leaf;
+            }
+            else
+            {
+                const NodePtr& child = it->second;
+                size_t common = CommonPrefixLen(child->label, key, pos);
+                if(common == child->label.size())
+                {
+                    NodePtr newchild = SetNode(child, key, pos + common, value, false, existed);
+                    if(newchild)
+                        it->second = newchild;
+                    else
+                        newnode->children.erase(it);
+                }
+                else
+                {
+                    if(!value)
+                        return node;
+                    // split the edge at the common prefix.
+                    boost::shared_ptr<Node> middle(new Node());
+                    middle->label = child->label.substr(0, common);
+                    boost::shared_ptr<Node> rest(new Node(*child));
+                    rest->label = child->label.substr(common);
+                    middle->children[rest->label[0]] = rest;
+                    if(pos + common == key.size())
+                    {
+                        middle->value = value;
+                    }
+                    else
+                    {
+                        boost::shared_ptr<Node> leaf(new Node());
+                        leaf->label = key.substr(pos + common);
+                        leaf->value = value;
+                        middle->children[leaf->label[0]] = leaf;
+                    }
+                    it->second = middle;
+                }
+            }
+        }
+        if(is_root || newnode->value)
+            return newnode;
+        if(newnode->children.empty())
+            return NodePtr();
+        if(newnode->children.size() == 1)
+        {
+            // merge the only child into this node to keep the trie compressed.
+            boost::shared_ptr<Node> merged(new Node(*newnode->children.begin()->second));
+            merged->label = newnode->label + merged->label;
+            return merged;
+        }
+        return newnode;
+    }
+
+    NodePtr m_root;
+    size_t m_size;
+};
+
+} }
+
+#endif // end of CORE_COMMON_RADIXTRIE_H
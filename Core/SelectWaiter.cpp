@@ -63,7 +63,7 @@ bool SelectWaiter::UpdateTcpSockEvent(TcpSockSmartPtr sp_tcp)
     return true;
 }
 
-int SelectWaiter::Wait(TcpSockContainerT& allready, struct timeval& tv)
+int SelectWaiter::Wait(TcpSockReadyListT& allready, int timeout_ms)
 {
     allready.clear();
     fd_set readfds;
@@ -77,15 +77,21 @@ int SelectWaiter::Wait(TcpSockContainerT& allready, struct timeval& tv)
     readfds = m_readfds;
     writefds = m_writefds;
     exceptfds = m_exceptfds;
-    if(maxfd == 0)
+    struct timeval tv;
+    tv.tv_sec = timeout_ms/1000;
+    tv.tv_usec = (timeout_ms%1000)*1000;
+    struct timeval* ptv = timeout_ms < 0 ? NULL : &tv;
+    if(maxfd == 0 && ptv)
     {
         // if tmp_tcpsocks is Empty, timeout need longer .
-        ::select(0, NULL, NULL, NULL, &tv);
+        ::select(0, NULL, NULL, NULL, ptv);
     }
-    int retcode = ::select(maxfd + 1, &readfds, &writefds, &exceptfds, &tv);
+    int retcode = ::select(maxfd + 1, &readfds, &writefds, &exceptfds, ptv);
+    // read the clock only once for each wakeup, the ready tcps renew the timeout by it.
+    m_timing_wheel.UpdateNow();
 
     // clear immediately after select waking up to speed up eventloop.
-    int notifytype = GetAndClearNotify();
+    int notifytype = GetAndClearNotify(retcode > 0 && m_notify_pipe[0] != -1 && FD_ISSET(m_notify_pipe[0], &readfds));
     if(notifytype & REMOVED)
     {
         ClearClosedTcpSock();
@@ -140,16 +146,13 @@ int SelectWaiter::Wait(TcpSockContainerT& allready, struct timeval& tv)
         if(isready)
         {
             sptcp->RenewTimeout();
-            allready[(long)sptcp->GetFD()] = sptcp;
-        }
-        else
-        {
-            // whether timeout is ready.
-            sptcp->UpdateTimeout();
+            allready.push_back(sptcp);
         }
 
         ++it;
     }
+    // only the tcps in the expired slots will be checked.
+    m_timing_wheel.Expire();
     return retcode;
 }
 
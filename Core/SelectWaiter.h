@@ -11,7 +11,7 @@ public:
     SelectWaiter();
     ~SelectWaiter();
     // must run in the event loop thread.
-    int  Wait(TcpSockContainerT& allready, struct timeval& tv);
+    int  Wait(TcpSockReadyListT& allready, int timeout_ms);
     void DestroyWaiter();
 protected:
     bool UpdateTcpSockEvent(TcpSockSmartPtr sp_tcp);
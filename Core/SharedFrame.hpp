@@ -0,0 +1,51 @@
+#ifndef  CORE_NET_SHAREDFRAME_H
+#define  CORE_NET_SHAREDFRAME_H
+
+#include <string.h>
+#include <sys/types.h>
+#include <boost/shared_array.hpp>
+
+namespace core { namespace net {
+
+// the data which will be sent out by tcp. the data is refcounted and should not 
+// be modified after queued, so the same frame can be queued to many tcps without copy.
+// a frame can also be a part of a bigger buffer by using the offset.
+struct SharedFrame
+{
+    SharedFrame()
+        :offset(0),
+        len(0)
+    {
+    }
+    SharedFrame(boost::shared_array<char> data, size_t size, size_t data_offset = 0)
+        :buf(data),
+        offset(data_offset),
+        len(size)
+    {
+    }
+    static SharedFrame CopyFrom(const char* pdata, size_t size)
+    {
+        boost::shared_array<char> data(new char[size]);
+        memcpy(data.get(), pdata, size);
+        return SharedFrame(data, size);
+    }
+    const char* data() const
+    {
+        return buf.get() + offset;
+    }
+    size_t size() const
+    {
+        return len;
+    }
+    bool empty() const
+    {
+        return len == 0 || !buf;
+    }
+    boost::shared_array<char> buf;
+    size_t offset;
+    size_t len;
+};
+
+} }
+
+#endif // end of CORE_NET_SHAREDFRAME_H
@@ -16,6 +16,18 @@ typedef boost::function<size_t(TcpSockSmartPtr, const char*, size_t)> onReadCB;
 typedef boost::function<bool(TcpSockSmartPtr)> onSendCB;
 typedef boost::function<void(TcpSockSmartPtr)> onErrorCB;
 typedef boost::function<void(TcpSockSmartPtr)> onTimeoutCB;
+// called in the loop thread of the listening tcp for each accepted tcp, the new tcp is already nonblock
+// and close on exec. set the handler of the new tcp and return true to add it to the same loop as the 
+// listening tcp, return false will close the new tcp.
+typedef boost::function<bool(TcpSockSmartPtr)> onAcceptCB;
+// called in the loop thread when the asynchronous connect finished, the second param is false 
+// if the connect failed or timeout, and the tcp will be closed after this.
+typedef boost::function<void(TcpSockSmartPtr, bool)> onConnectCB;
+// called in the loop thread when the bytes queued to send reach the high water mark, the SendData will 
+// refuse the new data until the queued bytes drop to the low water mark and onLowWater is called.
+// the onLowWater is also called when the tcp is closed above the high water, so they are always in pairs.
+typedef boost::function<void(TcpSockSmartPtr)> onHighWaterCB;
+typedef boost::function<void(TcpSockSmartPtr)> onLowWaterCB;
 struct SockHandler
 {
     onCloseCB onClose;
@@ -23,12 +35,20 @@ struct SockHandler
     onSendCB  onSend;
     onErrorCB onError;
     onTimeoutCB onTimeout;
+    onAcceptCB onAccept;
+    onConnectCB onConnect;
+    onHighWaterCB onHighWater;
+    onLowWaterCB onLowWater;
     SockHandler()
         :onClose(NULL),
         onRead(NULL),
         onSend(NULL),
         onError(NULL),
-        onTimeout(NULL)
+        onTimeout(NULL),
+        onAccept(NULL),
+        onConnect(NULL),
+        onHighWater(NULL),
+        onLowWater(NULL)
     {
     }
     void clear()
@@ -38,6 +58,10 @@ struct SockHandler
         onSend = NULL;
         onError = NULL;
         onTimeout = NULL;
+        onAccept = NULL;
+        onConnect = NULL;
+        onHighWater = NULL;
+        onLowWater = NULL;
     }
 };
 
@@ -6,15 +6,37 @@
 #include <boost/bind.hpp>
 #include <signal.h>
 #include <fcntl.h>
+#if defined (__APPLE__) || defined (__MACH__) 
+#else
+#include <sys/eventfd.h>
+#endif
+
+// the timeout of the tcp is at least several seconds, so 100ms is enough for the tick.
+#define TIMEOUT_WHEEL_TICK_MS  100
+#define TIMEOUT_WHEEL_SLOT_NUM 1024
 
 namespace core { namespace net {
 
 static LoggerCategory g_log("SockWaiterBase");
 
 SockWaiterBase::SockWaiterBase()
-    :m_newnotify(false),
-    m_allactive(0)
+    :m_timing_wheel(TIMEOUT_WHEEL_TICK_MS, TIMEOUT_WHEEL_SLOT_NUM),
+    m_newnotify(0),
+    m_running(false),
+    m_allactive(0),
+    m_active_tcpnum(0)
 {
+#if defined(EFD_NONBLOCK) && defined(EFD_CLOEXEC)
+    int efd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if(efd >= 0)
+    {
+        m_notify_pipe[0] = efd;
+        m_notify_pipe[1] = efd;
+        m_running = true;
+        return;
+    }
+    g_log.Log(lv_warn, "eventfd failed, use pipe for notify instead.");
+#endif
 	if (pipe(m_notify_pipe) < 0) {
 		perror("pipe(notify_pipe) failed.");
 	} else if ((fcntl(m_notify_pipe[0], F_SETFD, FD_CLOEXEC) == -1) ||
@@ -36,7 +58,7 @@ SockWaiterBase::~SockWaiterBase()
 {
     if(m_notify_pipe[0] != -1)
         close(m_notify_pipe[0]);
-    if(m_notify_pipe[1] != -1)
+    if(m_notify_pipe[1] != -1 && m_notify_pipe[1] != m_notify_pipe[0])
         close(m_notify_pipe[1]);
 }
 
@@ -49,6 +71,8 @@ void SockWaiterBase::DestroyWaiter()
     m_running = false;
     m_evloop = NULL;
     m_waiting_tcpsocks.clear();
+    m_active_tcpnum = 0;
+    m_timing_wheel.Clear();
 }
 
 void SockWaiterBase::SetEventLoop(EventLoop* pev)
@@ -56,47 +80,45 @@ void SockWaiterBase::SetEventLoop(EventLoop* pev)
     m_evloop = pev;
 }
 
+// can be called in any thread without lock, the notifies between two waits
+// will be merged into one write and one wakeup.
 void SockWaiterBase::NotifyNewActive(kSockActiveNotify active)
-{
-    core::common::locker_guard guard(m_common_lock);
-    NotifyNewActiveWithoutLock(active);
-}
-
-// should locker by caller.
-void SockWaiterBase::NotifyNewActiveWithoutLock(kSockActiveNotify active)
 {
 	if (m_notify_pipe[1] != -1)
     {
-        // only write to pipe for first notify.
-        if(!m_newnotify)
+        // the active must be visible before the pending flag, the waiter 
+        // clear the flag first and then take the active.
+        __sync_fetch_and_or(&m_allactive, (int)active);
+        // only write to notify fd for first notify.
+        if(__sync_lock_test_and_set(&m_newnotify, 1) == 0)
         {
-            int writed = write(m_notify_pipe[1], "1", 1);
+            uint64_t one = 1;
+            int writed = 0;
+            if(m_notify_pipe[1] == m_notify_pipe[0])
+                writed = write(m_notify_pipe[1], &one, sizeof(one));
+            else
+                writed = write(m_notify_pipe[1], "1", 1) == 1 ? sizeof(one) : -1;
             //g_log.Log(lv_debug, "write notify new active :%d", (int)active);
-            if(writed != 1)
+            if(writed != sizeof(one))
                 g_log.Log(lv_error, "notify new active :%d failed !!!", active);
         }
-
-        m_allactive |= active;
-
-        m_newnotify = true;
     }
 }
 
-int SockWaiterBase::GetAndClearNotify()
+int SockWaiterBase::GetAndClearNotify(bool notify_readable)
 {
-    int allactive = NOACTIVE;
-    bool needread = false;
-    {
-        core::common::locker_guard guard(m_common_lock);
-        needread = m_newnotify;
-        m_newnotify = false;
-        allactive = m_allactive;
-        m_allactive = 0;
-    }
+    // drain the notify fd first, then clear the pending flag and take the active.
+    // a notify before the flag is cleared has its active taken below, and any
+    // notify after that will write the fd again and wake up the next wait.
+    // if the fd is drained after clearing the flag, a wakeup written by the
+    // following notify may be consumed here while the flag stays set, and
+    // the next wait will never be waked up.
+    bool needread = (m_newnotify != 0) || notify_readable;
     while (needread)
     {
-        char c;
-        if (read(m_notify_pipe[0], &c, 1) == 1)
+        char buf[8];
+        // eventfd reset the counter by one read, and pipe has only one byte for each pending wakeup.
+        if (read(m_notify_pipe[0], buf, sizeof(buf)) > 0)
         {
             //g_log.Log(lv_debug, "got notify new active :%d, now num:%zu", c, m_waiting_tcpsocks.size());
             break;
@@ -106,13 +128,23 @@ int SockWaiterBase::GetAndClearNotify()
             if(errno != EAGAIN && errno != EINTR)
             {
                 g_log.Log(lv_error, "get notify in sock waiter error.");
-                return allactive;
+                break;
             }
             if(errno == EAGAIN)
                 break;
         }
     }
-    return allactive;
+    __sync_lock_test_and_set(&m_newnotify, 0);
+    __sync_synchronize();
+    return __sync_fetch_and_and(&m_allactive, 0);
+}
+
+void SockWaiterBase::ScheduleTimeout(TcpSockSmartPtr sp_tcp)
+{
+    if(!m_running)
+        return;
+    assert(m_evloop->IsInLoopThread());
+    m_timing_wheel.Schedule(sp_tcp);
 }
 
 bool SockWaiterBase::Empty() const
@@ -131,7 +163,8 @@ bool SockWaiterBase::Empty() const
 
 int SockWaiterBase::GetActiveTcpNum() const
 {
-    return m_waiting_tcpsocks.size();
+    // called by other threads to balance the tcps between loops.
+    return m_active_tcpnum;
 }
 
 bool SockWaiterBase::UpdateTcpSock(TcpSockSmartPtr sp_tcp)
@@ -181,6 +214,7 @@ void SockWaiterBase::UpdateTcpSockInLoop(TcpSockSmartPtr sp_tcp)
                 //core::common::locker_guard guard(m_common_lock);
                 //m_waiting_tcpsocks.push_back(sp_tcp);
                 m_waiting_tcpsocks[(long)sp_tcp->GetFD()] = sp_tcp;
+                m_active_tcpnum = m_waiting_tcpsocks.size();
             }
             else
             {
@@ -188,6 +222,8 @@ void SockWaiterBase::UpdateTcpSockInLoop(TcpSockSmartPtr sp_tcp)
                 m_waiting_tcpsocks[(long)sp_tcp->GetFD()] = sp_tcp;
             }
         }
+        // the tcp already in the wheel will be ignored.
+        m_timing_wheel.Schedule(sp_tcp);
     }
     else
     {
@@ -263,6 +299,7 @@ void SockWaiterBase::ClearClosedTcpSock()
             ++reit;
         }
     }
+    m_active_tcpnum = m_waiting_tcpsocks.size();
 }
 
 // clear all tcps when terminate.
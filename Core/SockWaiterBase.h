@@ -2,15 +2,20 @@
 #define  CORE_NET_SOCKWAITERBASE_H
 
 #include "TcpSock.h"
+#include "TimingWheel.h"
 #include "lock.hpp"
 #include <deque>
 #include <map>
+#include <vector>
 
 namespace core { namespace net {
 
 //typedef std::deque< TcpSockSmartPtr > TcpSockContainerT;
 typedef std::map< long, TcpSockSmartPtr > TcpSockContainerT;
 typedef std::map< std::pair<std::string, unsigned short int>, TcpSockContainerT > TcpSockPoolT;  
+// ready tcps returned by the waiter, the container is reused by the event loop
+// between each wait, so no allocation is needed after it has grown large enough.
+typedef std::vector< TcpSockSmartPtr > TcpSockReadyListT;
 
 enum kSockActiveNotify
 {
@@ -40,11 +45,16 @@ public:
 
     bool Empty() const;
     // wait for ready event you has set cared about, every time you call wait will clear old ready event. 
-    virtual int  Wait(TcpSockContainerT& allready, struct timeval& tv) = 0;
+    // timeout_ms -1 means wait until any event or notify happened.
+    virtual int  Wait(TcpSockReadyListT& allready, int timeout_ms) = 0;
     //bool IsTcpExist(TcpSockSmartPtr sp_tcp);
     int GetActiveTcpNum() const;
     void SetEventLoop(EventLoop* pev);
     void NotifyNewActive(kSockActiveNotify active);
+    int64_t GetCachedTickCount() const { return m_timing_wheel.Now(); }
+    // the time in ms to wait for the next tcp timeout, -1 if no timeout is waiting.
+    int  GetNextTimeout() const { return m_timing_wheel.NextTimeoutMs(); }
+    void ScheduleTimeout(TcpSockSmartPtr sp_tcp);
 
 protected:
     // add or update the tcp and the event you cared.
@@ -52,18 +62,26 @@ protected:
     void ClearClosedTcpSock();
     // in order the waiter got the tcp add and remove event as quick as Possible,
     // the derived class can wait on the pipe read end to got the notify event. 
-    int  GetAndClearNotify();
-    void NotifyNewActiveWithoutLock(kSockActiveNotify active);
+    // notify_readable should be true if the waiter found the notify fd readable.
+    int  GetAndClearNotify(bool notify_readable = false);
 
     TcpSockContainerT  m_waiting_tcpsocks;
+    // the derived waiter should update the clock after each wakeup and
+    // expire the timeout after the ready tcps have renewed the timeout.
+    TimingWheel        m_timing_wheel;
     // store all the tcp connection for the specified destip:destport.
     TcpSockPoolT       m_tcpclient_pool;
     core::common::locker m_common_lock;
+    // eventfd on linux, both the read end and the write end are the same fd.
     int  m_notify_pipe[2];
-    bool m_newnotify;
+    // a wakeup has been written and not consumed by the waiter yet,
+    // so the following notify need not to write again.
+    volatile int m_newnotify;
     bool m_running;
     EventLoop* m_evloop;
-    int m_allactive;
+    volatile int m_allactive;
+    // the size of m_waiting_tcpsocks, which can be read by other threads without lock.
+    volatile int m_active_tcpnum;
 
 };
 } }
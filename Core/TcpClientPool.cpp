@@ -3,6 +3,7 @@
 #include "EventLoopPool.h"
 #include <pthread.h>
 #include <boost/shared_ptr.hpp>
+#include <boost/bind.hpp>
 #include <vector>
 #include <stdio.h>
 
@@ -138,20 +139,154 @@ bool TcpClientPool::CreateTcpSock(const std::string& loopname, const std::string
         }
 
         common::locker_guard g(m_common_lock);
-        TcpSockPoolT::iterator it = m_tcpclient_pool.find(std::make_pair(ip, port));
-        if(it != m_tcpclient_pool.end())
+        AddTcpSockWithoutLock(std::make_pair(ip, port), newtcp);
+    }
+    return true;
+}
+
+void TcpClientPool::SetBatchMode(int window_us, size_t max_batch_bytes)
+{
+    common::locker_guard g(m_common_lock);
+    m_batch_window_us = window_us;
+    m_batch_max_bytes = max_batch_bytes;
+    TcpSockPoolT::iterator it = m_tcpclient_pool.begin();
+    for(; it != m_tcpclient_pool.end(); ++it)
+    {
+        for(size_t i = 0; i < it->second.size(); ++i)
+            it->second[i]->SetBatchMode(window_us, max_batch_bytes);
+    }
+}
+
+void TcpClientPool::FlushAll()
+{
+    common::locker_guard g(m_common_lock);
+    TcpSockPoolT::iterator it = m_tcpclient_pool.begin();
+    for(; it != m_tcpclient_pool.end(); ++it)
+    {
+        for(size_t i = 0; i < it->second.size(); ++i)
+            it->second[i]->Flush();
+    }
+}
+
+void TcpClientPool::AddTcpSockWithoutLock(const DestHostT& desthost, TcpSockSmartPtr sp_tcp)
+{
+    if(m_batch_window_us > 0)
+        sp_tcp->SetBatchMode(m_batch_window_us, m_batch_max_bytes);
+    TcpSockPoolT::iterator it = m_tcpclient_pool.find(desthost);
+    if(it != m_tcpclient_pool.end())
+    {
+        g_log.Log(lv_debug, "more same client connection added, %s:%d, fd:%d", desthost.first.c_str(), desthost.second, sp_tcp->GetFD());
+        it->second.push_back(sp_tcp);
+    }
+    else
+    {
+        g_log.Log(lv_debug, "first new client connection added, %s:%d, fd:%d", desthost.first.c_str(), desthost.second, sp_tcp->GetFD());
+        m_tcpclient_pool[desthost].push_back(sp_tcp);
+        m_select_counter[desthost] = 0;
+    }
+}
+
+void TcpClientPool::AsyncGetTcpSock(const std::string& loopname, const std::string& ip, unsigned short int port,
+    int num, int timeout, SockHandler tcp_callback, PostCB postcb, ReadyCB readycb)
+{
+    DestHostT desthost = std::make_pair(ip, port);
+    TcpSockSmartPtr readytcp;
+    {
+        common::locker_guard g(m_common_lock);
+        TcpSockPoolT::const_iterator it = m_tcpclient_pool.find(desthost);
+        if(it != m_tcpclient_pool.end() && it->second.size() > 0)
         {
-            g_log.Log(lv_debug, "more same client connection added, %s:%d, fd:%d", ip.c_str(), port, newtcp->GetFD());
-            it->second.push_back(newtcp);
+            const TcpSockContainerT& all_conn = it->second;
+            readytcp = all_conn[m_select_counter[desthost]++ % all_conn.size()];
         }
         else
         {
-            g_log.Log(lv_debug, "first new client connection added, %s:%d, fd:%d", ip.c_str(), port, newtcp->GetFD());
-            m_tcpclient_pool[std::make_pair(ip, port)].push_back(newtcp);
-            m_select_counter[std::make_pair(ip, port)] = 0;
+            PendingConnect& pending = m_pending_connects[desthost];
+            pending.waiting_cbs.push_back(readycb);
+            // the connects already in progress will call all the parked callbacks.
+            if(pending.connecting_num > 0)
+                return;
+            if(num <= 0)
+                num = 1;
+            pending.connecting_num = num;
         }
     }
-    return true;
+    if(readytcp)
+    {
+        readycb(readytcp);
+        return;
+    }
+    // all the connects are in progress at the same time in the loop, 
+    // so the connects to different hosts will not block each other.
+    tcp_callback.onConnect = boost::bind(&TcpClientPool::OnAsyncConnected, this, _1, _2, desthost, postcb);
+    for(int i = 0; i < num; ++i)
+    {
+        TcpSockSmartPtr newtcp(new TcpSock());
+        newtcp->SetSockHandler(tcp_callback);
+        if(!newtcp->AsyncConnect(ip, port, timeout*1000))
+        {
+            OnAsyncConnected(newtcp, false, desthost, postcb);
+            continue;
+        }
+        bool added = false;
+        if(!loopname.empty())
+            added = EventLoopPool::AddTcpSockToLoop(loopname, newtcp);
+        else
+            added = EventLoopPool::AddTcpSockToInnerLoop(newtcp);
+        if(!added)
+        {
+            newtcp->Close();
+            OnAsyncConnected(newtcp, false, desthost, postcb);
+        }
+    }
+}
+
+void TcpClientPool::OnAsyncConnected(TcpSockSmartPtr sp_tcp, bool connected, const DestHostT& desthost, PostCB postcb)
+{
+    if(connected && postcb && !postcb(sp_tcp))
+    {
+        connected = false;
+        sp_tcp->Close();
+    }
+    if(!connected)
+    {
+        std::vector< ReadyCB > failed_cbs;
+        {
+            common::locker_guard g(m_common_lock);
+            PendingConnectT::iterator it = m_pending_connects.find(desthost);
+            if(it == m_pending_connects.end())
+                return;
+            // only the last failed connect will fail all the parked callbacks.
+            if(--it->second.connecting_num > 0)
+                return;
+            failed_cbs.swap(it->second.waiting_cbs);
+            m_pending_connects.erase(it);
+        }
+        g_log.Log(lv_warn, "all the connects to %s:%d failed.", desthost.first.c_str(), desthost.second);
+        for(size_t i = 0; i < failed_cbs.size(); ++i)
+            failed_cbs[i](TcpSockSmartPtr());
+        return;
+    }
+    // call the parked callbacks before adding the tcp to the pool, so the data sent by the parked callbacks 
+    // will be ahead of the data sent by the following callers who get the tcp from the pool directly.
+    while(true)
+    {
+        std::vector< ReadyCB > ready_cbs;
+        {
+            common::locker_guard g(m_common_lock);
+            PendingConnectT::iterator it = m_pending_connects.find(desthost);
+            if(it == m_pending_connects.end() || it->second.waiting_cbs.empty())
+            {
+                AddTcpSockWithoutLock(desthost, sp_tcp);
+                if(it != m_pending_connects.end() && --it->second.connecting_num <= 0)
+                    m_pending_connects.erase(it);
+                break;
+            }
+            ready_cbs.swap(it->second.waiting_cbs);
+        }
+        for(size_t i = 0; i < ready_cbs.size(); ++i)
+            ready_cbs[i](sp_tcp);
+    }
 }
 
 
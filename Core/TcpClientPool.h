@@ -14,16 +14,36 @@ class TcpClientPool : public boost::noncopyable
 {
 public:
     typedef boost::function<bool(TcpSockSmartPtr)> PostCB;
+    // called with the connected tcp, or an empty tcp if all the connects to the dest host failed.
+    typedef boost::function<void(TcpSockSmartPtr)> ReadyCB;
     TcpSockSmartPtr GetTcpSockByDestHost(const std::string& ip, unsigned short int port);
 
     bool AddTcpSock(TcpSockSmartPtr sp_tcp);
     void RemoveTcpSock(TcpSockSmartPtr sp_tcp);
     bool CreateTcpSock(const std::string& loopname, const std::string& ip, unsigned short int port,
         int num, int timeout, SockHandler tcp_callback, PostCB postcb);
-    TcpClientPool(){}
+    // get a tcp to the dest host without blocking. if no tcp in the pool, the readycb will be parked
+    // until the first of the num parallel asynchronous connects is up, and all the readycb parked for
+    // the same dest host will be called in the order of parking. the readycb may be called in 
+    // the current thread if the tcp already exists or in the loop thread of the new tcp.
+    // timeout is in seconds.
+    void AsyncGetTcpSock(const std::string& loopname, const std::string& ip, unsigned short int port,
+        int num, int timeout, SockHandler tcp_callback, PostCB postcb, ReadyCB readycb);
+    // set the batch mode for all the tcps in the pool, including the tcps created later.
+    void SetBatchMode(int window_us, size_t max_batch_bytes);
+    // flush all the batched data of the tcps in the pool.
+    void FlushAll();
+    TcpClientPool()
+        :m_batch_window_us(0),
+        m_batch_max_bytes(0)
+    {
+    }
     ~TcpClientPool(){}
 
 private:
+    typedef std::pair<std::string, unsigned short int> DestHostT;
+    void OnAsyncConnected(TcpSockSmartPtr sp_tcp, bool connected, const DestHostT& desthost, PostCB postcb);
+    void AddTcpSockWithoutLock(const DestHostT& desthost, TcpSockSmartPtr sp_tcp);
 
     typedef std::vector< TcpSockSmartPtr > TcpSockContainerT;
     typedef std::map< std::pair<std::string, unsigned short int>, TcpSockContainerT > TcpSockPoolT;  
@@ -33,6 +53,20 @@ private:
     TcpSockPoolT       m_tcpclient_pool;
     core::common::locker m_common_lock;
     TcpSockSelectCounterT m_select_counter;
+    struct PendingConnect
+    {
+        PendingConnect()
+            :connecting_num(0)
+        {
+        }
+        int connecting_num;
+        std::vector< ReadyCB > waiting_cbs;
+    };
+    typedef std::map< DestHostT, PendingConnect > PendingConnectT;
+    // the dest hosts which the asynchronous connects are in progress.
+    PendingConnectT m_pending_connects;
+    int m_batch_window_us;
+    size_t m_batch_max_bytes;
 
 };
 } }
@@ -9,38 +9,80 @@
 #include <sys/types.h>
 #include <sys/socket.h>
 #include <netinet/in.h>
+#include <netinet/tcp.h>
 #include <arpa/inet.h>
 #include <stdio.h>
+#include <string.h>
+#include <sys/uio.h>
 #include <boost/bind.hpp>
 
 #define BLOCK_SIZE 1024*8
-#define MAX_BUF_SIZE BLOCK_SIZE*64*8
 #define ALIVE_NUM  5
+// max frames written by one writev.
+#define MAX_IOV_NUM 64
+#define DEFAULT_LISTEN_BACKLOG 1024
+// the default bytes to flush the batch before the window timeout.
+#define DEFAULT_BATCH_BYTES 1024*64
+// the default limit of the bytes queued to send for each tcp.
+#define DEFAULT_HIGH_WATER 1024*1024*64
+// the states of m_above_high, the onHighWater is called in loop thread after reached.
+#define HIGH_WATER_REACHED  1
+#define HIGH_WATER_NOTIFIED 2
 
 namespace core { namespace net {
 
 static LoggerCategory g_log("TcpSock");
 
 TcpSock::TcpSock()
-    :m_fd(-1),
+    :m_outqueue_head(NULL),
+    m_flush_pending(0),
+    m_sending_offset(0),
+    m_in_sending(false),
+    m_batch_window_us(0),
+    m_batch_max_bytes(0),
+    m_batch_bytes(0),
+    m_batch_pending(0),
+    m_high_water(DEFAULT_HIGH_WATER),
+    m_low_water(DEFAULT_HIGH_WATER/4),
+    m_queued_bytes(0),
+    m_above_high(0),
+    m_fd(-1),
     m_writeable(false),
     m_allow_more_send(false),
     m_isclosing(true),
+    m_listening(false),
+    m_connecting(false),
     m_alive_counter(-1),
     m_timeout_ms(-1),
     m_is_timeout_need(false),
+    m_timeout_scheduled(false),
     m_evloop(NULL)
 {
     m_tmp_blocksize = BLOCK_SIZE;
 }
 TcpSock::TcpSock(int fd, const std::string& ip, unsigned short int port)
-    :m_fd(fd),
+    :m_outqueue_head(NULL),
+    m_flush_pending(0),
+    m_sending_offset(0),
+    m_in_sending(false),
+    m_batch_window_us(0),
+    m_batch_max_bytes(0),
+    m_batch_bytes(0),
+    m_batch_pending(0),
+    m_high_water(DEFAULT_HIGH_WATER),
+    m_low_water(DEFAULT_HIGH_WATER/4),
+    m_queued_bytes(0),
+    m_above_high(0),
+    m_fd(fd),
     m_writeable(true),
     m_allow_more_send(true),
     m_isclosing(false),
+    m_listening(false),
+    m_connecting(false),
     m_alive_counter(ALIVE_NUM),
     m_timeout_ms(-1),
     m_is_timeout_need(false),
+    m_timeout_scheduled(false),
     m_evloop(NULL)
 {
     m_desthost.host_ip = ip;
@@ -52,6 +94,7 @@ TcpSock::TcpSock(int fd, const std::string& ip, unsigned short int port)
 TcpSock::~TcpSock()
 {
     Close(false);
+    ClearOutQueue();
 }
 
 bool TcpSock::SetNonBlock()
@@ -103,13 +146,18 @@ void TcpSock::RenewTimeout()
     if(m_is_timeout_need)
     {
         assert(m_evloop->IsInLoopThread());
-        m_timeout_ms = core::utility::GetTickCount() + m_timeout_renew;
-        need_renew_timeout_ = false;
+        // use the time cached by the loop for each wakeup, renew will happen on every ready event.
+        m_timeout_ms = m_evloop->GetCachedTickCount() + m_timeout_renew;
     }
 }
 
 void TcpSock::SetTimeout(int to_ms)
 {
+    if(m_evloop && !m_evloop->IsInLoopThread())
+    {
+        m_evloop->QueueTaskToLoop(boost::bind(&TcpSock::SetTimeout, shared_from_this(), to_ms));
+        return;
+    }
     if(to_ms <= 0)
     {
         m_is_timeout_need = false;
@@ -121,18 +169,26 @@ void TcpSock::SetTimeout(int to_ms)
     m_timeout_renew = to_ms;
     m_timeout_ms = core::utility::GetTickCount() + to_ms;
     m_is_timeout_need = true;
+    // the tcp not added to loop will be scheduled while adding.
+    if(m_evloop)
+        m_evloop->ScheduleTimeout(shared_from_this());
 }
 
 void TcpSock::UpdateTimeout()
 {
     if(m_is_timeout_need)
     {
-        if (need_renew_timeout_)
-            RenewTimeout();
         //g_log.Log(lv_debug, "update timeout : fd-%d", m_fd);
-        if(core::utility::GetTickCount() > m_timeout_ms)
+        if(m_evloop->GetCachedTickCount() >= m_timeout_ms)
         {
             assert(m_evloop->IsInLoopThread());
+            if(m_connecting)
+            {
+                g_log.Log(lv_warn, "connect to %s:%d timeout. fd:%d", m_desthost.host_ip.c_str(), m_desthost.host_port, m_fd);
+                m_errno = ETIMEDOUT;
+                ConnectFinished(false);
+                return;
+            }
             RenewTimeout();
             if(m_sockcb.onTimeout)
                 m_sockcb.onTimeout(shared_from_this());
@@ -157,25 +213,25 @@ int TcpSock::GetLastError() const
 //    return !m_outbuf.empty();
 //}
 
-// the caller must protect the func use lock.
+// must be called in loop thread.
 void TcpSock::ShutDownWrite()
 {
     if(IsClosed())
         return;
-    if(m_evloop && !m_evloop->IsInWriteLoopThread())
+    if(m_evloop && !m_evloop->IsInLoopThread())
     {
-        m_evloop->QueueTaskToWriteLoop(boost::bind(&TcpSock::ShutDownWrite, shared_from_this()));
+        m_evloop->QueueTaskToLoop(boost::bind(&TcpSock::ShutDownWrite, shared_from_this()));
         return;
     }
     m_writeable = false;
     // before shutdown we try send the left data directly.
-    if(!m_outbuf.empty() /*&& (write(m_fd, &m_outbuf[0], m_outbuf.size()) != (int)m_outbuf.size())*/)
+    if(HasDataToSend())
     {
         g_log.Log(lv_warn, "outbuf is not empty while shutdown write, some data may not sended.");
     }
     //g_log.Log(lv_debug, " shutdown write. fd:%d", m_fd);
     ::shutdown(m_fd, SHUT_WR);
-    m_outbuf.clear();
+    ClearOutQueue();
 }
 
 void TcpSock::AddAndUpdateEvent(EventResult ev)
@@ -208,17 +264,26 @@ void TcpSock::DisAllowSend()
     //g_log.Log(lv_debug, " disallow write. fd:%d", m_fd);
     if(m_evloop)
     {
-        if(m_outbuf.empty())
+        if(!m_evloop->IsInLoopThread())
+        {
+            m_evloop->QueueTaskToLoop(boost::bind(&TcpSock::DisAllowSend, shared_from_this()));
+            return;
+        }
+        if(IsClosed())
+            return;
+        if(m_listening || m_connecting)
+        {
+            // stop accepting, so the loop can be terminated.
+            Close();
+            return;
+        }
+        TakeOutQueue();
+        if(!HasDataToSend())
         {
             ShutDownWrite();
         }
         else
         {
-            if(!m_evloop->IsInLoopThread())
-            {
-                m_evloop->QueueTaskToLoop(boost::bind(&TcpSock::AddAndUpdateEvent, shared_from_this(), EV_WRITE));
-                return;
-            }
             AddAndUpdateEvent(EV_WRITE);
         }
     }
@@ -246,12 +311,14 @@ void TcpSock::Close(bool needremove)
         m_evloop = NULL;
     }
 
+    // the closed tcp will never drop to the low water, pair the onHighWater before the handlers cleared.
+    ResetHighWater();
     m_sockcb.clear();
-    //m_outbuf.insert(m_outbuf.end(), m_tmpoutbuf.begin(), m_tmpoutbuf.end());
-    if(!m_outbuf.empty() /*&& (write(m_fd, &m_outbuf[0], m_outbuf.size()) != (int)m_outbuf.size())*/)
+    if(HasDataToSend())
     {
         g_log.Log(lv_warn, "outbuf is not empty while close socket realfd, some data may not sended.");
     }
+    ClearOutQueue();
     //m_tmpoutbuf.clear();
     if(m_fd != -1)
     {
@@ -284,24 +351,238 @@ bool TcpSock::IsClosed() const
 
 bool TcpSock::Writeable() const
 {
-    return m_writeable && m_allow_more_send;
+    // the data can be queued while connecting.
+    return (m_writeable || m_connecting) && m_allow_more_send;
+}
+
+bool TcpSock::HasDataToSend() const
+{
+    return !m_sending_frames.empty() || m_outqueue_head != NULL;
+}
+
+void TcpSock::TakeOutQueue()
+{
+    OutFrameNode* head = __sync_lock_test_and_set(&m_outqueue_head, (OutFrameNode*)NULL);
+    if(head == NULL)
+        return;
+    // the queue is LIFO, so reverse it to keep the order of queued.
+    OutFrameNode* reversed = NULL;
+    while(head)
+    {
+        OutFrameNode* next = head->next;
+        head->next = reversed;
+        reversed = head;
+        head = next;
+    }
+    while(reversed)
+    {
+        OutFrameNode* node = reversed;
+        reversed = node->next;
+        m_sending_frames.push_back(node->frame);
+        delete node;
+    }
+}
+
+void TcpSock::ClearOutQueue()
+{
+    OutFrameNode* head = __sync_lock_test_and_set(&m_outqueue_head, (OutFrameNode*)NULL);
+    while(head)
+    {
+        OutFrameNode* next = head->next;
+        delete head;
+        head = next;
+    }
+    m_sending_frames.clear();
+    m_sending_offset = 0;
+    __sync_lock_test_and_set(&m_queued_bytes, 0);
+    ResetHighWater();
+}
+
+// called in loop thread after any thread queued the frame.
+void TcpSock::FlushOutQueue()
+{
+    // clear the flag before taking the queue, so the frame queued after 
+    // taking will schedule a new flush.
+    __sync_lock_test_and_set(&m_flush_pending, 0);
+    __sync_lock_test_and_set(&m_batch_bytes, 0);
+    __sync_synchronize();
+    if(IsClosed())
+        return;
+    if(m_evloop)
+        assert(m_evloop->IsInLoopThread());
+    if(m_in_sending)
+        return;
+    TakeOutQueue();
+    // waiting for writable, all the data will be sent while the write event happened.
+    if(m_caredev.hasWrite())
+        return;
+    if(DoSend())
+    {
+        if(HasDataToSend())
+            AddAndUpdateEvent(EV_WRITE);
+    }
+}
+
+void TcpSock::ScheduleBatchFlush()
+{
+    if(IsClosed() || m_evloop == NULL)
+        return;
+    m_evloop->RunTaskAfter(m_batch_window_us, boost::bind(&TcpSock::OnBatchFlushTimeout, shared_from_this()));
+}
+
+void TcpSock::OnBatchFlushTimeout()
+{
+    // clear first, so the frame queued after this will start a new window.
+    __sync_lock_test_and_set(&m_batch_pending, 0);
+    __sync_synchronize();
+    if(!m_in_sending)
+        FlushOutQueue();
+}
+
+void TcpSock::SetCork(bool cork)
+{
+#if defined(TCP_CORK)
+    int optval = cork ? 1 : 0;
+    setsockopt(m_fd, IPPROTO_TCP, TCP_CORK, &optval, sizeof(optval));
+#endif
+}
+
+void TcpSock::SetBatchMode(int window_us, size_t max_batch_bytes)
+{
+    if(window_us < 0)
+        window_us = 0;
+    m_batch_max_bytes = max_batch_bytes > 0 ? max_batch_bytes : DEFAULT_BATCH_BYTES;
+    m_batch_window_us = window_us;
+    if(window_us > 0 && m_fd != -1)
+    {
+        int optval = 1;
+        setsockopt(m_fd, IPPROTO_TCP, TCP_NODELAY, &optval, sizeof(optval));
+    }
+}
+
+void TcpSock::SetWaterMark(size_t high_water, size_t low_water)
+{
+    if(low_water == 0 || low_water > high_water)
+        low_water = high_water/4;
+    m_low_water = low_water;
+    m_high_water = high_water;
+}
+
+size_t TcpSock::GetQueuedBytes() const
+{
+    return m_queued_bytes;
+}
+
+bool TcpSock::IsHighWater() const
+{
+    return m_above_high != 0;
+}
+
+void TcpSock::NotifyHighWater()
+{
+    // the queued data may be already sent out before this, and no notify is needed.
+    if(__sync_bool_compare_and_swap(&m_above_high, HIGH_WATER_REACHED, HIGH_WATER_NOTIFIED))
+    {
+        if(m_sockcb.onHighWater)
+            m_sockcb.onHighWater(shared_from_this());
+    }
 }
 
-void TcpSock::SendDataInLoop(const std::string& data)
+// called in loop thread after the bytes are written to network.
+void TcpSock::SentBytes(size_t bytes)
 {
-    SendDataInLoop(data.data(), data.size());
+    size_t left = __sync_sub_and_fetch(&m_queued_bytes, bytes);
+    if(m_above_high == 0 || left > m_low_water)
+        return;
+    ResetHighWater();
+}
+
+// all the resets of the high water go here, the onLowWater is only called after the onHighWater,
+// so they are always in pairs.
+void TcpSock::ResetHighWater()
+{
+    if(__sync_bool_compare_and_swap(&m_above_high, HIGH_WATER_NOTIFIED, 0))
+    {
+        if(m_sockcb.onLowWater)
+            m_sockcb.onLowWater(shared_from_this());
+    }
+    else
+    {
+        __sync_bool_compare_and_swap(&m_above_high, HIGH_WATER_REACHED, 0);
+    }
+}
+
+void TcpSock::Flush()
+{
+    EventLoop* evloop = m_evloop;
+    if(evloop == NULL || IsClosed())
+        return;
+    if(evloop->IsInLoopThread())
+    {
+        if(!m_in_sending)
+            FlushOutQueue();
+        return;
+    }
+    if(__sync_lock_test_and_set(&m_flush_pending, 1) == 0)
+    {
+        evloop->QueueTaskToLoop(boost::bind(&TcpSock::FlushOutQueue, shared_from_this()));
+    }
 }
 
 bool TcpSock::DoSend()
 {
+    m_in_sending = true;
+    TakeOutQueue();
+    // cork the tcp while the batch needs more than one writev, 
+    // so the frames at the boundary of the writev will not go out as a small segment.
+    bool corked = (m_batch_window_us > 0) && (m_sending_frames.size() > MAX_IOV_NUM);
+    if(corked)
+        SetCork(true);
+    struct iovec iov[MAX_IOV_NUM];
     while(true)
     {
-        int writed = write(m_fd, m_outbuf.data(), m_outbuf.size());
+        if(m_sending_frames.empty())
+        {
+            if(corked)
+                SetCork(false);
+            m_in_sending = false;
+            return true;
+        }
+        int iovcnt = 0;
+        std::deque<SharedFrame>::const_iterator it = m_sending_frames.begin();
+        for(; it != m_sending_frames.end() && iovcnt < MAX_IOV_NUM; ++it)
+        {
+            iov[iovcnt].iov_base = (void*)it->data();
+            iov[iovcnt].iov_len = it->size();
+            ++iovcnt;
+        }
+        iov[0].iov_base = (char*)iov[0].iov_base + m_sending_offset;
+        iov[0].iov_len -= m_sending_offset;
+        int writed = writev(m_fd, iov, iovcnt);
         if(writed > 0)
         {
             //g_log.Log(lv_debug, "thread:%lu, write on fd:%d. bytes:%d, t:%lld",(unsigned long)pthread_self(), m_fd, writed, (int64_t)core::utility::GetTickCount());
-            m_outbuf.pop_front(writed);
-            if(m_outbuf.empty())
+            if(m_evloop)
+                m_evloop->AddIOBytes(writed);
+            SentBytes(writed);
+            size_t left = writed;
+            while(left > 0)
+            {
+                size_t frame_left = m_sending_frames.front().size() - m_sending_offset;
+                if(left < frame_left)
+                {
+                    m_sending_offset += left;
+                    break;
+                }
+                left -= frame_left;
+                m_sending_offset = 0;
+                m_sending_frames.pop_front();
+            }
+            RenewTimeout();
+            // send the frames queued while we are writing in the same round.
+            if(m_sending_frames.empty())
+                TakeOutQueue();
+            if(m_sending_frames.empty())
             {
                 RemoveAndUpdateEvent(EV_WRITE);
                 if(m_sockcb.onSend)
@@ -310,19 +591,20 @@ bool TcpSock::DoSend()
                     {// return false to indicate disallow for more sending.
                         // we will try to send the data left in the buffer,
                         // but not allow more data to add to the buffer.
-                        DisAllowSend();
+                        m_allow_more_send = false;
                     }
+                    TakeOutQueue();
                 }
-                if(!m_allow_more_send)
+                if(!m_allow_more_send && m_sending_frames.empty())
                 {
                     // if no data in buffer and disallow more data be added to buffer
                     // it means we can shutdown the tcp fd since no more data will be sended.
+                    m_in_sending = false;
                     ShutDownWrite();
                     return false; 
                     // fd is not available, so here should find the next event.
                 }
             }
-            need_renew_timeout_ = true;
         }
         else
         {
@@ -331,6 +613,7 @@ bool TcpSock::DoSend()
             if((errno != EAGAIN) && (errno != EINTR))
             {
                 m_errno = errno;
+                m_in_sending = false;
                 if(m_sockcb.onError)
                 {
                     m_sockcb.onError(shared_from_this());
@@ -344,70 +627,103 @@ bool TcpSock::DoSend()
                 break;
         }
     }
+    if(corked)
+        SetCork(false);
+    m_in_sending = false;
     return true;
 }
 
-void TcpSock::SendDataInLoop(const char* pdata, size_t size)
+bool TcpSock::SendData(const char* pdata, size_t size)
 {
-    if(m_evloop)
-        assert(m_evloop->IsInWriteLoopThread());
+    if(size > 0 && pdata)
+    {
+        try
+        {
+            return SendData(SharedFrame::CopyFrom(pdata, size));
+        }
+        catch(...)
+        {
+        }
+    }
+    g_log.Log(lv_error, "send data to outbuf error.");
+    return false;
+}
+
+bool TcpSock::SendData(const SharedFrame& frame)
+{
+    if(frame.empty())
+        return false;
     if(IsClosed() || !Writeable())
     {
+        g_log.Log(lv_debug, " send data after closing or not writeable. fd:%d", m_fd);
         m_errno = EPIPE;
-        return;
+        return false;
     }
-    m_outbuf.push_back(pdata, size);
-    if(DoSend())
+    EventLoop* evloop = m_evloop;
+    if(evloop == NULL)
     {
-        if(!m_outbuf.empty())
-            AddAndUpdateEvent(EV_WRITE);
+        g_log.Log(lv_debug, " send data while no EventLoop. fd:%d", m_fd);
+        return false;
     }
-}
-
-bool TcpSock::SendData(const char* pdata, size_t size)
-{
-    if(size > 0 && pdata)
+    size_t high_water = m_high_water;
+    if(high_water > 0)
     {
-        try
+        if(m_above_high || m_queued_bytes >= high_water)
         {
-            if(IsClosed() || !Writeable())
-            {
-                g_log.Log(lv_debug, " send data after closing or not writeable. fd:%d", m_fd);
-                m_errno = EPIPE;
-                return false;
-            }
-#ifndef NDEBUG
-            if( size > MAX_BUF_SIZE )
-            {
-                m_errno = 0;
-                g_log.Log(lv_warn, "buffer overflow , please slow down send.");
-                return false;
-            }
-#endif
-            if(m_evloop)
-            {
-                if(!m_evloop->IsInWriteLoopThread())
-                {
-                    m_evloop->QueueTaskToWriteLoop(boost::bind(&TcpSock::SendDataInLoop, shared_from_this(),
-                            std::string(pdata, size)));
-                    return true;
-                }
-            }
+            m_errno = EWOULDBLOCK;
+            return false;
+        }
+        size_t queued = __sync_add_and_fetch(&m_queued_bytes, frame.size());
+        // only the one crossing the high water will notify.
+        if(queued >= high_water && __sync_bool_compare_and_swap(&m_above_high, 0, HIGH_WATER_REACHED))
+        {
+            g_log.Log(lv_debug, "tcp send buffer reach high water, fd:%d, queued:%zu.", m_fd, queued);
+            if(evloop->IsInLoopThread())
+                NotifyHighWater();
             else
-            {
-                g_log.Log(lv_debug, " send data while no EventLoop. fd:%d", m_fd);
-                return false;
-            }
-            SendDataInLoop(pdata, size);
-            return true;
+                evloop->QueueTaskToLoop(boost::bind(&TcpSock::NotifyHighWater, shared_from_this()));
         }
-        catch(...)
+    }
+    else
+    {
+        __sync_add_and_fetch(&m_queued_bytes, frame.size());
+    }
+    OutFrameNode* node = new OutFrameNode;
+    node->frame = frame;
+    node->next = m_outqueue_head;
+    while(!__sync_bool_compare_and_swap(&m_outqueue_head, node->next, node))
+    {
+        node->next = m_outqueue_head;
+    }
+    if(m_batch_window_us > 0 && 
+        __sync_add_and_fetch(&m_batch_bytes, frame.size()) < m_batch_max_bytes)
+    {
+        // only the first frame of the batch will start the window, and the window
+        // will not be renewed by the following frames.
+        if(__sync_lock_test_and_set(&m_batch_pending, 1) == 0)
         {
+            if(evloop->IsInLoopThread())
+                ScheduleBatchFlush();
+            else
+                evloop->QueueTaskToLoop(boost::bind(&TcpSock::ScheduleBatchFlush, shared_from_this()));
         }
+        return true;
     }
-    g_log.Log(lv_error, "send data to outbuf error.");
-    return false;
+    if(evloop->IsInLoopThread())
+    {
+        // the data will be sent by the outer sending if called in the onSend callback.
+        if(!m_in_sending)
+            FlushOutQueue();
+        return true;
+    }
+    // only the first frame queued on the idle tcp will wake up the loop to flush.
+    if(__sync_lock_test_and_set(&m_flush_pending, 1) == 0)
+    {
+        evloop->QueueTaskToLoop(boost::bind(&TcpSock::FlushOutQueue, shared_from_this()));
+    }
+    return true;
 }
+
 void TcpSock::SetSockHandler(const SockHandler& cb)
 {
     m_sockcb = cb;
@@ -444,14 +760,20 @@ void TcpSock::HandleEvent()
 {
     if(IsClosed())
         return;
-    assert(m_evloop->IsInLoopThread() || m_evloop->IsInWriteLoopThread());
+    assert(m_evloop->IsInLoopThread());
+    if(m_listening)
+    {
+        if(m_sockev.hasRead())
+            HandleAccept();
+        return;
+    }
+    if(m_connecting)
+    {
+        HandleConnect();
+        return;
+    }
     if( m_sockev.hasRead() )
     {
-        if(m_evloop && !m_evloop->IsInLoopThread())
-        {
-            //read event will be only handled in read thread.
-            return;
-        }
         // edge triggered mode in epoll will not notify the old event again,
         // so we should keep reading or writing until EAGAIN happened.
         while(true)
@@ -473,6 +795,7 @@ void TcpSock::HandleEvent()
             else if(readed > 0)
             {
                 m_inbuf.push_back_withoutdata(readed);
+                m_evloop->AddIOBytes(readed);
                 if(readed == m_tmp_blocksize)
                 {
                     g_log.Log(lv_debug, "resizing the tmpbuf size to %d.", m_tmp_blocksize*2);
@@ -519,22 +842,15 @@ void TcpSock::HandleEvent()
             }
         }
     }
+    if(IsClosed())
+        return;
     if( m_sockev.hasWrite() && m_writeable )
     {
-        if(m_evloop && !m_evloop->IsInWriteLoopThread())
-        {
-            // write event will only be handled in write thread
-            return;
-        }
         if(!DoSend())
             return;
     }
     if( m_sockev.hasException() )
     {
-        if(m_evloop && !m_evloop->IsInLoopThread())
-        {
-            return;
-        }
         m_errno = errno;
         if(m_sockcb.onError)
         {
@@ -609,6 +925,218 @@ bool TcpSock::Connect(const std::string ip, unsigned short int port, struct time
     return true;
 }
 
+bool TcpSock::AsyncConnect(const std::string& ip, unsigned short int port, int timeout_ms)
+{
+    assert(m_fd == -1);
+    struct sockaddr_in dest_address;
+    memset(&dest_address, 0, sizeof(dest_address));
+    dest_address.sin_family = AF_INET;
+    inet_pton(AF_INET, ip.c_str(), &dest_address.sin_addr);
+    dest_address.sin_port = htons(port);
+
+    m_fd = socket(AF_INET, SOCK_STREAM, 0);
+    if(m_fd == -1)
+    {
+        m_errno = errno;
+        g_log.Log(lv_error, "create socket fd failed while async connect.");
+        return false;
+    }
+    SetCloseAfterExec();
+    if(!core::utility::set_fd_nonblock(m_fd))
+    {
+        m_errno = errno;
+        ::close(m_fd);
+        m_fd = -1;
+        return false;
+    }
+    if( (0 != connect(m_fd, (struct sockaddr *)&dest_address, sizeof(dest_address))) &&
+        (errno != EINPROGRESS) )
+    {
+        m_errno = errno;
+        g_log.Log(lv_error, "async connect to %s:%d error. errno:%d", ip.c_str(), port, m_errno);
+        ::close(m_fd);
+        m_fd = -1;
+        return false;
+    }
+    // even if connected immediately, we finish the connect in the loop thread by the writable event,
+    // so the onConnect handler is always called in the loop.
+    m_connecting = true;
+    m_writeable = false;
+    m_allow_more_send = true;
+    m_isclosing = false;
+    m_desthost.host_ip = ip;
+    m_desthost.host_port = port;
+    m_caredev.AddEvent(EV_WRITE);
+    if(timeout_ms > 0)
+    {
+        m_timeout_renew = timeout_ms;
+        m_timeout_ms = core::utility::GetTickCount() + timeout_ms;
+        m_is_timeout_need = true;
+    }
+    return true;
+}
+
+bool TcpSock::IsConnecting() const
+{
+    return m_connecting;
+}
+
+void TcpSock::HandleConnect()
+{
+    int connecterr = 0;
+    socklen_t errlen = sizeof(connecterr);
+    if(0 != getsockopt(m_fd, SOL_SOCKET, SO_ERROR, (void*)&connecterr, &errlen))
+        connecterr = errno;
+    if(connecterr != 0)
+    {
+        m_errno = connecterr;
+        g_log.Log(lv_warn, "async connect to %s:%d failed. errno:%d", m_desthost.host_ip.c_str(), 
+            m_desthost.host_port, m_errno);
+        ConnectFinished(false);
+        return;
+    }
+    if(!m_sockev.hasWrite())
+        return;
+    ConnectFinished(true);
+}
+
+void TcpSock::ConnectFinished(bool connected)
+{
+    m_connecting = false;
+    // the connect timeout is not used any more, set the timeout again in onConnect if needed.
+    m_is_timeout_need = false;
+    if(!connected)
+    {
+        if(m_sockcb.onConnect)
+            m_sockcb.onConnect(shared_from_this(), false);
+        Close();
+        return;
+    }
+    m_writeable = true;
+    m_alive_counter = ALIVE_NUM;
+    if(m_sockcb.onConnect)
+        m_sockcb.onConnect(shared_from_this(), true);
+    if(IsClosed())
+        return;
+    TakeOutQueue();
+    if(HasDataToSend())
+    {
+        // the write event is still cared, so the left data will be sent on next writable.
+        DoSend();
+        return;
+    }
+    RemoveAndUpdateEvent(EV_WRITE);
+}
+
+bool TcpSock::Listen(const std::string& ip, unsigned short int port, int backlog, bool reuseport)
+{
+    assert(m_fd == -1);
+    struct sockaddr_in listen_address;
+    memset(&listen_address, 0, sizeof(listen_address));
+    listen_address.sin_family = AF_INET;
+    if(ip.empty())
+        listen_address.sin_addr.s_addr = htonl(INADDR_ANY);
+    else
+        inet_pton(AF_INET, ip.c_str(), &listen_address.sin_addr);
+    listen_address.sin_port = htons(port);
+
+    m_fd = socket(AF_INET, SOCK_STREAM, 0);
+    if(m_fd == -1)
+    {
+        m_errno = errno;
+        g_log.Log(lv_error, "create socket fd failed while listen.");
+        return false;
+    }
+    // the accept will be looped until EAGAIN, so the listening fd must be nonblock.
+    SetCloseAfterExec();
+    if(!core::utility::set_fd_nonblock(m_fd))
+    {
+        m_errno = errno;
+        ::close(m_fd);
+        m_fd = -1;
+        return false;
+    }
+    // set SO_REUSEADDR in order to restart quickly after crash
+    int optval = 1;
+    setsockopt(m_fd, SOL_SOCKET, SO_REUSEADDR, &optval, sizeof(optval));
+#ifdef SO_REUSEPORT
+    if(reuseport && (0 != setsockopt(m_fd, SOL_SOCKET, SO_REUSEPORT, &optval, sizeof(optval))))
+    {
+        g_log.Log(lv_warn, "set SO_REUSEPORT failed on port:%d, errno:%d.", port, errno);
+    }
+#endif
+    if(backlog <= 0)
+        backlog = DEFAULT_LISTEN_BACKLOG;
+    if( (0 != bind(m_fd, (struct sockaddr *)&listen_address, sizeof(listen_address))) ||
+        (0 != listen(m_fd, backlog)) )
+    {
+        m_errno = errno;
+        g_log.Log(lv_warn, "bind or listen on port:%d failed, errno:%d.", port, m_errno);
+        ::close(m_fd);
+        m_fd = -1;
+        return false;
+    }
+    // the port 0 is bound to a free port by the system.
+    if(port == 0)
+    {
+        socklen_t addrlen = sizeof(listen_address);
+        if(0 == getsockname(m_fd, (struct sockaddr *)&listen_address, &addrlen))
+            port = ntohs(listen_address.sin_port);
+    }
+    m_listening = true;
+    m_isclosing = false;
+    m_desthost.host_ip = ip;
+    m_desthost.host_port = port;
+    return true;
+}
+
+bool TcpSock::IsListening() const
+{
+    return m_listening;
+}
+
+void TcpSock::HandleAccept()
+{
+    // edge triggered mode in epoll will not notify the pending connections again,
+    // so we accept until EAGAIN happened.
+    while(!IsClosed())
+    {
+        struct sockaddr_in client_address;
+        socklen_t client_len = sizeof(client_address);
+#if defined (__APPLE__) || defined (__MACH__) 
+        int client_fd = accept(m_fd, (struct sockaddr*)&client_address, &client_len);
+#else
+        int client_fd = accept4(m_fd, (struct sockaddr*)&client_address, &client_len, SOCK_NONBLOCK|SOCK_CLOEXEC);
+#endif
+        if(client_fd < 0)
+        {
+            if(errno == EINTR || errno == ECONNABORTED)
+                continue;
+            if(errno != EAGAIN && errno != EWOULDBLOCK)
+            {
+                // such as EMFILE, the left connections will be accepted on next readable event.
+                m_errno = errno;
+                g_log.Log(lv_error, "accept error on fd:%d, errno:%d.", m_fd, m_errno);
+            }
+            break;
+        }
+        char ipstr[INET_ADDRSTRLEN];
+        TcpSockSmartPtr sp_tcp(new TcpSock(client_fd, 
+                inet_ntop(AF_INET, &client_address.sin_addr, ipstr, sizeof(ipstr)), ntohs(client_address.sin_port)));
+#if defined (__APPLE__) || defined (__MACH__) 
+        sp_tcp->SetNonBlock();
+        sp_tcp->SetCloseAfterExec();
+#endif
+        if(!m_sockcb.onAccept || !m_sockcb.onAccept(sp_tcp))
+        {
+            sp_tcp->Close();
+            continue;
+        }
+        if(m_evloop)
+            m_evloop->AddTcpSockToLoop(sp_tcp);
+    }
+}
+
 bool TcpSock::GetDestHost(std::string& ip, unsigned short int& port) const
 {
     if(m_desthost.host_ip == "")
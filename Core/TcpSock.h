@@ -1,119 +1,195 @@
-#ifndef  CORE_NET_TCPSOCK_H
-#define  CORE_NET_TCPSOCK_H
-
-#include "SockHandler.h"
-#include "SockEvent.hpp"
-#include "lock.hpp"
-#include "FastBuffer.h"
-#include <vector>
-#include <boost/shared_array.hpp>
-#include <boost/shared_ptr.hpp>
-#include <boost/noncopyable.hpp>
-#include <boost/enable_shared_from_this.hpp>
-
-namespace core { namespace net {
-class EventLoop;
-class TcpSock : private boost::noncopyable, public boost::enable_shared_from_this<TcpSock>
-{
-public:
-    TcpSock();
-    TcpSock(int fd, const std::string& ip, unsigned short int port);
-    ~TcpSock();
-
-    //typedef std::vector< char > SockBufferT;
-    typedef FastBuffer SockBufferT;
-
-    int GetFD() const;
-    bool  IsClosed() const;
-    bool  SetNonBlock();
-    void  SetCloseAfterExec();
-    void  SetCaredSockEvent(SockEvent caredev);
-    SockEvent GetCaredSockEvent() const;
-    SockEvent GetCurrentEvent() const;
-    void  AddEvent(EventResult er);
-    void  ClearEvent();
-    //bool  IsNeedWrite();
-    void  DisAllowSend();
-    bool  Writeable() const;
-        // return false if buffer is full.
-    // 将数据放到缓存,等待可以发送的时候自动发送
-    bool SendData(const char* pdata, size_t size);
-    void SetSockHandler(const SockHandler& cb);
-    void HandleEvent();
-    //const SockBufferT& GetInbuf() const;
-    //const SockBufferT& GetOutbuf() const;
-    bool GetDestHost(std::string& ip, unsigned short int& port) const;
-    bool Connect(const std::string ip, unsigned short int port, struct timeval& tv_timeout); 
-    int GetLastError() const;
-    // set -1 to disable timeout.
-    void SetTimeout(int to_ms);
-    void UpdateTimeout();
-    void RenewTimeout();
-    void  SetEventLoop(EventLoop* pev);
-    // 服务端需要有主动关闭时,调用DisAllowSend即可
-    // if no response, the server can close the fd. must be called in loop thread
-    void  Close(bool needremove = true);
-private:
-    void SendDataInLoop(const std::string& data);
-    void SendDataInLoop(const char* pdata, size_t size);
-    void  ShutDownWrite();
-    bool DoSend();
-    void AddAndUpdateEvent(EventResult er);
-    void RemoveAndUpdateEvent(EventResult er);
-    // 每个fd都有2个缓冲区,一个输入,一个输出, 必须使用连续内存, 因此deque不能使用(deque分块连续)
-    SockBufferT m_inbuf;
-    SockBufferT m_outbuf;
-    SockHandler m_sockcb;
-    
-    int  m_fd;
-    int  m_fd_w;  // dup fd for write only
-    // this flag indicate whether the tcp fd is really shutdown write.
-    bool m_writeable;
-    // this flag indicate whether more data is allowed to be send to the outbufffer.
-    volatile bool m_allow_more_send;
-    bool m_isclosing;
-    // the event happened on the TcpSock
-    SockEvent  m_sockev;
-    // the event I cared about.
-    SockEvent  m_caredev;
-    int  m_alive_counter;
-    int  m_errno;
-
-    //boost::shared_array<char> tmpbuf;
-    //core::common::locker m_lock;
-    //SockBufferT  m_tmpoutbuf;
-    struct DestHost
-    {
-        std::string host_ip;
-        unsigned short int host_port;
-    };
-    DestHost  m_desthost;
-    int64_t  m_timeout_ms;
-    int  m_timeout_renew;
-    bool m_is_timeout_need;
-    EventLoop* m_evloop;
-    int  m_tmp_blocksize;
-    bool need_renew_timeout_;
-};
-
-typedef boost::shared_ptr< TcpSock > TcpSockSmartPtr;
-
-struct IsSameTcpSock
-{
-    IsSameTcpSock(TcpSockSmartPtr sp_tcp)
-        :left(sp_tcp)
-    {
-    }
-    bool operator()(TcpSockSmartPtr right)
-    {
-        if(left->IsClosed() || right->IsClosed())
-            return false;
-        return left->GetFD() == right->GetFD();
-    }
-private:
-    TcpSockSmartPtr left;
-};
-
-} }
-
-#endif // end of CORE_NET_TCPSOCK_H
+#ifndef  CORE_NET_TCPSOCK_H
+#define  CORE_NET_TCPSOCK_H
+
+#include "SockHandler.h"
+#include "SockEvent.hpp"
+#include "lock.hpp"
+#include "FastBuffer.h"
+#include "SharedFrame.hpp"
+#include <deque>
+#include <vector>
+#include <boost/shared_array.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/enable_shared_from_this.hpp>
+
+namespace core { namespace net {
+class EventLoop;
+class TimingWheel;
+class TcpSock : private boost::noncopyable, public boost::enable_shared_from_this<TcpSock>
+{
+public:
+    TcpSock();
+    TcpSock(int fd, const std::string& ip, unsigned short int port);
+    ~TcpSock();
+
+    //typedef std::vector< char > SockBufferT;
+    typedef FastBuffer SockBufferT;
+
+    int GetFD() const;
+    bool  IsClosed() const;
+    bool  SetNonBlock();
+    void  SetCloseAfterExec();
+    void  SetCaredSockEvent(SockEvent caredev);
+    SockEvent GetCaredSockEvent() const;
+    SockEvent GetCurrentEvent() const;
+    void  AddEvent(EventResult er);
+    void  ClearEvent();
+    //bool  IsNeedWrite();
+    void  DisAllowSend();
+    bool  Writeable() const;
+    // return false if buffer is full, and GetLastError() will be EWOULDBLOCK, the producer should
+    // wait for the onLowWater before sending more data.
+    // 将数据放到缓存,等待可以发送的时候自动发送
+    // can be called in any thread, the data will be queued without lock and sent in the loop thread.
+    bool SendData(const char* pdata, size_t size);
+    // send the frame without copy, the frame data should not be changed after this.
+    bool SendData(const SharedFrame& frame);
+    // batch mode(cork): the frames queued within window_us or until max_batch_bytes are written together
+    // instead of one write for each frame, TCP_NODELAY is set since the batching is done by us.
+    // the loop spins for the window under 1ms, since it can only sleep in ms.
+    // window_us <= 0 to disable. can be set in any thread.
+    void SetBatchMode(int window_us, size_t max_batch_bytes);
+    // write the queued frames out immediately without waiting the batch window.
+    void Flush();
+    // the new data will be refused after the queued bytes reach high_water until they drop to low_water.
+    // high_water 0 for no limit, low_water 0 for a quarter of the high water.
+    void SetWaterMark(size_t high_water, size_t low_water = 0);
+    // the bytes queued and not written to the network yet, can be read in any thread.
+    size_t GetQueuedBytes() const;
+    bool IsHighWater() const;
+    void SetSockHandler(const SockHandler& cb);
+    void HandleEvent();
+    //const SockBufferT& GetInbuf() const;
+    //const SockBufferT& GetOutbuf() const;
+    bool GetDestHost(std::string& ip, unsigned short int& port) const;
+    bool Connect(const std::string ip, unsigned short int port, struct timeval& tv_timeout); 
+    // start a nonblock connect and return immediately, the tcp should be added to a loop after this,
+    // and the loop will wait for the writable event to finish the connect and call the onConnect
+    // handler. the data sent before connected will be queued and flushed after connected.
+    // timeout_ms <= 0 for no connect timeout.
+    bool AsyncConnect(const std::string& ip, unsigned short int port, int timeout_ms);
+    bool IsConnecting() const;
+    // listen on ip:port(empty ip for any), the listening tcp should be added to a loop with onAccept handler,
+    // and the new tcp will be accepted directly in that loop. with reuseport each loop can have its own
+    // listener on the same port, and the kernel will balance the new connections between them.
+    bool Listen(const std::string& ip, unsigned short int port, int backlog, bool reuseport);
+    bool IsListening() const;
+    int GetLastError() const;
+    // set -1 to disable timeout. the timeout is checked by the timing wheel of the event loop.
+    void SetTimeout(int to_ms);
+    void UpdateTimeout();
+    void RenewTimeout();
+    void  SetEventLoop(EventLoop* pev);
+    // 服务端需要有主动关闭时,调用DisAllowSend即可
+    // if no response, the server can close the fd. must be called in loop thread
+    void  Close(bool needremove = true);
+private:
+    friend class TimingWheel;
+    // the node of the lock-free outbound queue, pushed by any thread
+    // and taken all at once by the loop thread.
+    struct OutFrameNode
+    {
+        OutFrameNode* next;
+        SharedFrame frame;
+    };
+    // move all the queued frames to the sending frames in loop thread.
+    void TakeOutQueue();
+    void ClearOutQueue();
+    void FlushOutQueue();
+    void ScheduleBatchFlush();
+    void OnBatchFlushTimeout();
+    void SetCork(bool cork);
+    void NotifyHighWater();
+    void SentBytes(size_t bytes);
+    void ResetHighWater();
+    bool HasDataToSend() const;
+    void  ShutDownWrite();
+    bool DoSend();
+    void HandleAccept();
+    void HandleConnect();
+    void ConnectFinished(bool connected);
+    void AddAndUpdateEvent(EventResult er);
+    void RemoveAndUpdateEvent(EventResult er);
+    // 每个fd都有2个缓冲区,一个输入,一个输出, 必须使用连续内存, 因此deque不能使用(deque分块连续)
+    SockBufferT m_inbuf;
+    // the frames queued by other threads, in the reverse order of queued.
+    OutFrameNode* volatile m_outqueue_head;
+    // a flush has been queued to the loop, so the following queued frames need not to wake up the loop.
+    volatile int m_flush_pending;
+    // the frames waiting to be written, only used in loop thread.
+    std::deque<SharedFrame> m_sending_frames;
+    // the bytes of the first sending frame which have been written.
+    size_t m_sending_offset;
+    bool m_in_sending;
+    // the batch window in us, 0 for no batch.
+    volatile int m_batch_window_us;
+    volatile size_t m_batch_max_bytes;
+    // the bytes queued since last flush in batch mode.
+    volatile size_t m_batch_bytes;
+    // a batch flush is waiting for the window timeout in the loop.
+    volatile int m_batch_pending;
+    volatile size_t m_high_water;
+    volatile size_t m_low_water;
+    // the bytes queued by SendData and not written yet.
+    volatile size_t m_queued_bytes;
+    // the queued bytes has reached the high water and not dropped to the low water.
+    volatile int m_above_high;
+    SockHandler m_sockcb;
+    
+    int  m_fd;
+    int  m_fd_w;  // dup fd for write only
+    // this flag indicate whether the tcp fd is really shutdown write.
+    bool m_writeable;
+    // this flag indicate whether more data is allowed to be send to the outbufffer.
+    volatile bool m_allow_more_send;
+    bool m_isclosing;
+    bool m_listening;
+    // the asynchronous connect is in progress.
+    bool m_connecting;
+    // the event happened on the TcpSock
+    SockEvent  m_sockev;
+    // the event I cared about.
+    SockEvent  m_caredev;
+    int  m_alive_counter;
+    int  m_errno;
+
+    //boost::shared_array<char> tmpbuf;
+    //core::common::locker m_lock;
+    //SockBufferT  m_tmpoutbuf;
+    struct DestHost
+    {
+        std::string host_ip;
+        unsigned short int host_port;
+    };
+    DestHost  m_desthost;
+    int64_t  m_timeout_ms;
+    int  m_timeout_renew;
+    bool m_is_timeout_need;
+    // whether the tcp is waiting in the timing wheel.
+    bool m_timeout_scheduled;
+    EventLoop* m_evloop;
+    int  m_tmp_blocksize;
+};
+
+typedef boost::shared_ptr< TcpSock > TcpSockSmartPtr;
+
+struct IsSameTcpSock
+{
+    IsSameTcpSock(TcpSockSmartPtr sp_tcp)
+        :left(sp_tcp)
+    {
+    }
+    bool operator()(TcpSockSmartPtr right)
+    {
+        if(left->IsClosed() || right->IsClosed())
+            return false;
+        return left->GetFD() == right->GetFD();
+    }
+private:
+    TcpSockSmartPtr left;
+};
+
+} }
+
+#endif // end of CORE_NET_TCPSOCK_H
@@ -0,0 +1,101 @@
+#include "TimingWheel.h"
+#include "CommonUtility.hpp"
+#include "SimpleLogger.h"
+
+namespace core { namespace net {
+
+static LoggerCategory g_log("TimingWheel");
+
+TimingWheel::TimingWheel(int tick_ms, int slot_num)
+    :m_slots(slot_num > 0 ? slot_num : 1),
+    m_tick_ms(tick_ms > 0 ? tick_ms : 1),
+    m_now(0),
+    m_cur_tick(0),
+    m_total(0)
+{
+    UpdateNow();
+    m_cur_tick = m_now / m_tick_ms;
+}
+
+int64_t TimingWheel::UpdateNow()
+{
+    m_now = core::utility::GetCoarseTickCount();
+    return m_now;
+}
+
+void TimingWheel::Schedule(TcpSockSmartPtr sp_tcp)
+{
+    if(!sp_tcp || sp_tcp->m_timeout_scheduled || !sp_tcp->m_is_timeout_need)
+        return;
+    ScheduleInSlot(sp_tcp);
+}
+
+void TimingWheel::ScheduleInSlot(TcpSockSmartPtr sp_tcp)
+{
+    int64_t tick = sp_tcp->m_timeout_ms / m_tick_ms;
+    // the passed tick will be never checked again, so put it to the next one.
+    if(tick <= m_cur_tick)
+        tick = m_cur_tick + 1;
+    m_slots[tick % m_slots.size()].push_back(sp_tcp);
+    sp_tcp->m_timeout_scheduled = true;
+    ++m_total;
+}
+
+void TimingWheel::Expire()
+{
+    int64_t now_tick = m_now / m_tick_ms;
+    if(now_tick <= m_cur_tick)
+        return;
+    // each slot need to be checked only once even if we have not been waked up for a long time.
+    if(now_tick - m_cur_tick > (int64_t)m_slots.size())
+        m_cur_tick = now_tick - m_slots.size();
+    while(m_cur_tick < now_tick)
+    {
+        ++m_cur_tick;
+        SlotT& slot = m_slots[m_cur_tick % m_slots.size()];
+        if(slot.empty())
+            continue;
+        m_expiring.swap(slot);
+        m_total -= m_expiring.size();
+        for(size_t i = 0; i < m_expiring.size(); ++i)
+        {
+            TcpSockSmartPtr sp_tcp = m_expiring[i].lock();
+            if(!sp_tcp)
+                continue;
+            sp_tcp->m_timeout_scheduled = false;
+            if(sp_tcp->IsClosed() || !sp_tcp->m_is_timeout_need)
+                continue;
+            // the timeout callback will be called if the deadline reached.
+            sp_tcp->UpdateTimeout();
+            if(!sp_tcp->IsClosed() && sp_tcp->m_is_timeout_need && !sp_tcp->m_timeout_scheduled)
+                ScheduleInSlot(sp_tcp);
+        }
+        m_expiring.clear();
+    }
+}
+
+int TimingWheel::NextTimeoutMs() const
+{
+    if(m_total == 0)
+        return -1;
+    int64_t tick = m_cur_tick + 1;
+    for(size_t i = 0; i < m_slots.size(); ++i, ++tick)
+    {
+        if(!m_slots[tick % m_slots.size()].empty())
+            break;
+    }
+    int64_t ms = tick * m_tick_ms - m_now;
+    return ms > 0 ? (int)ms : 0;
+}
+
+void TimingWheel::Clear()
+{
+    for(size_t i = 0; i < m_slots.size(); ++i)
+    {
+        SlotT().swap(m_slots[i]);
+    }
+    SlotT().swap(m_expiring);
+    m_total = 0;
+}
+
+} }
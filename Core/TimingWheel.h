@@ -0,0 +1,48 @@
+#ifndef  CORE_NET_TIMINGWHEEL_H
+#define  CORE_NET_TIMINGWHEEL_H
+
+#include "TcpSock.h"
+#include <stdint.h>
+#include <vector>
+#include <boost/weak_ptr.hpp>
+#include <boost/noncopyable.hpp>
+
+namespace core { namespace net {
+
+// hashed timing wheel for the tcp timeout in one event loop.
+// the tcp is hashed to the slot of its timeout tick, and checked again only when
+// the slot expired. renew the timeout only need to change the deadline in tcp, 
+// the tcp will be moved to the new slot while the old slot expired.
+// all the functions must be called in the loop thread.
+class TimingWheel : private boost::noncopyable
+{
+public:
+    TimingWheel(int tick_ms, int slot_num);
+    // update the cached clock, should be called once for each loop iteration.
+    int64_t UpdateNow();
+    int64_t Now() const { return m_now; }
+    // add the tcp to the wheel, the tcp which has been in the wheel will be ignored.
+    void Schedule(TcpSockSmartPtr sp_tcp);
+    // check all the slots passed since last expire, the timeout of the tcp will be triggered
+    // if the deadline reached, and the others will be scheduled to the slot of new deadline.
+    void Expire();
+    // the time in ms from now to the first slot which has tcp, -1 if the wheel is empty.
+    int  NextTimeoutMs() const;
+    size_t Size() const { return m_total; }
+    void Clear();
+private:
+    typedef std::vector< boost::weak_ptr<TcpSock> > SlotT;
+    void ScheduleInSlot(TcpSockSmartPtr sp_tcp);
+    std::vector<SlotT>  m_slots;
+    // reuse the expired slot to avoid allocation.
+    SlotT      m_expiring;
+    int        m_tick_ms;
+    int64_t    m_now;
+    // the last tick that has been expired.
+    int64_t    m_cur_tick;
+    size_t     m_total;
+};
+
+} }
+
+#endif // end of CORE_NET_TIMINGWHEEL_H
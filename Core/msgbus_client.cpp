@@ -2,6 +2,7 @@
 #include "NetMsgBusServerConnMgr.hpp"
 #include "NetMsgBusReceiverMgr.hpp"
 #include "NetMsgBusReq2ReceiverMgr.hpp"
+#include "NetMsgBusBusyStateReporter.hpp"
 #include "MsgHandlerMgr.h"
 
 #include <stdio.h>
@@ -16,6 +17,7 @@ namespace NetMsgBus
 static ServerConnMgr   s_server_connmgr;
 static ReceiverMgr     s_receiver_mgr;
 static Req2ReceiverMgrPtr sp_req2receiver_mgr;
+static BusyStateReporter s_busystate_reporter(s_server_connmgr, s_receiver_mgr);
 
 // 以同步方式发送数据请求到客户端，并将客户端返回的数据保存在指定变量中。
 bool msgbus_sendmsg_direct_to_client(const std::string& clientname, uint32_t data_len, 
@@ -64,6 +66,12 @@ bool msgbus_update_receiver_busystate(kServerBusyState busy_state)
     return s_server_connmgr.UpdateReceiverBusyState(busy_state);
 }
 
+// 根据本地消息队列长度、消息处理耗时和接收缓存大小自动更新负载状态
+bool msgbus_set_busystate_report(int interval_sec)
+{
+    return s_busystate_reporter.Start(interval_sec);
+}
+
 // 使用服务器中转发送消息
 bool msgbus_postmsg_use_server_relay(const std::string& clientname, uint32_t data_len, boost::shared_array<char> data)
 {
@@ -92,6 +100,37 @@ boost::shared_ptr<NetFuture> msgbus_postmsg_direct_to_client(const std::string&
     return sp_req2receiver_mgr->PostMsgDirectToClient(dest_ip, dest_port, data_len, data, callback);
 }
 
+bool msgbus_is_receiver_send_blocked(const std::string& clientname)
+{
+    if(!sp_req2receiver_mgr)
+        return false;
+    return sp_req2receiver_mgr->IsReceiverSendBlocked(clientname);
+}
+
+bool msgbus_is_server_send_blocked()
+{
+    return s_server_connmgr.IsServerSendBlocked();
+}
+
+bool msgbus_set_postmsg_batch(int window_us, size_t max_batch_bytes)
+{
+    if(!sp_req2receiver_mgr)
+        return false;
+    sp_req2receiver_mgr->SetPostMsgBatchMode(window_us, max_batch_bytes);
+    return true;
+}
+
+void msgbus_flush_postmsg()
+{
+    if(sp_req2receiver_mgr)
+        sp_req2receiver_mgr->FlushPostMsg();
+}
+
+void msgbus_set_compress(size_t min_bytes)
+{
+    s_server_connmgr.SetCompressThreshold(min_bytes);
+}
+
 bool msgbus_req_receiver_info(const std::string& clientname, std::string& ip, unsigned short int& port)
 {
     return s_server_connmgr.ReqReceiverInfo(clientname, ip, port);
@@ -102,6 +141,39 @@ bool msgbus_query_available_services(const std::string& match_str, std::string&
     return s_server_connmgr.QueryAvailableServices(match_str, rsp);
 }
 
+bool msgbus_req_receivers_info(const std::vector<std::string>& clientnames)
+{
+    return s_server_connmgr.ReqReceiversInfo(clientnames);
+}
+
+bool msgbus_register_services(const std::vector<std::string>& service_names)
+{
+    return s_server_connmgr.RegisterServices(service_names);
+}
+
+static void on_service_changed(const std::string& clientname, const std::vector<ClientHost>& hosts)
+{
+    Req2ReceiverMgrPtr req2receiver_mgr = sp_req2receiver_mgr;
+    if(req2receiver_mgr)
+        req2receiver_mgr->UpdateCachedHostInfo(clientname, hosts);
+}
+
+// 订阅以match_prefix开头的服务的变化, 服务器会推送这些服务的接收者信息以更新本地缓存
+bool msgbus_subscribe_services(const std::string& match_prefix, bool unsubscribe)
+{
+    return s_server_connmgr.SubscribeServices(match_prefix, unsubscribe);
+}
+
+bool msgbus_advertise_messages(const std::vector<std::string>& msgids, const std::vector<std::string>& msgid_prefixes)
+{
+    return s_server_connmgr.AdvertiseMessages(msgids, msgid_prefixes);
+}
+
+bool msgbus_query_service_messages(const std::string& service_name, const std::string& match_prefix, std::string& rsp)
+{
+    return s_server_connmgr.QueryServiceMessages(service_name, match_prefix, rsp);
+}
+
 //void msgbus_disconnect_receiver(const std::string& name)
 //{
 //    if(sp_req2receiver_mgr)
@@ -128,6 +200,7 @@ bool init_netmsgbus_client(const std::string& serverip, unsigned short int serve
     sp_req2receiver_mgr->SetServerConnMgr(&s_server_connmgr);
     if(!sp_req2receiver_mgr->Start())
         return false;
+    s_server_connmgr.SetServiceChangeHandler(on_service_changed);
 
     return true;
 }
@@ -140,6 +213,8 @@ void disconnect_from_server()
 
 void destroy_netmsgbus_client()
 {
+    s_busystate_reporter.Stop();
+    s_server_connmgr.SetServiceChangeHandler(NULL);
     s_receiver_mgr.StopReceiver();
     if(sp_req2receiver_mgr)
         sp_req2receiver_mgr->Stop();
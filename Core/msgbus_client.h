@@ -4,6 +4,7 @@
 #include "NetMsgBusFuture.hpp"
 #include <boost/shared_array.hpp>
 #include <string>
+#include <vector>
 
 namespace NetMsgBus
 {
@@ -12,7 +13,9 @@ class NetFuture;
 bool msgbus_register_client_receiver(const std::string& clientip, unsigned short int& clientport,
    const std::string& clientname, kServerBusyState busy_state = LOW);
 // 更新本地消息接收者的负载状态以便服务器动态选择客户端
-bool msgbus_update_receiver_busystate(const std::string& clientname, kServerBusyState busy_state);
+bool msgbus_update_receiver_busystate(kServerBusyState busy_state);
+// 根据本地负载自动更新消息接收者的负载状态, 每interval_sec秒检查一次, 状态变化时才通知服务器, 0表示关闭
+bool msgbus_set_busystate_report(int interval_sec);
 // 向服务器请求某个命名的消息接收者主机信息，然后缓存此客户端信息
 bool msgbus_req_receiver_info(const std::string& clientname, std::string& ip, unsigned short int& port);
 // 通过服务器中转发送消息，支持以前缀的方式匹配一组客户端名称，然后进行组广播消息
@@ -33,8 +36,28 @@ bool msgbus_sendmsg_direct_to_client(const std::string& clientname, uint32_t dat
 bool msgbus_sendmsg_direct_to_client(const std::string& dest_ip, unsigned short dest_port, uint32_t data_len, 
    boost::shared_array<char> data, std::string& rsp_content, int32_t timeout_sec = 30);
 //void msgbus_disconnect_receiver(const std::string& name);
+// 批量发送直接投递到客户端的消息, window_us时间内或者累计max_batch_bytes字节的消息合并发送, window_us为0时关闭
+bool msgbus_set_postmsg_batch(int window_us, size_t max_batch_bytes);
+// 立即发送所有批量等待中的消息
+void msgbus_flush_postmsg();
+// 通过服务器中转的消息不小于min_bytes时进行压缩(如果服务器支持), 0表示不压缩
+void msgbus_set_compress(size_t min_bytes);
+
+// 发送缓冲区是否已达到高水位, 此时发送消息会失败并设置errno为EWOULDBLOCK, 应等待一段时间后再发送
+bool msgbus_is_receiver_send_blocked(const std::string& clientname);
+bool msgbus_is_server_send_blocked();
 
 bool msgbus_query_available_services(const std::string& match_str, std::string& rsp);
+// 一次请求获取多个接收者的所有地址和状态并更新本地缓存
+bool msgbus_req_receivers_info(const std::vector<std::string>& clientnames);
+// 一次请求将已注册的接收者注册为多个服务
+bool msgbus_register_services(const std::vector<std::string>& service_names);
+// 订阅以match_prefix开头的服务的变化, 服务器推送的接收者信息会直接更新本地缓存
+bool msgbus_subscribe_services(const std::string& match_prefix, bool unsubscribe = false);
+// 告知服务器本客户端处理的消息, 服务器只转发这些消息的广播给本客户端
+bool msgbus_advertise_messages(const std::vector<std::string>& msgids, const std::vector<std::string>& msgid_prefixes);
+// 查询服务声明处理的消息, 以','分隔, 前缀以'*'结尾
+bool msgbus_query_service_messages(const std::string& service_name, const std::string& match_prefix, std::string& rsp);
 
 bool init_netmsgbus_client(const std::string& serverip, unsigned short int serverport);
 void destroy_netmsgbus_client();
@@ -1,8 +1,10 @@
 #include "msgbus_def.h"
 #include <string>
+#include <algorithm>
 #include <string.h>
 #include <stdio.h>
 #include <arpa/inet.h>
+#include <zlib.h>
 
 namespace NetMsgBus
 {
@@ -875,4 +877,513 @@ uint32_t MsgBusPackPBType::Size()
 }
 
 
+#define MSGBUS_HEAD_MAGIC 0x66
+// the max number of the interned names in each direction of one connection, the names after
+// that are sent without interning.
+#define MAX_INTERNED_NAMES 4096
+// the content type in the v2 REQ_SENDMSG body.
+#define SENDMSG_CONTENT_RAW     0
+#define SENDMSG_CONTENT_NETMSG  1
+// only the first msgids of each direction have the dictionaries, and zlib only uses the last 32KB.
+#define MAX_DICT_MSGIDS 256
+#define MAX_DICT_BYTES  32768
+// the larger bodies are sent without compression, so a peer can not force a huge allocation
+// by a small compressed body. the inflated body grows from the chunk as the data is inflated.
+#define MAX_INFLATED_BODY_LEN  (4*1024*1024)
+#define INFLATE_CHUNK_LEN      (64*1024)
+// the max ratio of deflate is about 1032:1.
+#define MAX_DEFLATE_RATIO      1032
+
+static void PutVarint(std::string& out, uint32_t v)
+{
+    while(v >= 0x80)
+    {
+        out.push_back((char)((v & 0x7f) | 0x80));
+        v >>= 7;
+    }
+    out.push_back((char)v);
+}
+
+// return 1 if success, 0 if need more data, -1 if the varint is broken.
+static int GetVarint(const char*& p, const char* end, uint32_t& v)
+{
+    v = 0;
+    const char* cur = p;
+    for(int shift = 0; shift < 35; shift += 7)
+    {
+        if(cur >= end)
+            return 0;
+        uint8_t b = (uint8_t)*cur++;
+        v |= (uint32_t)(b & 0x7f) << shift;
+        if((b & 0x80) == 0)
+        {
+            p = cur;
+            return 1;
+        }
+    }
+    return -1;
+}
+
+// the content generated by the netmsgbus client:
+// 1 byte sender len + sender + 1 byte msgid len + msgid + 4 bytes param len + param.
+static bool ParseNetMsgContent(const char* content, uint32_t len, uint32_t& sender_len,
+    uint32_t& msgid_len, uint32_t& param_len)
+{
+    if(len < 1)
+        return false;
+    sender_len = (uint8_t)content[0];
+    if(len < 1 + sender_len + 1)
+        return false;
+    msgid_len = (uint8_t)content[1 + sender_len];
+    uint32_t param_offset = 1 + sender_len + 1 + msgid_len;
+    if(len < param_offset + sizeof(uint32_t))
+        return false;
+    uint32_t netparam_len;
+    memcpy(&netparam_len, content + param_offset, sizeof(netparam_len));
+    param_len = ntohl(netparam_len);
+    return len - param_offset - sizeof(uint32_t) == param_len;
+}
+
+MsgBusWireCodec::MsgBusWireCodec()
+    :m_peer_version(MSGBUS_PROTOCOL_V1),
+    m_peer_compress_algs(0),
+    m_compress_threshold(0),
+    m_intern_names(true),
+    m_deflate_stream(NULL),
+    m_inflate_stream(NULL)
+{
+}
+
+MsgBusWireCodec::~MsgBusWireCodec()
+{
+    if(m_deflate_stream)
+    {
+        deflateEnd(m_deflate_stream);
+        delete m_deflate_stream;
+    }
+    if(m_inflate_stream)
+    {
+        inflateEnd(m_inflate_stream);
+        delete m_inflate_stream;
+    }
+}
+
+void MsgBusWireCodec::SetCompressThreshold(uint32_t min_bytes)
+{
+    m_compress_threshold = min_bytes;
+}
+
+void MsgBusWireCodec::OnPeerVersion(uint16_t version)
+{
+    // the old peer only knows v1 and sends 0x0001.
+    int peer_version = (version >> 8) & 0x0f;
+    if(peer_version < MSGBUS_PROTOCOL_V1)
+        peer_version = MSGBUS_PROTOCOL_V1;
+    if(peer_version > MSGBUS_PROTOCOL_MAX)
+        peer_version = MSGBUS_PROTOCOL_MAX;
+    m_peer_version = peer_version;
+    m_peer_compress_algs = (version >> 12) & MSGBUS_COMPRESS_ALGS;
+}
+
+bool MsgBusWireCodec::IsCompactEnabled() const
+{
+    return m_peer_version >= MSGBUS_PROTOCOL_V2;
+}
+
+bool MsgBusWireCodec::IsCompressEnabled() const
+{
+    return m_compress_threshold > 0 && (m_peer_compress_algs & MSGBUS_COMPRESS_ALGS);
+}
+
+bool MsgBusWireCodec::EncodeSharedFrame(const char* frame, uint32_t frame_len, uint32_t compress_min_bytes, std::string& out)
+{
+    MsgBusWireCodec codec;
+    codec.m_peer_version = MSGBUS_PROTOCOL_V2;
+    codec.m_peer_compress_algs = compress_min_bytes > 0 ? MSGBUS_COMPRESS_ALGS : 0;
+    codec.m_compress_threshold = compress_min_bytes;
+    // no msgid id is assigned, so no dictionary is used or updated either.
+    codec.m_intern_names = false;
+    return codec.EncodeFrame(frame, frame_len, out);
+}
+
+bool MsgBusWireCodec::EncodeFrame(const char* frame, uint32_t frame_len, std::string& out)
+{
+    if(!IsCompactEnabled())
+        return false;
+    MsgBusPackHead head;
+    uint32_t head_len = head.Size();
+    if(frame_len < head_len || head.UnPackHead(frame) < 0)
+        return false;
+    if((head.version & 0xff) != MSGBUS_PROTOCOL_V1 || head_len + head.body_len != frame_len)
+        return false;
+    // the body type is encoded to one byte: 3 bits group and 5 bits index.
+    uint32_t group = (uint32_t)head.body_type >> 16;
+    uint32_t index = (uint32_t)head.body_type & 0xffff;
+    if(group >= 8 || index >= 32)
+        return false;
+    const char* body = frame + head_len;
+    uint8_t type_flags = head.msg_type;
+    std::string compact_body;
+    std::string compressed_body;
+    core::common::locker_guard guard(m_encode_locker);
+    if(head.msg_type == 0 && head.body_type == REQ_SENDMSG)
+    {
+        uint32_t msgid_id = 0;
+        if(!EncodeSendMsgBody(body, head.body_len, compact_body, msgid_id))
+            return false;
+        body = compact_body.data();
+        head.body_len = compact_body.size();
+        if(CompressBody(body, head.body_len, msgid_id, compressed_body))
+            type_flags |= MSGBUS_FLAG_COMPRESSED;
+        // the dictionaries are kept only if the compression is used.
+        if(m_compress_threshold > 0 && msgid_id > 0 && msgid_id <= MAX_DICT_MSGIDS &&
+            (m_peer_compress_algs & MSGBUS_COMPRESS_ALGS))
+        {
+            UpdateDict(m_send_dicts, msgid_id, body, head.body_len);
+            type_flags |= MSGBUS_FLAG_DICT_UPDATE;
+        }
+    }
+    else if(CompressBody(body, head.body_len, 0, compressed_body))
+    {
+        type_flags |= MSGBUS_FLAG_COMPRESSED;
+    }
+    if(type_flags & MSGBUS_FLAG_COMPRESSED)
+    {
+        body = compressed_body.data();
+        head.body_len = compressed_body.size();
+    }
+    out.clear();
+    out.reserve(5 + 10 + head.body_len);
+    out.push_back((char)head.magic);
+    uint16_t version = htons((MSGBUS_COMPRESS_ALGS << 12) | (MSGBUS_PROTOCOL_MAX << 8) | MSGBUS_PROTOCOL_V2);
+    out.append((const char*)&version, sizeof(version));
+    out.push_back((char)type_flags);
+    out.push_back((char)((group << 5) | index));
+    PutVarint(out, head.msg_id);
+    PutVarint(out, head.body_len);
+    out.append(body, head.body_len);
+    return true;
+}
+
+int MsgBusWireCodec::DecodeFrame(const char* data, size_t size, MsgBusPackHead& head, const char*& body)
+{
+    // magic + version
+    if(size < 3)
+        return 0;
+    if((uint8_t)data[0] != MSGBUS_HEAD_MAGIC)
+        return -1;
+    uint16_t version;
+    memcpy(&version, data + 1, sizeof(version));
+    version = ntohs(version);
+    if((version & 0xff) != MSGBUS_PROTOCOL_V2)
+    {
+        uint32_t head_len = head.Size();
+        if(size < head_len)
+            return 0;
+        if(head.UnPackHead(data) < 0)
+            return -1;
+        if(size - head_len < head.body_len)
+            return 0;
+        OnPeerVersion(head.version);
+        body = data + head_len;
+        return head_len + head.body_len;
+    }
+    const char* p = data + 3;
+    const char* end = data + size;
+    if(end - p < 2)
+        return 0;
+    head.magic = MSGBUS_HEAD_MAGIC;
+    head.version = version;
+    uint8_t type_flags = (uint8_t)*p++;
+    head.msg_type = type_flags & ~(MSGBUS_FLAG_COMPRESSED | MSGBUS_FLAG_DICT_UPDATE);
+    uint8_t code = (uint8_t)*p++;
+    head.body_type = (kMsgBusBodyType)(((code >> 5) << 16) | (code & 0x1f));
+    int ret = GetVarint(p, end, head.msg_id);
+    if(ret <= 0)
+        return ret;
+    ret = GetVarint(p, end, head.body_len);
+    if(ret <= 0)
+        return ret;
+    if((size_t)(end - p) < head.body_len)
+        return 0;
+    int frame_len = (p - data) + head.body_len;
+    body = p;
+    if(type_flags & MSGBUS_FLAG_COMPRESSED)
+    {
+        if(!DecompressBody(p, head.body_len))
+            return -1;
+        body = m_inflated_body.data();
+        head.body_len = m_inflated_body.size();
+    }
+    if(head.msg_type == 0 && head.body_type == REQ_SENDMSG)
+    {
+        uint32_t msgid_id = 0;
+        if(!DecodeSendMsgBody(body, head.body_len, msgid_id))
+            return -1;
+        if(type_flags & MSGBUS_FLAG_DICT_UPDATE)
+            UpdateDict(m_recv_dicts, msgid_id, body, head.body_len);
+        body = m_decoded_body.data();
+        head.body_len = m_decoded_body.size();
+    }
+    OnPeerVersion(version);
+    return frame_len;
+}
+
+// v2 REQ_SENDMSG body: dest name + from name + content type(1) + content.
+// raw content: varint msg_len + msg content.
+// netmsg content: sender name + msgid name + varint param len + param.
+// name: varint (id << 1 | 1) + varint len + name to send a name (and bind it to a new id if
+// the id is not 0), or varint (id << 1) to use the id bound before.
+bool MsgBusWireCodec::EncodeSendMsgBody(const char* body, uint32_t body_len, std::string& out, uint32_t& msgid_id)
+{
+    if(body_len < 2*MAX_SERVICE_NAME + sizeof(uint32_t))
+        return false;
+    uint32_t msg_len;
+    memcpy(&msg_len, body + 2*MAX_SERVICE_NAME, sizeof(msg_len));
+    msg_len = ntohl(msg_len);
+    if(body_len - 2*MAX_SERVICE_NAME - sizeof(uint32_t) != msg_len)
+        return false;
+    const char* content = body + 2*MAX_SERVICE_NAME + sizeof(uint32_t);
+    out.reserve(msg_len + 16);
+    EncodeName(body, strnlen(body, MAX_SERVICE_NAME), out);
+    EncodeName(body + MAX_SERVICE_NAME, strnlen(body + MAX_SERVICE_NAME, MAX_SERVICE_NAME), out);
+    uint32_t sender_len, msgid_len, param_len;
+    if(ParseNetMsgContent(content, msg_len, sender_len, msgid_len, param_len))
+    {
+        out.push_back((char)SENDMSG_CONTENT_NETMSG);
+        EncodeName(content + 1, sender_len, out);
+        msgid_id = EncodeName(content + 1 + sender_len + 1, msgid_len, out);
+        PutVarint(out, param_len);
+        out.append(content + msg_len - param_len, param_len);
+    }
+    else
+    {
+        out.push_back((char)SENDMSG_CONTENT_RAW);
+        PutVarint(out, msg_len);
+        out.append(content, msg_len);
+    }
+    return true;
+}
+
+bool MsgBusWireCodec::DecodeSendMsgBody(const char* body, uint32_t body_len, uint32_t& msgid_id)
+{
+    const char* p = body;
+    const char* end = body + body_len;
+    std::string dest_name;
+    std::string from_name;
+    uint32_t name_id;
+    if(!DecodeName(p, end, dest_name, name_id) || !DecodeName(p, end, from_name, name_id) || p >= end)
+        return false;
+    if(dest_name.size() > MAX_SERVICE_NAME || from_name.size() > MAX_SERVICE_NAME)
+        return false;
+    uint8_t content_type = (uint8_t)*p++;
+    m_decoded_body.assign(2*MAX_SERVICE_NAME + sizeof(uint32_t), '\0');
+    memcpy(&m_decoded_body[0], dest_name.data(), dest_name.size());
+    memcpy(&m_decoded_body[MAX_SERVICE_NAME], from_name.data(), from_name.size());
+    uint32_t msg_len = 0;
+    if(content_type == SENDMSG_CONTENT_RAW)
+    {
+        if(GetVarint(p, end, msg_len) <= 0 || (size_t)(end - p) != msg_len)
+            return false;
+        m_decoded_body.append(p, msg_len);
+    }
+    else if(content_type == SENDMSG_CONTENT_NETMSG)
+    {
+        std::string sender;
+        std::string msgid;
+        uint32_t param_len;
+        if(!DecodeName(p, end, sender, name_id) || !DecodeName(p, end, msgid, msgid_id))
+            return false;
+        if(sender.size() > 0xff || msgid.size() > 0xff)
+            return false;
+        if(GetVarint(p, end, param_len) <= 0 || (size_t)(end - p) != param_len)
+            return false;
+        msg_len = 1 + sender.size() + 1 + msgid.size() + sizeof(uint32_t) + param_len;
+        m_decoded_body.reserve(m_decoded_body.size() + msg_len);
+        m_decoded_body.push_back((char)sender.size());
+        m_decoded_body.append(sender);
+        m_decoded_body.push_back((char)msgid.size());
+        m_decoded_body.append(msgid);
+        uint32_t netparam_len = htonl(param_len);
+        m_decoded_body.append((const char*)&netparam_len, sizeof(netparam_len));
+        m_decoded_body.append(p, param_len);
+    }
+    else
+    {
+        return false;
+    }
+    uint32_t netmsg_len = htonl(msg_len);
+    memcpy(&m_decoded_body[2*MAX_SERVICE_NAME], &netmsg_len, sizeof(netmsg_len));
+    return true;
+}
+
+// return the id of the name, 0 if the name is not interned.
+uint32_t MsgBusWireCodec::EncodeName(const char* name, size_t name_len, std::string& out)
+{
+    std::string name_str(name, name_len);
+    std::map<std::string, uint32_t>::const_iterator cit = m_sent_names.find(name_str);
+    if(cit != m_sent_names.end())
+    {
+        PutVarint(out, cit->second << 1);
+        return cit->second;
+    }
+    uint32_t id = 0;
+    if(m_intern_names && m_sent_names.size() < MAX_INTERNED_NAMES)
+    {
+        id = m_sent_names.size() + 1;
+        m_sent_names[name_str] = id;
+    }
+    PutVarint(out, (id << 1) | 1);
+    PutVarint(out, name_len);
+    out.append(name, name_len);
+    return id;
+}
+
+bool MsgBusWireCodec::DecodeName(const char*& p, const char* end, std::string& name, uint32_t& id)
+{
+    uint32_t v;
+    if(GetVarint(p, end, v) <= 0)
+        return false;
+    id = v >> 1;
+    if((v & 1) == 0)
+    {
+        if(id == 0 || id > m_recv_names.size())
+            return false;
+        name = m_recv_names[id - 1];
+        return true;
+    }
+    uint32_t name_len;
+    if(GetVarint(p, end, name_len) <= 0 || (size_t)(end - p) < name_len)
+        return false;
+    name.assign(p, name_len);
+    p += name_len;
+    if(id != 0)
+    {
+        // the ids are assigned in order by the peer.
+        if(id != m_recv_names.size() + 1)
+            return false;
+        m_recv_names.push_back(name);
+    }
+    return true;
+}
+
+
+bool MsgBusWireCodec::CompressBody(const char* body, uint32_t body_len, uint32_t msgid_id, std::string& out)
+{
+    if(m_compress_threshold == 0 || body_len < m_compress_threshold || body_len > MAX_INFLATED_BODY_LEN)
+        return false;
+    // zlib is the only algorithm now, lz4 and zstd can be chosen here when both sides support.
+    if((m_peer_compress_algs & (1 << (COMPRESS_ZLIB - 1))) == 0)
+        return false;
+    if(m_deflate_stream == NULL)
+    {
+        m_deflate_stream = new z_stream;
+        memset(m_deflate_stream, 0, sizeof(z_stream));
+        // raw deflate without the zlib head and checksum, the frame has its own length.
+        if(deflateInit2(m_deflate_stream, Z_BEST_SPEED, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+        {
+            delete m_deflate_stream;
+            m_deflate_stream = NULL;
+            return false;
+        }
+    }
+    else
+    {
+        deflateReset(m_deflate_stream);
+    }
+    uint32_t dict_id = 0;
+    std::map<uint32_t, std::string>::const_iterator cit = m_send_dicts.find(msgid_id);
+    if(msgid_id > 0 && cit != m_send_dicts.end())
+    {
+        dict_id = msgid_id;
+        deflateSetDictionary(m_deflate_stream, (const Bytef*)cit->second.data(), cit->second.size());
+    }
+    out.clear();
+    out.push_back((char)COMPRESS_ZLIB);
+    PutVarint(out, body_len);
+    PutVarint(out, dict_id);
+    size_t prefix_len = out.size();
+    out.resize(prefix_len + deflateBound(m_deflate_stream, body_len));
+    m_deflate_stream->next_in = (Bytef*)body;
+    m_deflate_stream->avail_in = body_len;
+    m_deflate_stream->next_out = (Bytef*)&out[prefix_len];
+    m_deflate_stream->avail_out = out.size() - prefix_len;
+    if(deflate(m_deflate_stream, Z_FINISH) != Z_STREAM_END)
+        return false;
+    out.resize(prefix_len + m_deflate_stream->total_out);
+    // not worth to compress.
+    return out.size() < body_len;
+}
+
+bool MsgBusWireCodec::DecompressBody(const char* body, uint32_t body_len)
+{
+    const char* p = body;
+    const char* end = body + body_len;
+    if(p >= end || (uint8_t)*p++ != COMPRESS_ZLIB)
+        return false;
+    uint32_t raw_len;
+    uint32_t dict_id;
+    if(GetVarint(p, end, raw_len) <= 0 || GetVarint(p, end, dict_id) <= 0)
+        return false;
+    if(raw_len == 0 || raw_len > MAX_INFLATED_BODY_LEN || raw_len / MAX_DEFLATE_RATIO > (uint32_t)(end - p))
+        return false;
+    if(m_inflate_stream == NULL)
+    {
+        m_inflate_stream = new z_stream;
+        memset(m_inflate_stream, 0, sizeof(z_stream));
+        if(inflateInit2(m_inflate_stream, -15) != Z_OK)
+        {
+            delete m_inflate_stream;
+            m_inflate_stream = NULL;
+            return false;
+        }
+    }
+    else
+    {
+        inflateReset(m_inflate_stream);
+    }
+    if(dict_id > 0)
+    {
+        std::map<uint32_t, std::string>::const_iterator cit = m_recv_dicts.find(dict_id);
+        if(cit == m_recv_dicts.end())
+            return false;
+        inflateSetDictionary(m_inflate_stream, (const Bytef*)cit->second.data(), cit->second.size());
+    }
+    m_inflated_body.resize(std::min<uint32_t>(raw_len, INFLATE_CHUNK_LEN));
+    m_inflate_stream->next_in = (Bytef*)p;
+    m_inflate_stream->avail_in = end - p;
+    m_inflate_stream->next_out = (Bytef*)&m_inflated_body[0];
+    m_inflate_stream->avail_out = m_inflated_body.size();
+    while(true)
+    {
+        int ret = inflate(m_inflate_stream, Z_NO_FLUSH);
+        if(ret == Z_STREAM_END)
+            break;
+        if(ret != Z_OK || m_inflate_stream->avail_out != 0)
+            return false;
+        // the output is full, grow it only if the raw length claimed is not reached.
+        size_t inflated = m_inflated_body.size();
+        if(inflated >= raw_len)
+            return false;
+        m_inflated_body.resize(std::min<size_t>(raw_len, inflated*2));
+        m_inflate_stream->next_out = (Bytef*)&m_inflated_body[inflated];
+        m_inflate_stream->avail_out = m_inflated_body.size() - inflated;
+    }
+    return m_inflate_stream->total_out == raw_len;
+}
+
+void MsgBusWireCodec::UpdateDict(std::map<uint32_t, std::string>& dicts, uint32_t msgid_id,
+    const char* body, uint32_t body_len)
+{
+    if(msgid_id == 0 || msgid_id > MAX_DICT_MSGIDS)
+        return;
+    if(body_len > MAX_DICT_BYTES)
+    {
+        body += body_len - MAX_DICT_BYTES;
+        body_len = MAX_DICT_BYTES;
+    }
+    dicts[msgid_id].assign(body, body_len);
+}
+
+
 }
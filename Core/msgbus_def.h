@@ -7,8 +7,26 @@
 #include <stdint.h>
 #include <sys/types.h>
 #include <string>
+#include <map>
+#include <vector>
+#include "lock.hpp"
 #define MAX_SERVICE_NAME 64
 
+// 协议版本号: 包头中version的低字节表示本包使用的格式, 高字节的低4位表示发送方支持的最高版本,
+// 高4位是发送方支持的压缩算法的位掩码(第n位表示算法n+1).
+// 收到对方支持v2的包之后才会向对方发送v2格式的紧凑包, 因此旧的v1客户端和服务器不受影响.
+#define MSGBUS_PROTOCOL_V1  0x01
+#define MSGBUS_PROTOCOL_V2  0x02
+#define MSGBUS_PROTOCOL_MAX MSGBUS_PROTOCOL_V2
+#define MSGBUS_COMPRESS_ALGS (1 << (COMPRESS_ZLIB - 1))
+#define MSGBUS_HEAD_VERSION ((MSGBUS_COMPRESS_ALGS << 12) | (MSGBUS_PROTOCOL_MAX << 8) | MSGBUS_PROTOCOL_V1)
+// v2包中msg_type的标志位, 包体是压缩过的.
+#define MSGBUS_FLAG_COMPRESSED  0x80
+// v2包中msg_type的标志位, 接收方要保存此包体作为该msgid的压缩字典.
+#define MSGBUS_FLAG_DICT_UPDATE 0x40
+
+struct z_stream_s;
+
 namespace NetMsgBus
 {
 
@@ -38,6 +56,20 @@ enum kMsgBusBodyType {
     BODY_JSONTYPE                        = 0x030002,    // body is the json string.
 };
 
+// 压缩算法, 目前只实现了zlib, 其他的算法保留
+enum kMsgBusCompressAlg {
+    COMPRESS_NONE                        = 0,
+    COMPRESS_ZLIB                        = 1,
+    COMPRESS_LZ4                         = 2,
+    COMPRESS_ZSTD                        = 3
+};
+
+// 服务器主动断开客户端连接的原因, 通过PBDisconnectNotify告知客户端
+enum kDisconnectReason {
+    DISCONNECT_SLOW_CONSUMER             = 1,   // 等待发送给该客户端的数据达到了上限
+    DISCONNECT_SERVER_MEMORY             = 2,   // 等待发送给所有客户端的数据达到了服务器的上限
+};
+
 typedef struct S_ClientHostInfo {
     S_ClientHostInfo(const std::string& ip_str, unsigned short int port);
     S_ClientHostInfo();
@@ -58,7 +90,7 @@ class MsgBusPackHead
 public:
     MsgBusPackHead()
         :magic(0x66),
-        version(0x0001),
+        version(MSGBUS_HEAD_VERSION),
         msg_type(0),
         msg_id(0),
         body_len(0)
@@ -66,7 +98,7 @@ public:
     }
     MsgBusPackHead(uint8_t type, kMsgBusBodyType msgbody_type)
         :magic(0x66),
-        version(0x0001),
+        version(MSGBUS_HEAD_VERSION),
         msg_type(type),
         msg_id(0),
         body_type(msgbody_type),
@@ -381,6 +413,75 @@ private:
 
 #pragma pack(pop)
 
+// the protocol state of one connection between the client and the msgbus server.
+// v2 compact frame:
+//   magic(1) + version(2) + msg_type(1) + body code(1) + varint msg_id + varint body_len + body
+// the body of REQ_SENDMSG in v2 frame uses the interned ids instead of the fixed 64 bytes names,
+// the first time a name (service name or msgid) is sent, it is sent with its new id, after that
+// only the id is sent. the ids are only valid in one direction of the connection.
+// all frames are restored to the v1 layout after decoding, so the handlers need not to know the
+// frame version.
+// the body of v2 frame can be compressed by the algorithm both sides support, the compressed
+// body: algorithm(1) + varint raw body len + varint dictionary id + compressed data.
+// the dictionary of a msgid is the last REQ_SENDMSG body of the msgid with the DICT_UPDATE flag,
+// so the small repetitive messages of the same msgid can also be compressed well.
+class MsgBusWireCodec
+{
+public:
+    MsgBusWireCodec();
+    ~MsgBusWireCodec();
+    // compress the body not less than min_bytes if the peer supports, 0 to disable.
+    void SetCompressThreshold(uint32_t min_bytes);
+    // learn the highest version the peer supports from the version in a received head.
+    void OnPeerVersion(uint16_t version);
+    bool IsCompactEnabled() const;
+    // whether the bodies sent to the peer may be compressed.
+    bool IsCompressEnabled() const;
+    // encode a packed v1 frame to the v2 frame if the peer supports it, return false if the
+    // frame should be sent as it is. the interned ids and the dictionaries are updated while
+    // encoding REQ_SENDMSG, so the caller must send them in the same order as encoding.
+    // the compression runs in the caller's thread.
+    bool EncodeFrame(const char* frame, uint32_t frame_len, std::string& out);
+    // decode one frame from the received data, must be called in the order of receiving.
+    // return the bytes of the frame, 0 if the frame is not complete, -1 if the data is broken.
+    // the body is in the v1 layout and is valid until next decoding.
+    int DecodeFrame(const char* data, size_t size, MsgBusPackHead& head, const char*& body);
+    // encode a packed v1 frame to the v2 frame which does not depend on any connection state:
+    // the names are sent inline and no dictionary is used. so the same encoded frame can be
+    // shared by all the v2 peers, the compressed one only by the peers supporting compression.
+    static bool EncodeSharedFrame(const char* frame, uint32_t frame_len, uint32_t compress_min_bytes, std::string& out);
+
+private:
+    MsgBusWireCodec(const MsgBusWireCodec&);
+    MsgBusWireCodec& operator=(const MsgBusWireCodec&);
+    bool EncodeSendMsgBody(const char* body, uint32_t body_len, std::string& out, uint32_t& msgid_id);
+    bool DecodeSendMsgBody(const char* body, uint32_t body_len, uint32_t& msgid_id);
+    uint32_t EncodeName(const char* name, size_t name_len, std::string& out);
+    bool DecodeName(const char*& p, const char* end, std::string& name, uint32_t& id);
+    bool CompressBody(const char* body, uint32_t body_len, uint32_t msgid_id, std::string& out);
+    bool DecompressBody(const char* body, uint32_t body_len);
+    void UpdateDict(std::map<uint32_t, std::string>& dicts, uint32_t msgid_id, const char* body, uint32_t body_len);
+
+    volatile int m_peer_version;
+    volatile int m_peer_compress_algs;
+    volatile uint32_t m_compress_threshold;
+    // false to send all the names inline without assigning ids.
+    bool m_intern_names;
+    // the responses and the relay messages may be encoded in different threads.
+    core::common::locker m_encode_locker;
+    struct z_stream_s* m_deflate_stream;
+    struct z_stream_s* m_inflate_stream;
+    // the dictionaries of the msgid ids, for sending and receiving.
+    std::map<uint32_t, std::string> m_send_dicts;
+    std::map<uint32_t, std::string> m_recv_dicts;
+    std::string m_inflated_body;
+    // the ids of the names which have been sent to the peer.
+    std::map<std::string, uint32_t> m_sent_names;
+    // the names received from the peer, index is the id - 1.
+    std::vector<std::string> m_recv_names;
+    std::string m_decoded_body;
+};
+
 struct ClientHostIsEqual
 {
     bool operator()(const ClientHost& left,const ClientHost& right)
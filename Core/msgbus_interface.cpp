@@ -100,11 +100,21 @@ static volatile bool s_msgbus_terminate = false;
 // 消息总线处理线程ID
 static pthread_t msgbus_tid;
 
+// 已经从队列中取出但还没处理完的消息数
+static volatile long s_running_msgtask_num = 0;
+// 处理一个消息的平均耗时(us), 每处理一个消息更新一次
+static volatile int64_t s_msg_handle_avg_us = 0;
+
 // 用于保护消息队列的锁和用于通知消息队列的事件
 static core::common::locker s_msgtask_locker;
 static core::common::condition s_msgtask_condition;
 // 用于保护消息处理对象集合的锁
 static core::common::locker s_msghandlers_locker;
+// the registered msgids are advertised again whenever a new msgid is registered after the
+// first advertising, the advertisements are sent in order with the locker held.
+static volatile bool s_advertise_registered = false;
+static core::common::locker s_advertise_locker;
+static bool advertise_registered_messages();
 //
 struct ReadySendMsgInfo
 {
@@ -198,6 +208,7 @@ static void ExecuteMsgBusHandlers(const std::string& msgid, MsgTaskVec& alltasks
         //assert(param.paramlen);
         // make a copy of param to prevent interfering with other msg handlers.
         MsgBusParam original_param = param.DeepCopy();
+        int64_t handle_start = core::utility::GetTickCountUs();
 
         // 注：改造后的list是个强引用的list,list中的对象一定还有效
         while(hit != msg_handlers.end())
@@ -225,6 +236,9 @@ static void ExecuteMsgBusHandlers(const std::string& msgid, MsgTaskVec& alltasks
             ++hit;
         }
         alltasks[i].ret = result;
+        // the moving average of the recent messages, the races between the threads only lose some samples.
+        int64_t handle_us = core::utility::GetTickCountUs() - handle_start;
+        s_msg_handle_avg_us += (handle_us - s_msg_handle_avg_us)/8;
         //g_log.Log(core::lv_debug, "process a sendmsg in msgbus onmsg :%lld, cnt:%d \n", (int64_t)core::utility::GetTickCount(), cnt);
     }
 }
@@ -427,39 +441,47 @@ bool RegisterMsg(const std::string& msgid, MsgHandlerStrongRef sp_handler_obj, b
         return false;
     if( sp_handler_obj == NULL )
         return false;
-    core::common::locker_guard guard(s_msghandlers_locker);
-    MsgHandlerObjContainerT::iterator it = s_all_msghandler_objs.find(msgid);
-    bool isexist = false;
-    if(it != s_all_msghandler_objs.end())
+    bool isnewmsgid = false;
     {
-        MsgHandlerWeakObjList::iterator hit = it->second.begin();
-        while(hit != it->second.end())
+        core::common::locker_guard guard(s_msghandlers_locker);
+        MsgHandlerObjContainerT::iterator it = s_all_msghandler_objs.find(msgid);
+        bool isexist = false;
+        if(it != s_all_msghandler_objs.end())
         {
-            MsgHandlerStrongRef sh = hit->first.lock();
-            if(sh && (sh.get() == sp_handler_obj.get()) )
+            MsgHandlerWeakObjList::iterator hit = it->second.begin();
+            while(hit != it->second.end())
             {
-                //已经注册过
-                isexist = true;
-                break;
+                MsgHandlerStrongRef sh = hit->first.lock();
+                if(sh && (sh.get() == sp_handler_obj.get()) )
+                {
+                    //已经注册过
+                    isexist = true;
+                    break;
+                }
+                ++hit;
             }
-            ++hit;
-        }
 
-    }
-    // 该对象没有注册过该消息，则加到该消息的处理对象列表中去
-    if(!isexist)
-    {
-        if(it == s_all_msghandler_objs.end())
-        {
-            MsgHandlerWeakObjList hlist;
-            hlist.push_back(std::make_pair(sp_handler_obj, must_called_in_msgbusthread));
-            s_all_msghandler_objs[msgid] = hlist;
         }
-        else
+        // 该对象没有注册过该消息，则加到该消息的处理对象列表中去
+        if(!isexist)
         {
-            it->second.push_back(std::make_pair(sp_handler_obj, must_called_in_msgbusthread));
+            if(it == s_all_msghandler_objs.end())
+            {
+                MsgHandlerWeakObjList hlist;
+                hlist.push_back(std::make_pair(sp_handler_obj, must_called_in_msgbusthread));
+                s_all_msghandler_objs[msgid] = hlist;
+                isnewmsgid = true;
+            }
+            else
+            {
+                isnewmsgid = it->second.empty();
+                it->second.push_back(std::make_pair(sp_handler_obj, must_called_in_msgbusthread));
+            }
         }
     }
+    // the broadcasts of the new msgid will be filtered out by the server if not advertised.
+    if(isnewmsgid && s_advertise_registered)
+        advertise_registered_messages();
     return true;
 }
 // 反注册消息
@@ -536,6 +558,10 @@ void* MsgTaskProcessProc(void*)
                     }
                 }
             }
+            long running_num = 0;
+            for(size_t j = 0; j < running_task_list.size(); ++j)
+                running_num += running_task_list[j].second.size();
+            s_running_msgtask_num = running_num;
         }
         if(s_msgbus_terminate)
             break;
@@ -547,6 +573,7 @@ void* MsgTaskProcessProc(void*)
             // 在消息处理线程中以同步的方式处理消息
             SendMsgInMsgBusThread(curmsgid, mtasks);
             size_t task_num = mtasks.size();
+            __sync_fetch_and_sub(&s_running_msgtask_num, (long)task_num);
             for(size_t i = 0; i < task_num; ++i)
             {
                 MsgTask& firsttask = mtasks[i];
@@ -598,6 +625,11 @@ int  NetMsgBusRegReceiver(const std::string& name, const std::string& hostip, un
     return 0;
 }
 
+bool NetMsgBusRegServices(const std::vector<std::string>& names)
+{
+    return msgbus_register_services(names);
+}
+
 void NetMsgBusDisConnectFromServer()
 {
     disconnect_from_server();
@@ -655,6 +687,11 @@ bool NetMsgBusQueryHostInfo(const std::string& clientname, std::string& ip, unsi
     return msgbus_req_receiver_info(clientname, ip, port);
 }
 
+bool NetMsgBusQueryHostsInfo(const std::vector<std::string>& clientnames)
+{
+    return msgbus_req_receivers_info(clientnames);
+}
+
 boost::shared_ptr<NetFuture> NetMsgBusAsyncGetData(const std::string& clientname, const std::string& msgid,
     MsgBusParam param, NetFuture::futureCB callback)
 {
@@ -690,11 +727,95 @@ bool NetMsgBusGetData(const std::string& dest_ip, unsigned short dest_port, cons
     return msgbus_sendmsg_direct_to_client(dest_ip, dest_port, netmsg_len, netmsg_param.paramdata, rsp_data, timeout_sec);
 }
 
+bool NetMsgBusIsSendBlocked(const std::string& dest_name, kMsgSendType sendtype)
+{
+    if(dest_name == "" || sendtype == SendUseServerRelay)
+        return msgbus_is_server_send_blocked();
+    return msgbus_is_receiver_send_blocked(dest_name);
+}
+
+bool NetMsgBusSetSendBatch(int window_us, size_t max_batch_bytes)
+{
+    return msgbus_set_postmsg_batch(window_us, max_batch_bytes);
+}
+
+void NetMsgBusFlush()
+{
+    msgbus_flush_postmsg();
+}
+
+void NetMsgBusSetCompress(size_t min_compress_bytes)
+{
+    msgbus_set_compress(min_compress_bytes);
+}
+
 int  NetMsgBusQueryServices(const std::string& match_str, std::string& rsp)
 {
     return msgbus_query_available_services(match_str, rsp);
 }
 
+void MsgBusGetLoad(size_t& queued_msgs, int64_t& avg_handle_us)
+{
+    {
+        core::common::locker_guard guard(s_msgtask_locker);
+        queued_msgs = s_all_msgtask.size() + s_all_sendmsgtask.size();
+    }
+    long running_num = s_running_msgtask_num;
+    if(running_num > 0)
+        queued_msgs += running_num;
+    avg_handle_us = s_msg_handle_avg_us;
+}
+
+bool NetMsgBusSetAutoBusyState(int interval_sec)
+{
+    return msgbus_set_busystate_report(interval_sec);
+}
+
+bool NetMsgBusSubscribeServices(const std::string& match_prefix)
+{
+    return msgbus_subscribe_services(match_prefix);
+}
+
+void NetMsgBusUnSubscribeServices(const std::string& match_prefix)
+{
+    msgbus_subscribe_services(match_prefix, true);
+}
+
+bool NetMsgBusAdvertiseMessages(const std::vector<std::string>& msgids, const std::vector<std::string>& msgid_prefixes)
+{
+    // the explicit advertisement is not replaced by the registered msgids.
+    s_advertise_registered = false;
+    return msgbus_advertise_messages(msgids, msgid_prefixes);
+}
+
+static bool advertise_registered_messages()
+{
+    core::common::locker_guard guard(s_advertise_locker);
+    std::vector<std::string> msgids;
+    {
+        core::common::locker_guard guard(s_msghandlers_locker);
+        MsgHandlerObjContainerT::const_iterator cit = s_all_msghandler_objs.begin();
+        while(cit != s_all_msghandler_objs.end())
+        {
+            if(!cit->second.empty())
+                msgids.push_back(cit->first);
+            ++cit;
+        }
+    }
+    return msgbus_advertise_messages(msgids, std::vector<std::string>());
+}
+
+bool NetMsgBusAdvertiseRegisteredMessages()
+{
+    s_advertise_registered = true;
+    return advertise_registered_messages();
+}
+
+bool NetMsgBusQueryMessages(const std::string& service_name, const std::string& match_prefix, std::string& rsp)
+{
+    return msgbus_query_service_messages(service_name, match_prefix, rsp);
+}
+
 void printAllMsgHandler(const std::string& msgid)
 {
     MsgHandlerStrongObjList msg_handlers;
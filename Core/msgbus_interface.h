@@ -126,8 +126,11 @@ namespace NetMsgBus
     void NetMsgBusDisConnectAll();
     // register a receiver on the netmsgbus so that the client can receive messages from other client.
     int  NetMsgBusRegReceiver(const std::string& name, const std::string& hostip, unsigned short& hostport);
+    // register the receiver as more services in one request, so the messages to any of them are
+    // received. must be called after NetMsgBusRegReceiver.
+    bool NetMsgBusRegServices(const std::vector<std::string>& names);
     // send messages to a client connected with netmsgbus server. Use empty dest_name to broadcast messages on the netmsgbus.
-    // 
+    // return false with errno EWOULDBLOCK if the data waiting to send has reached the high water.
     bool NetMsgBusSendMsg(const std::string& dest_name, const std::string& msgid, MsgBusParam param, kMsgSendType sendtype);
     bool NetMsgBusSendMsg(const std::string& dest_ip, unsigned short dest_port, const std::string& msgid,
         MsgBusParam param);
@@ -135,6 +138,9 @@ namespace NetMsgBus
     //void NetMsgBusDisConnectFromClient(const std::string& name);
     // get the ip and port info and cache them in client. just work like dns name resolve.
     bool NetMsgBusQueryHostInfo(const std::string& clientname, std::string& ip, unsigned short int& port);
+    // resolve many clients in one request and cache the least busy receivers of them, the clients
+    // not found are removed from the cache.
+    bool NetMsgBusQueryHostsInfo(const std::vector<std::string>& clientnames);
     // send messages to a client and wait response data from it.
     bool NetMsgBusGetData(const std::string& clientname, const std::string& msgid, MsgBusParam param, 
         std::string& rsp_data, int32_t timeout_sec = 30);
@@ -145,8 +151,40 @@ namespace NetMsgBus
         MsgBusParam param, NetFuture::futureCB callback = NULL);
     boost::shared_ptr<NetFuture> NetMsgBusAsyncGetData(const std::string& dest_ip,
         unsigned short dest_port, const std::string& msgid, MsgBusParam param, NetFuture::futureCB callback = NULL);
+    // whether the sending to the dest has reached the high water, the producer should slow down until it is false.
+    bool NetMsgBusIsSendBlocked(const std::string& dest_name, kMsgSendType sendtype);
+    // batch the messages sent directly to clients, the messages within window_us or until max_batch_bytes
+    // will be written together. use 0 window_us to disable. must be called after connected to the server.
+    bool NetMsgBusSetSendBatch(int window_us, size_t max_batch_bytes = 0);
+    // send out all the batched messages immediately, for the latency-critical messages.
+    void NetMsgBusFlush();
+    // compress the messages sent by server relay not less than min_compress_bytes, 0 to disable.
+    // it only takes effect if the server supports, the small messages of the same msgid are
+    // compressed with the last one as the dictionary.
+    void NetMsgBusSetCompress(size_t min_compress_bytes);
     // query all available services that are registered on the net message bus server
     int  NetMsgBusQueryServices(const std::string& match_str, std::string& rsp);
+    // report the busy state of the registered receiver to the server by the local load, so the
+    // server will choose the less busy receivers. the load is checked every interval_sec and the
+    // state is sent only when it changes. 0 to disable. must be called after registering the receiver.
+    bool NetMsgBusSetAutoBusyState(int interval_sec);
+    // subscribe the services with the prefix, the server pushes the changes of their receivers
+    // to keep the local cache warm, so sending to them needs no query and fails over at once.
+    // return after the current receivers are cached.
+    bool NetMsgBusSubscribeServices(const std::string& match_prefix);
+    void NetMsgBusUnSubscribeServices(const std::string& match_prefix);
+    // advertise the msgids and the msgid prefixes handled by this client, the server only sends
+    // the broadcasts of them to this client. it replaces the ones advertised before, the client
+    // never advertising gets all the broadcasts.
+    bool NetMsgBusAdvertiseMessages(const std::vector<std::string>& msgids,
+        const std::vector<std::string>& msgid_prefixes = std::vector<std::string>());
+    // advertise the msgids having handlers registered, and keep advertising them again whenever
+    // a handler of a new msgid is registered after this.
+    bool NetMsgBusAdvertiseRegisteredMessages();
+    // query the messages advertised by the service, separated by ',' and the prefixes end with '*'.
+    bool NetMsgBusQueryMessages(const std::string& service_name, const std::string& match_prefix, std::string& rsp);
+    // the load of the local msgbus: the messages waiting to be handled and the average handling time.
+    void MsgBusGetLoad(size_t& queued_msgs, int64_t& avg_handle_us);
  
     void printAllMsgHandler(const std::string& msgid);
 }
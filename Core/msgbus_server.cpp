@@ -14,6 +14,8 @@
 
 #include "EventLoopPool.h"
 #include "CommonUtility.hpp"
+#include "RadixTrie.hpp"
+#include "MsgBusLoadBalancer.hpp"
 #include "threadpool.h"
 #include "SimpleLogger.h"
 #include "NetMsgBus.PBParam.pb.h"
@@ -29,6 +31,7 @@
 #include <stdio.h>
 #include <arpa/inet.h>
 #include <map>
+#include <set>
 #include <vector>
 #include <deque>
 #include <string>
@@ -37,6 +40,7 @@
 #include <boost/shared_array.hpp>
 #include <boost/shared_ptr.hpp>
 #include <boost/bind.hpp>
+#include <boost/enable_shared_from_this.hpp>
 #include <fcntl.h>
 #include <iostream>
 #include <limits.h>
@@ -47,6 +51,7 @@
 #endif
 
 #define MSGBUS_SERVER_DEFAULT_PORT 19000
+#define MSGBUS_SERVER_DEFAULT_BACKLOG 1024
 #define TIMEOUT_SHORT 2
 #define KEEP_ALIVE_TIME  90000
 
@@ -71,39 +76,342 @@ static ActiveClientTcpContainer active_clients;
 typedef map<int, ClientHost>  TcpServicesMap;
 static TcpServicesMap  tcp_services_map;  // keep the relationship between the tcp connection and the service it's suppling.
 
+// the messages advertised by a client, only the broadcasts of them are sent to the client.
+struct MessageInterest
+{
+    std::set<string> msgids;
+    std::vector<string> msgid_prefixes;
+    bool Match(const std::string& msgid) const
+    {
+        if(msgids.find(msgid) != msgids.end())
+            return true;
+        for(size_t i = 0; i < msgid_prefixes.size(); ++i)
+        {
+            if(msgid.compare(0, msgid_prefixes[i].size(), msgid_prefixes[i]) == 0)
+                return true;
+        }
+        return false;
+    }
+};
+
+// the protocol codec of each client connection, keep the version and the interned names of the client.
+struct ClientTcpCodec
+{
+    boost::shared_ptr<MsgBusWireCodec> codec;
+    // the frames to one client may be sent by more than one relay shard, the encoding and the
+    // sending are done together so the interned names arrive in the same order as assigned.
+    core::common::locker send_locker;
+    // the relayed messages queued to the client since its send queue was empty last time.
+    volatile long inflight_relays;
+    // replaced as a whole by the advertising and loaded by the relay shards, null if the client
+    // never advertised, it gets all the broadcasts as before.
+    boost::shared_ptr<const MessageInterest> interest;
+    // the client is slow since its queued bytes reached the budget and until they are all written
+    // out, the frames dropped or conflated meanwhile are counted.
+    volatile int slow;
+    volatile long slow_dropped;
+    volatile int disconnecting;
+    // the latest frames of each msgid conflated while slow, protected by conflate_locker.
+    core::common::locker conflate_locker;
+    std::map<std::string, SharedFrame> conflated;
+    ClientTcpCodec()
+        :inflight_relays(0),
+        slow(0),
+        slow_dropped(0),
+        disconnecting(0)
+    {
+    }
+};
+
+// the radix trie indexes of the services for the lookups while relaying. the containers above
+// are only changed with g_activeclients_locker held, and each change publishes a new version of
+// the index, so the readers only load the current version and never take the lock.
+struct ActiveReplica
+{
+    TcpSockSmartPtr tcp;
+    kServerBusyState busy_state;
+    boost::shared_ptr<ClientTcpCodec> conn;
+};
+struct ActiveServiceEntry
+{
+    ActiveServiceEntry()
+        :rr_cursor(0)
+    {
+    }
+    string service_name;
+    std::vector<ActiveReplica> replicas;
+    // the round robin cursor of the load balancer.
+    mutable volatile unsigned long rr_cursor;
+};
+struct AvailableServiceEntry
+{
+    AvailableServiceEntry()
+        :rr_cursor(0)
+    {
+    }
+    string service_name;
+    ClientHostContainer hosts;
+    mutable volatile unsigned long rr_cursor;
+};
+typedef core::common::RadixTrie<ActiveServiceEntry> ActiveServiceIndexT;
+typedef core::common::RadixTrie<AvailableServiceEntry> AvailableServiceIndexT;
+static boost::shared_ptr<const ActiveServiceIndexT> s_active_index(new ActiveServiceIndexT());
+static boost::shared_ptr<const AvailableServiceIndexT> s_available_index(new AvailableServiceIndexT());
+
 core::common::locker g_activeclients_locker;
+typedef map<long, boost::shared_ptr<ClientTcpCodec> > TcpCodecContainerT;
+
+// the requests of one client are processed in order by its own strand. the strand is queued to
+// the threadpool only when it turns busy and then runs the requests queued meanwhile in batch,
+// so the global threadpool queue is not locked for each request.
+class ClientStrand : public boost::enable_shared_from_this<ClientStrand>
+{
+public:
+    ClientStrand()
+        :m_running(false)
+    {
+    }
+    // no request is queued or running, only meaningful in the loop thread of the client.
+    bool IsIdle()
+    {
+        core::common::locker_guard guard(m_locker);
+        return !m_running;
+    }
+    void Post(const threadpool::task_type& task)
+    {
+        {
+            core::common::locker_guard guard(m_locker);
+            m_tasks.push_back(task);
+            if(m_running)
+                return;
+            m_running = true;
+        }
+        threadpool::queue_work_task(boost::bind(&ClientStrand::Run, shared_from_this()), 0);
+    }
+private:
+    void Run()
+    {
+        std::deque<threadpool::task_type> running_tasks;
+        {
+            core::common::locker_guard guard(m_locker);
+            running_tasks.swap(m_tasks);
+        }
+        while(!running_tasks.empty())
+        {
+            running_tasks.front()();
+            running_tasks.pop_front();
+        }
+        {
+            core::common::locker_guard guard(m_locker);
+            if(m_tasks.empty())
+            {
+                m_running = false;
+                return;
+            }
+        }
+        // queue again for the requests came while running, so a busy client can not hold
+        // the worker thread all the time.
+        threadpool::queue_work_task(boost::bind(&ClientStrand::Run, shared_from_this()), 0);
+    }
+
+    core::common::locker m_locker;
+    std::deque<threadpool::task_type> m_tasks;
+    bool m_running;
+};
+static TcpCodecContainerT tcp_codecs;
+core::common::locker g_tcpcodecs_locker;
 static volatile bool s_netmsgbus_server_running = false;
 static volatile bool s_netmsgbus_server_terminate = false;
 static unsigned short s_server_port;
+static int s_server_backlog = MSGBUS_SERVER_DEFAULT_BACKLOG;
+// the body not less than this will be compressed if the client supports, 0 to disable.
+static uint32_t s_compress_min_bytes = 0;
+// select the replica of a service for relaying and GETCLIENT.
+static boost::shared_ptr<LoadBalancer> s_load_balancer;
+
+// the relayed and the broadcast messages are the non-critical frames limited by the outbound budget
+// of each client, the responses and the notifications are always sent. a client becomes slow once
+// its queued bytes reach the budget, or reach SLOW_CONSUMER_MIN_BYTES while the queued bytes of all
+// the clients reach the server cap, and it is slow until all its queued bytes are written out.
+enum kSlowConsumerPolicy {
+    SLOW_DROP = 0,       // drop the non-critical frames to the slow client
+    SLOW_CONFLATE,       // keep only the latest frame of each msgid and send them after drained
+    SLOW_DISCONNECT      // disconnect the slow client with the reason
+};
+#define SLOW_CONSUMER_DEFAULT_BUDGET  (64*1024*1024)
+#define SLOW_CONSUMER_DEFAULT_CAP     (1024*1024*1024)
+#define SLOW_CONSUMER_MIN_BYTES       (64*1024)
+#define SLOW_CONSUMER_CHECK_US        100000
+// the disconnected client is closed after this even if the reason is not written out.
+#define SLOW_CONSUMER_CLOSE_SEC       3
+static size_t s_client_budget_bytes = SLOW_CONSUMER_DEFAULT_BUDGET;
+static size_t s_server_cap_bytes = SLOW_CONSUMER_DEFAULT_CAP;
+static kSlowConsumerPolicy s_slow_policy = SLOW_DROP;
+// the queued bytes of all the clients, sampled every SLOW_CONSUMER_CHECK_US.
+static volatile size_t s_total_queued_bytes = 0;
+
+// the servers can be federated. each server syncs the registry of its own clients to the peer
+// servers by PBSyncServerData, a full sync for each new link and periodically, and a delta of one
+// service whenever it changes. the relayed messages to the services only on the peers are
+// forwarded through the peer links, and the messages from the peers are delivered to the local
+// clients only, so the servers should be full meshed and a message crosses one link at most.
+// a broadcast is forwarded to all the peers, and each service gets it from one server only.
+// the syncs of a peer are accepted only on the link this server connected to it, and the peer
+// gets the syncs of this server on the link it connected, so the routes can not be injected by
+// the other processes on the peer hosts. the link connected sends a hello of the server name to
+// be known as a peer link and to keep alive. the peers should list each other with the ports to
+// share their services both ways, the one listed without the port only gets the services of this
+// server.
+#define FEDERATION_CHECK_SEC     2
+#define FEDERATION_FULLSYNC_SEC  10
+struct PeerAddr
+{
+    std::string ip;
+    unsigned short int port;
+    TcpSockSmartPtr link;
+};
+// the services synced from a peer server.
+struct PeerServer
+{
+    TcpSockSmartPtr link;
+    std::map<string, ClientHostContainer> services;
+};
+typedef std::map<string, PeerServer> PeerServerContainerT;
+struct RemoteRoute
+{
+    string server_name;
+    TcpSockSmartPtr link;
+    // the least busy state of the clients of the service on the peer.
+    kServerBusyState busy_state;
+};
+struct RemoteServiceEntry
+{
+    RemoteServiceEntry()
+        :rr_cursor(0)
+    {
+    }
+    string service_name;
+    std::vector<RemoteRoute> routes;
+    // the receivers on the peers for GETCLIENT, the clients without receiver port are not included.
+    AvailableServiceEntry available;
+    mutable volatile unsigned long rr_cursor;
+};
+typedef core::common::RadixTrie<RemoteServiceEntry> RemoteServiceIndexT;
+static boost::shared_ptr<const RemoteServiceIndexT> s_remote_index(new RemoteServiceIndexT());
+// the links to the peer servers, published as the immutable snapshots like the indexes.
+static boost::shared_ptr<const TcpSockContainerT> s_peer_links(new TcpSockContainerT());
+// the peer links connected by this server, the others are connected by the peers.
+static boost::shared_ptr<const TcpSockContainerT> s_outbound_links(new TcpSockContainerT());
+// the names of the peer servers by the links, known from the first sync on the link.
+static std::map<long, string> s_peer_link_names;
+static PeerServerContainerT s_peer_servers;
+// protect the peer servers and the links, taken after g_activeclients_locker if both are needed.
+core::common::locker g_peers_locker;
+static std::string s_server_name;
+static bool s_federation_enabled = false;
+// the peers to connect, only used in the federation thread.
+static std::vector<PeerAddr> s_peer_addrs;
+// the ips of all the peers listed, the links from the others do not get the syncs.
+static std::set<string> s_peer_ips;
+
+// the clients subscribing the changes of the services with the prefixes, so they can keep
+// their caches of the receivers warm without GETCLIENT.
+struct ServiceSubscriber
+{
+    TcpSockSmartPtr tcp;
+    std::set<string> prefixes;
+};
+typedef std::map<long, ServiceSubscriber> ServiceSubscriberContainerT;
+static ServiceSubscriberContainerT s_service_subscribers;
+// taken after all the other locks, the changes are pushed with it held so they arrive in order.
+core::common::locker g_subscribers_locker;
 
 struct ReqTask{
+    ReqTask()
+        :source(0),
+        data_len(0),
+        from_peer(false)
+    {
+    }
+    // the fd of the tcp the message is received from, which decides the relay shard.
+    long source;
     std::string client_name;
     uint32_t data_len;
     boost::shared_array<char> data;
+    // forwarded by a peer server, only delivered to the local clients.
+    bool from_peer;
 };
+// the relayed frame is serialized once for each kind of the clients, all the dests share the same
+// immutable frames without copy.
+struct SharedWireFrames
+{
+    // the v1 frame for the old clients.
+    SharedFrame frame;
+    // the v2 frame with the names inline, empty if failed to encode.
+    SharedFrame compact_frame;
+    // the compressed v2 frame for the clients supporting compression, empty if not compressed.
+    SharedFrame compressed_frame;
+};
+// the broadcast frames are serialized before queued.
 struct BroadcastTask
 {
-    uint32_t data_len;
-    boost::shared_array<char> data;
+    BroadcastTask()
+        :source(0)
+    {
+    }
+    SharedWireFrames frames;
+    // the msgid of the broadcast to match the interests, empty if failed to parse.
+    std::string msgid;
+    // the peer link forwarded the broadcast, empty if from the local client.
+    TcpSockSmartPtr from_link;
+    // the name of the peer server forwarded the broadcast.
+    std::string from_server;
+    // the fd of the tcp the broadcast is received from, which decides the relay shard.
+    long source;
 };
-std::deque< ReqTask > reqtoclient_task_container;
-std::deque< BroadcastTask > broadcast_task_container;
-core::common::condition g_reqtask_cond;
-core::common::locker g_reqtask_locker;
+// the relayed messages are forwarded by several relay shards, each has its own queues and thread.
+// the messages are sharded by the tcp they are received from, so all the messages from the same
+// sender are forwarded by the same shard in order, whether they are sent to a service or to a
+// group of services by the prefix. each broadcast is also queued to the shard of its sender,
+// which walks the services once and sends it to all of them.
+struct RelayShard
+{
+    std::deque< ReqTask > reqtoclient_task_container;
+    std::deque< BroadcastTask > broadcast_task_container;
+    core::common::condition reqtask_cond;
+    core::common::locker reqtask_locker;
+    size_t shard_index;
+    pthread_t process_thread;
+};
+typedef std::vector< boost::shared_ptr<RelayShard> > RelayShardContainerT;
+// created before the listeners start and never changed after, so it is read without lock.
+static boost::shared_ptr<const RelayShardContainerT> s_relay_shards;
 
 class PBHandlerBase
 {
 public:
+    PBHandlerBase(bool need_register)
+        :need_register_(need_register)
+    {
+    }
     virtual ~PBHandlerBase(){};
     virtual void onPbData(TcpSockSmartPtr sp_tcp, const MsgBusPackHead& head, const string& pbtype, const string& pbdata) const = 0;
+    // whether the data is only accepted from the registered clients.
+    bool NeedRegister() const
+    {
+        return need_register_;
+    }
+private:
+    bool need_register_;
 };
 
 template <typename T> class PBHandlerT: public PBHandlerBase
 {
 public:
     typedef boost::function<void(TcpSockSmartPtr sp_tcp, const MsgBusPackHead& head, T*)> PBHandlerCB;
-    PBHandlerT(const PBHandlerCB& cb)
-        :cb_(cb)
+    PBHandlerT(const PBHandlerCB& cb, bool need_register)
+        :PBHandlerBase(need_register),
+        cb_(cb)
     {
     }
     virtual void onPbData(TcpSockSmartPtr sp_tcp, const MsgBusPackHead& head, const string& pbtype, const string& pbdata) const
@@ -129,83 +437,571 @@ private:
 typedef std::map<string, boost::shared_ptr<PBHandlerBase> > PBHandlerContainerT;
 static PBHandlerContainerT s_pb_handlers;
 
-template<typename T> void regist_pbdata_handler(const typename PBHandlerT<T>::PBHandlerCB& cb)
+template<typename T> void regist_pbdata_handler(const typename PBHandlerT<T>::PBHandlerCB& cb, bool need_register = true)
 {
-    boost::shared_ptr<PBHandlerT<T> > pbh(new PBHandlerT<T>(cb));
+    boost::shared_ptr<PBHandlerT<T> > pbh(new PBHandlerT<T>(cb, need_register));
     s_pb_handlers[T::descriptor()->full_name()] = pbh;
 }
 
-void process_data_from_client(TcpSockSmartPtr sp_tcp, const MsgBusPackHead& head, boost::shared_array<char> bodybuffer);
+void process_data_from_client(TcpSockSmartPtr sp_tcp, const MsgBusPackHead& head, boost::shared_array<char> framebuffer);
 void process_register_req(TcpSockSmartPtr sp_tcp, const MsgBusPackHead& head, boost::shared_array<char> bodybuffer, uint32_t body_len);
 void process_unregister_req(TcpSockSmartPtr sp_tcp, const MsgBusPackHead& head, boost::shared_array<char> bodybuffer, uint32_t body_len);
-void process_sendmsg_req(TcpSockSmartPtr sp_tcp, const MsgBusPackHead& head, boost::shared_array<char> bodybuffer, uint32_t body_len);
+void process_sendmsg_req(TcpSockSmartPtr sp_tcp, const MsgBusPackHead& head, boost::shared_array<char> framebuffer);
 void process_getclient_req(TcpSockSmartPtr sp_tcp, const MsgBusPackHead& head, boost::shared_array<char> bodybuffer, uint32_t body_len);
 void process_confirm_alive_req(TcpSockSmartPtr sp_tcp, const MsgBusPackHead& head, boost::shared_array<char> bodybuffer, uint32_t body_len);
 void process_pbbody_data(TcpSockSmartPtr sp_tcp, const MsgBusPackHead& head, boost::shared_array<char> bodybuffer, uint32_t body_len);
 
-size_t server_onRead(TcpSockSmartPtr sp_tcp, const char* pdata, size_t size);
-bool server_onSend(TcpSockSmartPtr sp_tcp);
+bool msgbus_select_best_client(const ActiveServiceEntry& entry, ActiveReplica& bestelem);
+bool msgbus_select_best_client(const AvailableServiceEntry& entry, ClientHost& bestelem);
+bool server_send_relay(const ActiveReplica& replica, const SharedWireFrames& frames);
+boost::shared_ptr<ClientTcpCodec> get_tcp_codec(TcpSockSmartPtr sp_tcp);
+bool server_send_broadcast(const ActiveReplica& replica, const BroadcastTask& task);
+bool get_content_msgid(const char* content, uint32_t content_len, std::string& msgid);
+SharedFrame pack_pbbody_frame(const google::protobuf::Message& pbmsg, uint32_t msg_id);
+bool msgbus_select_best_route(const RemoteServiceEntry& entry, RemoteRoute& bestroute);
+bool is_peer_link(TcpSockSmartPtr sp_tcp);
+std::string get_peer_server_name(TcpSockSmartPtr sp_tcp);
+void federation_sync_service(const std::string& service_name);
+void federation_remove_link(TcpSockSmartPtr sp_tcp);
+void send_to_peer_links(const SharedFrame& frame, bool outbound);
+void notify_service_subscribers(const std::string& service_name);
+
+size_t server_onRead(boost::shared_ptr<MsgBusWireCodec> codec, boost::shared_ptr<ClientStrand> strand,
+    TcpSockSmartPtr sp_tcp, const char* pdata, size_t size);
+bool server_onSend(boost::shared_ptr<ClientTcpCodec> tcpcodec, TcpSockSmartPtr sp_tcp);
 void server_onError(TcpSockSmartPtr sp_tcp);
 void server_onClose(TcpSockSmartPtr sp_tcp);
 void server_onTimeout(TcpSockSmartPtr sp_tcp);
 
+size_t get_relay_shard_index(long source)
+{
+    // the fds are mixed, so the shards are used evenly whatever the shard number is.
+    return utility::HashShard(source, s_relay_shards->size());
+}
+
 bool msgbus_queue_reqtoclient(const ReqTask& req_task)
 {
-    core::common::locker_guard guard(g_reqtask_locker);
-    reqtoclient_task_container.push_back(req_task);
-    g_reqtask_cond.notify_one();
+    RelayShard& shard = *(*s_relay_shards)[get_relay_shard_index(req_task.source)];
+    core::common::locker_guard guard(shard.reqtask_locker);
+    shard.reqtoclient_task_container.push_back(req_task);
+    shard.reqtask_cond.notify_one();
     return true;
 }
 bool msgbus_queue_broadcast(const BroadcastTask& broadcast_task)
 {
-    core::common::locker_guard guard(g_reqtask_locker);
-    broadcast_task_container.push_back(broadcast_task);
-    g_reqtask_cond.notify_one();
+    RelayShard& shard = *(*s_relay_shards)[get_relay_shard_index(broadcast_task.source)];
+    core::common::locker_guard guard(shard.reqtask_locker);
+    shard.broadcast_task_container.push_back(broadcast_task);
+    shard.reqtask_cond.notify_one();
     return true;
 }
 
-bool is_prefix_matching(const std::string& left, const std::string& right)
+boost::shared_ptr<const ActiveServiceIndexT> get_active_index()
 {
-    return left.size() > right.size() ? left.substr(0, right.size()) == right : right.substr(0, left.size()) == left;
+    return boost::atomic_load(&s_active_index);
 }
 
-// give a method to select the best client to server to realize load balancing. 
-bool msgbus_select_best_client(const TcpSockContainerT& container, TcpSockSmartPtr& bestelem)
+boost::shared_ptr<const AvailableServiceIndexT> get_available_index()
+{
+    return boost::atomic_load(&s_available_index);
+}
+
+boost::shared_ptr<const RemoteServiceIndexT> get_remote_index()
+{
+    return boost::atomic_load(&s_remote_index);
+}
+
+boost::shared_ptr<const TcpSockContainerT> get_peer_links()
+{
+    return boost::atomic_load(&s_peer_links);
+}
+
+boost::shared_ptr<const TcpSockContainerT> get_outbound_links()
+{
+    return boost::atomic_load(&s_outbound_links);
+}
+
+// stop at the first matched service, the services in the indexes always have clients.
+// whether any matched service exists, and whether any of them has a replica can be selected.
+struct ServiceExistVisitor
+{
+    ServiceExistVisitor()
+        :is_exist(false),
+        is_available(false)
+    {
+    }
+    bool operator()(const ActiveServiceIndexT::ValuePtr& entry)
+    {
+        is_exist = true;
+        for(size_t i = 0; i < entry->replicas.size() && !is_available; ++i)
+            is_available = entry->replicas[i].busy_state != UNAVAILABLE;
+        return !is_available;
+    }
+    bool operator()(const RemoteServiceIndexT::ValuePtr& entry)
+    {
+        is_exist = true;
+        for(size_t i = 0; i < entry->routes.size() && !is_available; ++i)
+            is_available = entry->routes[i].busy_state != UNAVAILABLE;
+        return !is_available;
+    }
+    bool is_exist;
+    bool is_available;
+};
+
+// select one client from each matched service.
+struct SelectBestClientVisitor
+{
+    bool operator()(const ActiveServiceIndexT::ValuePtr& entry)
+    {
+        ActiveReplica destclient;
+        if(msgbus_select_best_client(*entry, destclient))
+            destclients[(long)destclient.tcp.get()] = destclient;
+        return true;
+    }
+    std::map<long, ActiveReplica> destclients;
+};
+
+// select one peer for each matched service without local client. the frame is forwarded to the
+// selected peer with the exact service name as the dest, so the peer delivers it only to that
+// service and no service gets it twice.
+struct SelectRemoteRouteVisitor
+{
+    SelectRemoteRouteVisitor()
+        :local_index(get_active_index())
+    {
+    }
+    bool operator()(const RemoteServiceIndexT::ValuePtr& entry)
+    {
+        if(local_index->Find(entry->service_name))
+            return true;
+        RemoteRoute route;
+        if(msgbus_select_best_route(*entry, route))
+            destroutes[entry->service_name] = route.link;
+        return true;
+    }
+    boost::shared_ptr<const ActiveServiceIndexT> local_index;
+    std::map<std::string, TcpSockSmartPtr> destroutes;
+};
+
+// send the broadcast to one client of each service.
+struct BroadcastVisitor
+{
+    BroadcastVisitor(const BroadcastTask& task)
+        :task_(task)
+    {
+    }
+    bool operator()(const ActiveServiceIndexT::ValuePtr& entry)
+    {
+        if(task_.from_link && !is_delivered_here(entry->service_name))
+            return true;
+        ActiveReplica destclient;
+        if(!msgbus_select_best_client(*entry, destclient))
+            return true;
+        if(!is_interested(destclient))
+        {
+            // the replicas usually handle the same messages, try the others only if the chosen
+            // one is not interested.
+            size_t i = 0;
+            while(i < entry->replicas.size() && !is_interested(entry->replicas[i]))
+                ++i;
+            if(i == entry->replicas.size())
+                return true;
+            destclient = entry->replicas[i];
+        }
+        server_send_broadcast(destclient, task_);
+        return true;
+    }
+    bool is_interested(const ActiveReplica& replica) const
+    {
+        if(task_.msgid.empty() || !replica.conn)
+            return true;
+        boost::shared_ptr<const MessageInterest> interest = boost::atomic_load(&replica.conn->interest);
+        return !interest || interest->Match(task_.msgid);
+    }
+    // the broadcast forwarded by a peer is delivered to the service here only if the origin server
+    // has no replica of it and no other peer having it is ahead of this server by name, so each
+    // service gets the broadcast once even if it has replicas on several servers.
+    bool is_delivered_here(const std::string& service_name) const
+    {
+        RemoteServiceIndexT::ValuePtr remote = get_remote_index()->Find(service_name);
+        if(!remote)
+            return true;
+        for(size_t i = 0; i < remote->routes.size(); ++i)
+        {
+            const RemoteRoute& route = remote->routes[i];
+            if(route.server_name == task_.from_server || route.server_name < s_server_name)
+                return false;
+        }
+        return true;
+    }
+    const BroadcastTask& task_;
+};
+
+struct QueryServicesVisitor
+{
+    QueryServicesVisitor(PBQueryServicesRsp& rsp)
+        :rsp_(rsp)
+    {
+    }
+    bool operator()(const AvailableServiceIndexT::ValuePtr& entry)
+    {
+        *rsp_.add_service_name() = entry->service_name;
+        return true;
+    }
+    // the services on the peers, skip the ones listed as the local services already.
+    bool operator()(const RemoteServiceIndexT::ValuePtr& entry)
+    {
+        if(!entry->available.hosts.empty() && !get_available_index()->Find(entry->service_name))
+            *rsp_.add_service_name() = entry->service_name;
+        return true;
+    }
+    PBQueryServicesRsp& rsp_;
+};
+
+// publish the active clients of the service to the index, must be called with g_activeclients_locker held.
+void publish_active_service(const std::string& service_name)
 {
-    if ( container.size() > 0 )
+    boost::shared_ptr<ActiveServiceEntry> entry;
+    ActiveClientTcpContainer::const_iterator cit = active_clients.find(service_name);
+    if(cit != active_clients.end() && !cit->second.empty())
     {
-        TcpSockContainerT::const_iterator pos = container.begin();
-        bestelem = pos->second;
-        int randselect = (int)((rand()/(RAND_MAX + 1.0))*(container.size()));
-        while (pos != container.end())
+        entry.reset(new ActiveServiceEntry());
+        entry->service_name = service_name;
+        TcpSockContainerT::const_iterator tcpit = cit->second.begin();
+        while(tcpit != cit->second.end())
         {
-            if( randselect-- < 0)
+            ActiveReplica replica;
+            replica.tcp = tcpit->second;
+            TcpServicesMap::const_iterator hostit = tcp_services_map.find(tcpit->second->GetFD());
+            replica.busy_state = hostit != tcp_services_map.end() ? hostit->second.state() : LOW;
+            replica.conn = get_tcp_codec(tcpit->second);
+            entry->replicas.push_back(replica);
+            ++tcpit;
+        }
+    }
+    boost::shared_ptr<const ActiveServiceIndexT> newindex(new ActiveServiceIndexT(get_active_index()->Set(service_name, entry)));
+    boost::atomic_store(&s_active_index, newindex);
+    federation_sync_service(service_name);
+}
+
+// publish the available hosts of the service to the index, must be called with g_activeclients_locker held.
+void publish_available_service(const std::string& service_name)
+{
+    boost::shared_ptr<AvailableServiceEntry> entry;
+    ServiceContainer::const_iterator cit = available_services.find(service_name);
+    if(cit != available_services.end() && !cit->second.empty())
+    {
+        entry.reset(new AvailableServiceEntry());
+        entry->service_name = service_name;
+        entry->hosts = cit->second;
+    }
+    boost::shared_ptr<const AvailableServiceIndexT> newindex(new AvailableServiceIndexT(get_available_index()->Set(service_name, entry)));
+    boost::atomic_store(&s_available_index, newindex);
+    notify_service_subscribers(service_name);
+}
+
+// publish the routes to the service on the peer servers to the index, must be called with g_peers_locker held.
+void publish_remote_service(const std::string& service_name)
+{
+    boost::shared_ptr<RemoteServiceEntry> entry(new RemoteServiceEntry());
+    entry->service_name = service_name;
+    entry->available.service_name = service_name;
+    PeerServerContainerT::const_iterator peerit = s_peer_servers.begin();
+    while(peerit != s_peer_servers.end())
+    {
+        std::map<string, ClientHostContainer>::const_iterator cit = peerit->second.services.find(service_name);
+        if(cit != peerit->second.services.end() && !cit->second.empty())
+        {
+            RemoteRoute route;
+            route.server_name = peerit->first;
+            route.link = peerit->second.link;
+            route.busy_state = UNAVAILABLE;
+            for(size_t i = 0; i < cit->second.size(); ++i)
             {
-                bestelem = pos->second;
-                break;
+                const ClientHost& host = cit->second[i];
+                route.busy_state = std::min(route.busy_state, host.state());
+                if(host.port() != 0)
+                    entry->available.hosts.push_back(host);
             }
-            ++pos;
+            entry->routes.push_back(route);
         }
-        if(bestelem)
-            return true;
+        ++peerit;
     }
-    return false;
+    if(entry->routes.empty())
+        entry.reset();
+    boost::shared_ptr<const RemoteServiceIndexT> newindex(new RemoteServiceIndexT(get_remote_index()->Set(service_name, entry)));
+    boost::atomic_store(&s_remote_index, newindex);
+    notify_service_subscribers(service_name);
+}
+
+// the load of the active client connections: the reported busy state, the relayed messages
+// not written out and the bytes in the outbound queue.
+class ActiveReplicaLoads : public ReplicaLoadGetter
+{
+public:
+    ActiveReplicaLoads(const ActiveServiceEntry& entry)
+        :entry_(entry)
+    {
+    }
+    ReplicaLoad operator()(size_t index) const
+    {
+        const ActiveReplica& replica = entry_.replicas[index];
+        ReplicaLoad load;
+        load.busy_state = replica.busy_state;
+        if(replica.conn)
+            load.inflight = replica.conn->inflight_relays;
+        load.queued_bytes = replica.tcp->GetQueuedBytes();
+        return load;
+    }
+private:
+    const ActiveServiceEntry& entry_;
+};
+
+// the client connects to the host directly after GETCLIENT, only the busy state is known.
+class AvailableHostLoads : public ReplicaLoadGetter
+{
+public:
+    AvailableHostLoads(const AvailableServiceEntry& entry)
+        :entry_(entry)
+    {
+    }
+    ReplicaLoad operator()(size_t index) const
+    {
+        ReplicaLoad load;
+        load.busy_state = entry_.hosts[index].state();
+        return load;
+    }
+private:
+    const AvailableServiceEntry& entry_;
+};
+
+// the peer servers are loaded by the busy state of their clients and the bytes queued to the link.
+class RemoteRouteLoads : public ReplicaLoadGetter
+{
+public:
+    RemoteRouteLoads(const RemoteServiceEntry& entry)
+        :entry_(entry)
+    {
+    }
+    ReplicaLoad operator()(size_t index) const
+    {
+        const RemoteRoute& route = entry_.routes[index];
+        ReplicaLoad load;
+        load.busy_state = route.busy_state;
+        load.queued_bytes = route.link->GetQueuedBytes();
+        return load;
+    }
+private:
+    const RemoteServiceEntry& entry_;
+};
+
+// give a method to select the best client to server to realize load balancing. 
+bool msgbus_select_best_client(const ActiveServiceEntry& entry, ActiveReplica& bestelem)
+{
+    int index = s_load_balancer->Select(ActiveReplicaLoads(entry), entry.replicas.size(), entry.rr_cursor);
+    if(index < 0)
+        return false;
+    bestelem = entry.replicas[index];
+    return bestelem.tcp.get() != NULL;
 }
 // give a method to select the best client to server to realize load balancing. 
-bool msgbus_select_best_client(const ClientHostContainer& container, ClientHost& bestelem)
+bool msgbus_select_best_client(const AvailableServiceEntry& entry, ClientHost& bestelem)
+{
+    int index = s_load_balancer->Select(AvailableHostLoads(entry), entry.hosts.size(), entry.rr_cursor);
+    if(index < 0)
+        return false;
+    bestelem = entry.hosts[index];
+    return true;
+}
+// select the peer server to forward the message to the service on the peers.
+bool msgbus_select_best_route(const RemoteServiceEntry& entry, RemoteRoute& bestroute)
+{
+    int index = s_load_balancer->Select(RemoteRouteLoads(entry), entry.routes.size(), entry.rr_cursor);
+    if(index < 0)
+        return false;
+    bestroute = entry.routes[index];
+    return bestroute.link.get() != NULL;
+}
+
+boost::shared_ptr<ClientTcpCodec> get_tcp_codec(TcpSockSmartPtr sp_tcp)
+{
+    core::common::locker_guard guard(g_tcpcodecs_locker);
+    TcpCodecContainerT::const_iterator cit = tcp_codecs.find((long)sp_tcp.get());
+    if(cit != tcp_codecs.end())
+        return cit->second;
+    return boost::shared_ptr<ClientTcpCodec>();
+}
+
+// send the packed v1 frame to the client, the frame is encoded to the compact v2 frame if the
+// client supports. only the REQ_SENDMSG frames use the interned names, the encoding and the
+// sending are locked together so the ids are sent in the same order as they are assigned.
+bool server_send_frame(TcpSockSmartPtr sp_tcp, const boost::shared_ptr<ClientTcpCodec>& tcpcodec, const SharedFrame& frame)
 {
-    if ( container.size() > 0 )
+    if(!sp_tcp)
+        return false;
+    if(tcpcodec && tcpcodec->codec->IsCompactEnabled())
     {
-        ClientHostContainer::const_iterator pos = container.begin();
-        bestelem = *pos;
-        int randselect = (int)((rand()/(RAND_MAX + 1.0))*(container.size()));
-        bestelem = *(pos + randselect);
+        std::string compact_frame;
+        core::common::locker_guard guard(tcpcodec->send_locker);
+        if(tcpcodec->codec->EncodeFrame(frame.data(), frame.size(), compact_frame))
+            return sp_tcp->SendData(compact_frame.data(), compact_frame.size());
+    }
+    return sp_tcp->SendData(frame);
+}
+
+bool server_send_frame(TcpSockSmartPtr sp_tcp, const SharedFrame& frame)
+{
+    if(!sp_tcp)
+        return false;
+    return server_send_frame(sp_tcp, get_tcp_codec(sp_tcp), frame);
+}
+
+// whether the client should be treated as slow by its queued bytes now, and the reason if so.
+bool is_slow_consumer(TcpSockSmartPtr sp_tcp, kDisconnectReason& reason)
+{
+    size_t queued = sp_tcp->GetQueuedBytes();
+    if(s_client_budget_bytes > 0 && queued >= s_client_budget_bytes)
+    {
+        reason = DISCONNECT_SLOW_CONSUMER;
         return true;
     }
-    else
+    if(s_server_cap_bytes > 0 && s_total_queued_bytes >= s_server_cap_bytes && queued >= SLOW_CONSUMER_MIN_BYTES)
     {
+        reason = DISCONNECT_SERVER_MEMORY;
+        return true;
+    }
+    return false;
+}
+
+// unregister the client and send the reason, the client is closed after the reason written out
+// or SLOW_CONSUMER_CLOSE_SEC, so the queued bytes will not stay long.
+void disconnect_slow_client(TcpSockSmartPtr sp_tcp, boost::shared_ptr<ClientTcpCodec> tcpcodec, kDisconnectReason reason)
+{
+    if(!__sync_bool_compare_and_swap(&tcpcodec->disconnecting, 0, 1))
+        return;
+    g_log.Log(lv_warn, "disconnect the slow client fd:%d, reason:%d, queued:%zu, all queued:%zu.", sp_tcp->GetFD(),
+        (int)reason, sp_tcp->GetQueuedBytes(), (size_t)s_total_queued_bytes);
+    server_onClose(sp_tcp);
+    PBDisconnectNotify notify;
+    notify.set_reason_code(reason);
+    server_send_frame(sp_tcp, tcpcodec, pack_pbbody_frame(notify, 0));
+    sp_tcp->DisAllowSend();
+    threadpool::queue_timer_task(boost::bind(&TcpSock::Close, sp_tcp, true), SLOW_CONSUMER_CLOSE_SEC, false);
+}
+
+// the slow client has been drained, send the conflated frames and recover it. called by the loop
+// once all the queued bytes are written out, or by the relay shards finding nothing queued.
+void recover_slow_client(TcpSockSmartPtr sp_tcp, const boost::shared_ptr<ClientTcpCodec>& tcpcodec)
+{
+    core::common::locker_guard guard(tcpcodec->conflate_locker);
+    if(!tcpcodec->slow)
+        return;
+    long dropped = __sync_lock_test_and_set(&tcpcodec->slow_dropped, 0);
+    g_log.Log(lv_warn, "the slow client fd:%d drained, %ld frames dropped or conflated, %zu conflated frames sent.",
+        sp_tcp->GetFD(), dropped, tcpcodec->conflated.size());
+    std::map<std::string, SharedFrame>::const_iterator cit = tcpcodec->conflated.begin();
+    while(cit != tcpcodec->conflated.end())
+    {
+        sp_tcp->SendData(cit->second);
+        ++cit;
+    }
+    tcpcodec->conflated.clear();
+    // recovered after the conflated frames are queued, so the new frames are always sent after them.
+    __sync_lock_test_and_set(&tcpcodec->slow, 0);
+}
+
+// encode the v2 frames from the v1 frame, which are shared by all the v2 dests.
+void encode_shared_frames(SharedWireFrames& frames)
+{
+    std::string compact_frame;
+    if(MsgBusWireCodec::EncodeSharedFrame(frames.frame.data(), frames.frame.size(), 0, compact_frame))
+        frames.compact_frame = SharedFrame::CopyFrom(compact_frame.data(), compact_frame.size());
+    if(s_compress_min_bytes > 0 && frames.frame.size() >= s_compress_min_bytes &&
+        MsgBusWireCodec::EncodeSharedFrame(frames.frame.data(), frames.frame.size(), s_compress_min_bytes, compact_frame) &&
+        (compact_frame[3] & MSGBUS_FLAG_COMPRESSED))
+    {
+        frames.compressed_frame = SharedFrame::CopyFrom(compact_frame.data(), compact_frame.size());
+    }
+}
+
+// choose the shared frame the client supports.
+const SharedFrame& choose_shared_frame(const boost::shared_ptr<ClientTcpCodec>& tcpcodec, const SharedWireFrames& frames)
+{
+    if(tcpcodec && tcpcodec->codec->IsCompactEnabled() && !frames.compact_frame.empty())
+    {
+        if(tcpcodec->codec->IsCompressEnabled() && !frames.compressed_frame.empty())
+            return frames.compressed_frame;
+        return frames.compact_frame;
+    }
+    return frames.frame;
+}
+
+// send the non-critical frame to the replica unless the replica is slow, the frame is chosen from
+// the shared frames for it. the relayed messages are counted as its load.
+bool server_send_limited(const ActiveReplica& replica, const SharedWireFrames& frames, const std::string& msgid)
+{
+    const boost::shared_ptr<ClientTcpCodec>& tcpcodec = replica.conn;
+    const SharedFrame& frame = choose_shared_frame(tcpcodec, frames);
+    if(!tcpcodec)
+        return replica.tcp->SendData(frame);
+    if(tcpcodec->disconnecting)
         return false;
+    if(tcpcodec->slow && replica.tcp->GetQueuedBytes() == 0)
+        recover_slow_client(replica.tcp, tcpcodec);
+    kDisconnectReason reason;
+    if(!tcpcodec->slow && is_slow_consumer(replica.tcp, reason) &&
+        __sync_bool_compare_and_swap(&tcpcodec->slow, 0, 1))
+    {
+        g_log.Log(lv_warn, "the client fd:%d is slow, queued:%zu, all queued:%zu, policy:%d.", replica.tcp->GetFD(),
+            replica.tcp->GetQueuedBytes(), (size_t)s_total_queued_bytes, (int)s_slow_policy);
+        if(s_slow_policy == SLOW_DISCONNECT)
+        {
+            disconnect_slow_client(replica.tcp, tcpcodec, reason);
+            return false;
+        }
     }
+    if(tcpcodec->slow)
+    {
+        if(s_slow_policy == SLOW_CONFLATE)
+        {
+            std::string framemsgid = msgid;
+            // the relayed frame is the v1 frame, the message content is after the names and the length.
+            uint32_t content_offset = MsgBusPackHead().Size() + 2*MAX_SERVICE_NAME + sizeof(uint32_t);
+            if(framemsgid.empty() && frames.frame.size() > content_offset)
+                get_content_msgid(frames.frame.data() + content_offset, frames.frame.size() - content_offset, framemsgid);
+            core::common::locker_guard guard(tcpcodec->conflate_locker);
+            // the client may be drained just now, and the conflated frames have been sent.
+            if(tcpcodec->slow && !framemsgid.empty())
+            {
+                tcpcodec->conflated[framemsgid] = frame;
+                __sync_fetch_and_add(&tcpcodec->slow_dropped, 1);
+                return false;
+            }
+        }
+        if(tcpcodec->slow)
+        {
+            __sync_fetch_and_add(&tcpcodec->slow_dropped, 1);
+            return false;
+        }
+    }
+    __sync_fetch_and_add(&tcpcodec->inflight_relays, 1);
+    return replica.tcp->SendData(frame);
+}
+
+// relay the frames shared by all the dests to the replica selected.
+bool server_send_relay(const ActiveReplica& replica, const SharedWireFrames& frames)
+{
+    if(!replica.tcp)
+        return false;
+    return server_send_limited(replica, frames, std::string());
+}
+
+// send the broadcast frames shared by all the dests.
+bool server_send_broadcast(const ActiveReplica& replica, const BroadcastTask& task)
+{
+    if(!replica.tcp)
+        return false;
+    return server_send_limited(replica, task.frames, task.msgid);
 }
 
 bool check_register_client(TcpSockSmartPtr sp_tcp)
@@ -228,6 +1024,7 @@ void unregister_client_from_service(const std::string& service_name, const Clien
                 host.ip().c_str(), host.port(), service_name.c_str());
             if(it->second.empty())
                 available_services.erase(it);
+            publish_available_service(service_name);
         }
         else
         {
@@ -237,94 +1034,85 @@ void unregister_client_from_service(const std::string& service_name, const Clien
     }
 }
 
-// 接收客户端请求的处理线程
-void* msgbus_server_accept_thread( void* param )
+// the handlers of the tcps to the clients and the peer servers, the onRead and onSend are
+// bound with the codec and the strand of each tcp in setup_client_tcp.
+SockHandler get_client_sockhandler()
 {
-    int server_sockfd;
-    int client_sockfd;
-    struct sockaddr_in server_address;
-    struct sockaddr_in client_address;
-    int result;
-    fd_set readfds;
-
-    server_sockfd = socket(AF_INET, SOCK_STREAM, 0);
-    // set SO_REUSEADDR in order to restart quickly after crash
-    int optval = 1;
-    setsockopt(server_sockfd, SOL_SOCKET, SO_REUSEADDR, &optval, sizeof(optval));
-
-    server_address.sin_family = AF_INET;
-    server_address.sin_addr.s_addr = htonl(INADDR_ANY);
-    server_address.sin_port = htons(s_server_port);
-    int server_addr_len = sizeof(server_address);
-    int ret = bind(server_sockfd, (struct sockaddr *)&server_address, server_addr_len);
-    if(ret == -1)
-    {
-        g_log.Log(lv_warn, "msgbus server bind port:%d error.", s_server_port);
-        s_netmsgbus_server_terminate = true;
-        s_netmsgbus_server_running = false;
-        return 0;
-    }
-    ret = listen(server_sockfd,5);
-    if(ret == -1)
-    {
-        g_log.Log(lv_error, "listen socket error.");
-        s_netmsgbus_server_terminate = true;
-        s_netmsgbus_server_running = false;
-        return 0;
-    }
-
-    FD_ZERO(&readfds);
-    FD_SET(server_sockfd, &readfds);
-
-    int max_sockfd = server_sockfd;
-    available_services.clear();
-    active_clients.clear();
-    tcp_services_map.clear();
-//
-//#if defined (__APPLE__) || defined (__MACH__) 
-//    boost::shared_ptr< SockWaiterBase > spwaiter(new SelectWaiter());
-//#else
-//    //boost::shared_ptr< SockWaiterBase > spwaiter(new SelectWaiter());
-//    boost::shared_ptr< SockWaiterBase > spwaiter(new EpollWaiter());
-//#endif
-//    EventLoopPool evpool;
-//    evpool.CreateEventLoop("server_accept_loop", spwaiter);
     SockHandler tcpcb;
-    tcpcb.onRead = boost::bind(server_onRead, _1, _2, _3);
-    tcpcb.onSend = boost::bind(server_onSend, _1);
     tcpcb.onError = boost::bind(server_onError, _1);
     tcpcb.onClose = boost::bind(server_onClose, _1);
     tcpcb.onTimeout = boost::bind(server_onTimeout, _1);
+    return tcpcb;
+}
 
-    if( !core::utility::set_fd_close_onexec(server_sockfd))
+void setup_client_tcp(TcpSockSmartPtr sp_tcp, const SockHandler& tcpcb)
+{
+    boost::shared_ptr<ClientTcpCodec> tcpcodec(new ClientTcpCodec());
+    tcpcodec->codec.reset(new MsgBusWireCodec());
+    tcpcodec->codec->SetCompressThreshold(s_compress_min_bytes);
     {
-        g_log.Log(lv_error, "set fd close on exec error.");
-        s_netmsgbus_server_running = false;
-        return 0;
+        core::common::locker_guard guard(g_tcpcodecs_locker);
+        tcp_codecs[(long)sp_tcp.get()] = tcpcodec;
+    }
+    SockHandler clientcb = tcpcb;
+    boost::shared_ptr<ClientStrand> strand(new ClientStrand());
+    clientcb.onRead = boost::bind(server_onRead, tcpcodec->codec, strand, _1, _2, _3);
+    clientcb.onSend = boost::bind(server_onSend, tcpcodec, _1);
+    sp_tcp->SetSockHandler(clientcb);
+    // the connecting tcp keeps the connect timeout until it is connected.
+    if(!sp_tcp->IsConnecting())
+        sp_tcp->SetTimeout(KEEP_ALIVE_TIME);
+    // the outbound budget limits the non-critical frames instead of the high water of the tcp,
+    // which would refuse the responses, the notifications and the disconnect reason as well.
+    if(s_client_budget_bytes > 0 || s_server_cap_bytes > 0)
+        sp_tcp->SetWaterMark(0);
+}
+
+// called in the inner loop which accepted the new client, and the client will be served by the same loop.
+bool server_onAccept(TcpSockSmartPtr sp_tcp, const SockHandler& tcpcb)
+{
+    setup_client_tcp(sp_tcp, tcpcb);
+    std::string ip;
+    unsigned short int port;
+    sp_tcp->GetDestHost(ip, port);
+    g_log.Log(lv_debug, "a new client connected fd:%d, ip:port = %s:%d.",
+        sp_tcp->GetFD(), ip.c_str(), port);
+    return true;
+}
+
+// 接收客户端请求的处理线程
+// the clients are accepted by the listeners in each inner loop, this thread only checks whether 
+// the server should quit.
+void* msgbus_server_accept_thread( void* param )
+{
+    {
+        core::common::locker_guard guard(g_activeclients_locker);
+        available_services.clear();
+        active_clients.clear();
+        tcp_services_map.clear();
+        boost::atomic_store(&s_active_index, boost::shared_ptr<const ActiveServiceIndexT>(new ActiveServiceIndexT()));
+        boost::atomic_store(&s_available_index, boost::shared_ptr<const AvailableServiceIndexT>(new AvailableServiceIndexT()));
     }
-    if( !core::utility::set_fd_nonblock(server_sockfd))
+
+    SockHandler listencb;
+    listencb.onAccept = boost::bind(server_onAccept, _1, get_client_sockhandler());
+
+    if(!EventLoopPool::ListenOnInnerLoops("", s_server_port, s_server_backlog, listencb))
     {
-        g_log.Log(lv_error, "set fd nonblock error.");
+        g_log.Log(lv_warn, "msgbus server listen on port:%d error.", s_server_port);
+        s_netmsgbus_server_terminate = true;
         s_netmsgbus_server_running = false;
         return 0;
     }
 
-    g_log.Log(lv_warn, "server waiting on port: %d ...", s_server_port);
+    g_log.Log(lv_warn, "server waiting on port: %d, backlog: %d ...", s_server_port, s_server_backlog);
     s_netmsgbus_server_running = true;
     // 长时间没有客户端连接的话,自动退出服务端
     int noclient_quit_cnt = 0;
     while(1){
-        fd_set testreadfds = readfds;
-
-        struct timeval tv;
-        tv.tv_sec = TIMEOUT_SHORT;
-        tv.tv_usec = 0;
-        result = select(max_sockfd + 1, &testreadfds, (fd_set *)0, 0, &tv);
-        if(result == -1) {
-            g_log.Log(lv_error, "server select error.");
-            continue;
-        }
-        if(active_clients.empty())
+        sleep(TIMEOUT_SHORT);
+        // the federated server keeps running for the peers.
+        if(get_active_index()->Empty() && get_peer_links()->empty())
         {
             ++noclient_quit_cnt;
             if(noclient_quit_cnt > 15)
@@ -340,79 +1128,64 @@ void* msgbus_server_accept_thread( void* param )
         {
             break;
         }
-        if(result == 0)
-        {
-            // timeout
-            continue;
-        }
-        if(FD_ISSET(server_sockfd, &testreadfds)) {
-            int client_len = sizeof(client_address);
-            client_sockfd = accept(server_sockfd, (struct sockaddr*)&client_address, (socklen_t *)&client_len);
-            if(client_sockfd >= 0)
-            {
-                char ipstr[INET_ADDRSTRLEN];
-                TcpSockSmartPtr sp_tcp(new TcpSock(client_sockfd, 
-                        inet_ntop(AF_INET, &client_address.sin_addr, ipstr, sizeof(ipstr)), ntohs(client_address.sin_port)));
-                sp_tcp->SetNonBlock();
-                sp_tcp->SetCloseAfterExec();
-                sp_tcp->SetSockHandler(tcpcb);
-                sp_tcp->SetTimeout(KEEP_ALIVE_TIME);
-                EventLoopPool::AddTcpSockToInnerLoop(sp_tcp);
-                //spwaiter->AddTcpSock(sp_tcp);
-                std::string ip;
-                unsigned short int port;
-                sp_tcp->GetDestHost(ip, port);
-                g_log.Log(lv_debug, "a new client connected fd:%d, ip:port = %s:%d.",
-                    client_sockfd, ip.c_str(), port);
-            }
-        }
     }
-    close(server_sockfd);
-    //EventLoopPool::TerminateLoop("server_accept_loop");
+    // the listeners will be closed while destroying the event loop pool.
     s_netmsgbus_server_running = false;
     return 0;
 }
 
-size_t server_onRead(TcpSockSmartPtr sp_tcp, const char* pdata, size_t size)
+// the frames are decoded in the loop thread, so the interned names of the client are
+// learned in the order of receiving.
+size_t server_onRead(boost::shared_ptr<MsgBusWireCodec> codec, boost::shared_ptr<ClientStrand> strand,
+    TcpSockSmartPtr sp_tcp, const char* pdata, size_t size)
 {
     size_t readedlen = 0;
     while(true)
     {
-        size_t needlen;
-        needlen = sizeof(MsgBusPackHead);
-        if( size < needlen )
-            return readedlen;
         MsgBusPackHead head;
-        if (-1 == head.UnPackHead(pdata))
+        const char* body = NULL;
+        int framelen = codec->DecodeFrame(pdata, size, head, body);
+        if(framelen == 0)
+            return readedlen;
+        if(framelen < 0)
         {
             g_log.Log(lv_warn, "unpack head error.");
             return readedlen;
         }
-        pdata += head.Size();
-        needlen += head.body_len;
-        if( size < needlen )
-            return readedlen;
         assert(head.body_len);
-        boost::shared_array<char> bodybuffer(new char[head.body_len]);
-        memcpy(bodybuffer.get(), pdata, head.body_len);
-        readedlen += needlen;
-        size -= needlen;
-        pdata += head.body_len;
+        // the body is kept after the room of the v1 head, so the REQ_SENDMSG can be relayed
+        // by only packing the head in front of it without copying the body again.
+        uint32_t head_len = head.Size();
+        boost::shared_array<char> framebuffer(new char[head_len + head.body_len]);
+        memcpy(framebuffer.get() + head_len, body, head.body_len);
+        readedlen += framelen;
+        size -= framelen;
+        pdata += framelen;
 
         //g_log.Log(lv_debug, "receive head msgid:%u , msg_type:%u, body_type:%#x.", head.msg_id, head.msg_type, head.body_type);
-        threadpool::queue_work_task(boost::bind(process_data_from_client, sp_tcp, head, bodybuffer), 0);
-        //process_data_from_client(sp_tcp, head, bodybuffer);
+        // the cheap requests only need the lock-free lookups, process them in the loop thread
+        // directly if no earlier request of the client is waiting.
+        bool is_cheap = head.msg_type == 0 && (head.body_type == REQ_CONFIRM_ALIVE || head.body_type == REQ_GETCLIENT);
+        if(is_cheap && strand->IsIdle())
+            process_data_from_client(sp_tcp, head, framebuffer);
+        else
+            strand->Post(boost::bind(process_data_from_client, sp_tcp, head, framebuffer));
     }
 }
 
-void process_data_from_client(TcpSockSmartPtr sp_tcp, const MsgBusPackHead& head, boost::shared_array<char> bodybuffer)
+void process_data_from_client(TcpSockSmartPtr sp_tcp, const MsgBusPackHead& head, boost::shared_array<char> framebuffer)
 {
+    MsgBusPackHead packhead;
+    // the body buffer shares the ownership of the frame buffer.
+    boost::shared_array<char> bodybuffer(framebuffer, framebuffer.get() + packhead.Size());
 
     //g_log.Log(lv_debug, "server process data from client in thread : %lu.", (unsigned long)pthread_self());
     if( head.msg_type == 0 )
     {
-        bool check_reg = check_register_client(sp_tcp);
-        if ((head.body_type != REQ_REGISTER) && (head.body_type != REQ_CONFIRM_ALIVE) && !check_reg)
+        bool check_reg = check_register_client(sp_tcp) || is_peer_link(sp_tcp);
+        // the protocol buffer data is checked by its handler, the peer servers are not registered.
+        if ((head.body_type != REQ_REGISTER) && (head.body_type != REQ_CONFIRM_ALIVE) &&
+            (head.body_type != BODY_PBTYPE) && !check_reg)
         {
             LOG(g_log, lv_warn, "The client %d has not been registered, ignore any other request except register and heart confirm. req:%d.",
                 sp_tcp->GetFD(), head.body_type);
@@ -433,7 +1206,7 @@ void process_data_from_client(TcpSockSmartPtr sp_tcp, const MsgBusPackHead& head
             break;
         case REQ_SENDMSG:
             {
-                process_sendmsg_req(sp_tcp, head, bodybuffer, head.body_len);
+                process_sendmsg_req(sp_tcp, head, framebuffer);
             }
             break;
         case REQ_UNREGISTER:
@@ -465,8 +1238,12 @@ void process_data_from_client(TcpSockSmartPtr sp_tcp, const MsgBusPackHead& head
     }
 }
 
-bool server_onSend(TcpSockSmartPtr sp_tcp)
+// called when all the queued data has been written out.
+bool server_onSend(boost::shared_ptr<ClientTcpCodec> tcpcodec, TcpSockSmartPtr sp_tcp)
 {
+    __sync_lock_test_and_set(&tcpcodec->inflight_relays, 0);
+    if(tcpcodec->slow && !tcpcodec->disconnecting)
+        recover_slow_client(sp_tcp, tcpcodec);
     return true;
 }
 
@@ -485,33 +1262,51 @@ void server_onError(TcpSockSmartPtr sp_tcp)
 
 void server_onClose(TcpSockSmartPtr sp_tcp)
 {
-    // remove the client info from the map.
-    std::string service_name;
+    federation_remove_link(sp_tcp);
+    {
+        core::common::locker_guard guard(g_subscribers_locker);
+        s_service_subscribers.erase((long)sp_tcp.get());
+    }
+    {
+        core::common::locker_guard guard(g_tcpcodecs_locker);
+        tcp_codecs.erase((long)sp_tcp.get());
+    }
+    // remove the client info from the map, the client may be registered as more than one service.
+    std::vector<std::string> service_names;
     ClientHost host;
     {
         core::common::locker_guard guard(g_activeclients_locker);
+        TcpServicesMap::iterator hostit = tcp_services_map.find(sp_tcp->GetFD());
+        if(hostit != tcp_services_map.end())
+        {
+            host = hostit->second;
+            tcp_services_map.erase(hostit);
+        }
         ActiveClientTcpContainer::iterator it = active_clients.begin();
         while( it != active_clients.end() )
         {
             //TcpSockContainerT::iterator clientit = std::find_if(it->second.begin(), it->second.end(), IsSameTcpSock( sp_tcp ));
             TcpSockContainerT::iterator clientit = it->second.find((long)sp_tcp.get());
-            if( clientit != it->second.end() )
-            {   
-                assert(sp_tcp->GetFD() == clientit->second->GetFD());
-                host = tcp_services_map[sp_tcp->GetFD()];
-                service_name = it->first;
-                g_log.Log(lv_debug, "removing client fd: %d, %s:%d , one active of service:%s ,in server.",
-                    sp_tcp->GetFD(), host.ip().c_str(), host.port(), service_name.c_str());
-                it->second.erase(clientit);
-                tcp_services_map.erase(sp_tcp->GetFD());
-                if(it->second.empty())
-                    active_clients.erase(it);
-                break;
+            if( clientit == it->second.end() )
+            {
+                ++it;
+                continue;
             }
-            ++it;
+            assert(sp_tcp->GetFD() == clientit->second->GetFD());
+            std::string service_name = it->first;
+            g_log.Log(lv_debug, "removing client fd: %d, %s:%d , one active of service:%s ,in server.",
+                sp_tcp->GetFD(), host.ip().c_str(), host.port(), service_name.c_str());
+            it->second.erase(clientit);
+            if(it->second.empty())
+                active_clients.erase(it++);
+            else
+                ++it;
+            publish_active_service(service_name);
+            service_names.push_back(service_name);
         }
     }
-    unregister_client_from_service(service_name, host);
+    for(size_t i = 0; i < service_names.size(); ++i)
+        unregister_client_from_service(service_names[i], host);
 }
 
 void process_confirm_alive_req(TcpSockSmartPtr sp_tcp, const MsgBusPackHead& head, boost::shared_array<char> bodybuffer, uint32_t body_len)
@@ -528,31 +1323,21 @@ void process_confirm_alive_req(TcpSockSmartPtr sp_tcp, const MsgBusPackHead& hea
     boost::shared_array<char> buf(new char[rsp.Size()]);
     rsp.PackData(buf.get());
     if(sp_tcp)
-        sp_tcp->SendData(buf.get(), rsp.Size());
+        server_send_frame(sp_tcp, SharedFrame(buf, rsp.Size()));
 }
 
-void process_register_req(TcpSockSmartPtr sp_tcp, const MsgBusPackHead& head, boost::shared_array<char> bodybuffer, uint32_t body_len)
+// register the client of the connection as the service, or update the busy state of it.
+// return false with the reason in errmsg if failed.
+bool register_client_service(TcpSockSmartPtr sp_tcp, const std::string& service_name, ClientHost host, std::string& errmsg)
 {
-    MsgBusRegisterReq reg_req;
-    reg_req.UnPackBody(bodybuffer.get());
-    string service_name(reg_req.service_name);
-
-    MsgBusRegisterRsp rsp;
-    rsp.msg_id = head.msg_id;
-    rsp.ret_code = 0;
-    rsp.err_msg_len = 1;
-    strncpy(rsp.service_name, reg_req.service_name, MAX_SERVICE_NAME);
-    string errmsg;
-
+    bool ret = true;
     if(service_name == "")
     {
-        rsp.ret_code = 1;
         errmsg = string("empty name is not allowed.");
-        rsp.err_msg_len = errmsg.size() + 1;
+        return false;
     }
     else
     {
-        ClientHost host = reg_req.service_host;
         if(host.ip().empty())
         {
             if(sp_tcp)
@@ -564,9 +1349,8 @@ void process_register_req(TcpSockSmartPtr sp_tcp, const MsgBusPackHead& head, bo
             }
             else
             {
-                rsp.ret_code = 1;
+                ret = false;
                 errmsg = string("can not get host ip for receiver service.");
-                rsp.err_msg_len = errmsg.size() + 1;
             }
         }
         g_log.Log(lv_debug, "receive register request, name:%s.", service_name.c_str());
@@ -580,6 +1364,14 @@ void process_register_req(TcpSockSmartPtr sp_tcp, const MsgBusPackHead& head, bo
             {
                 // update the server host state
                 pos->set_state(host.state());
+                publish_available_service(service_name);
+                // the state of the active connection is used while relaying.
+                TcpServicesMap::iterator hostit = tcp_services_map.find(sp_tcp->GetFD());
+                if(hostit != tcp_services_map.end())
+                {
+                    hostit->second.set_state(host.state());
+                    publish_active_service(service_name);
+                }
                 g_log.Log(lv_debug, "update the server host state.new state %d.", host.state());
             }
             else
@@ -588,6 +1380,8 @@ void process_register_req(TcpSockSmartPtr sp_tcp, const MsgBusPackHead& head, bo
                 // 存储当前服务对应的活动连接，以便其他地方直接拿到该连接符来发送数据
                 active_clients[service_name][(long)sp_tcp.get()] = sp_tcp;
                 tcp_services_map[sp_tcp->GetFD()] = host;
+                publish_available_service(service_name);
+                publish_active_service(service_name);
                 g_log.Log(lv_debug, "a new host added to an exist service.");
                 g_log.Log(lv_debug, "new add server host is %s:%d.", 
                     host.ip().c_str(), host.port());
@@ -604,14 +1398,14 @@ void process_register_req(TcpSockSmartPtr sp_tcp, const MsgBusPackHead& head, bo
                 ClientHostContainer container;
                 container.push_back(host);
                 available_services[service_name] = container;
+                publish_available_service(service_name);
             }
             else
             {
                 if (active_clients.find(service_name) != active_clients.end())
                 {
-                    rsp.ret_code = 1;
+                    ret = false;
                     errmsg = string("Register without service port can only be registered once.");
-                    rsp.err_msg_len = errmsg.size() + 1;
                     can_reg = false;
                     g_log.Log(lv_debug, "register without service port can only be registered once, service:%s, server host is %s:%d.", service_name.c_str(),
                         host.ip().c_str(), host.port());
@@ -622,11 +1416,32 @@ void process_register_req(TcpSockSmartPtr sp_tcp, const MsgBusPackHead& head, bo
                 // 存储当前服务对应的活动连接，以便其他地方直接拿到该连接符来发送数据
                 active_clients[service_name][(long)sp_tcp.get()] = sp_tcp;
                 tcp_services_map[sp_tcp->GetFD()] = host;
+                publish_active_service(service_name);
                 g_log.Log(lv_debug, "new register service:%s, server host is %s:%d.", service_name.c_str(),
                     host.ip().c_str(), host.port());
             }
         }
     }
+    return ret;
+}
+
+void process_register_req(TcpSockSmartPtr sp_tcp, const MsgBusPackHead& head, boost::shared_array<char> bodybuffer, uint32_t body_len)
+{
+    MsgBusRegisterReq reg_req;
+    reg_req.UnPackBody(bodybuffer.get());
+    string service_name(reg_req.service_name);
+
+    MsgBusRegisterRsp rsp;
+    rsp.msg_id = head.msg_id;
+    rsp.ret_code = 0;
+    rsp.err_msg_len = 1;
+    strncpy(rsp.service_name, reg_req.service_name, MAX_SERVICE_NAME);
+    string errmsg;
+    if(!register_client_service(sp_tcp, service_name, reg_req.service_host, errmsg))
+    {
+        rsp.ret_code = 1;
+        rsp.err_msg_len = errmsg.size() + 1;
+    }
     assert(rsp.err_msg_len);
     // until I know, all implementation of std::string's storage is contiguous. 
     errmsg.push_back('\0');
@@ -636,204 +1451,807 @@ void process_register_req(TcpSockSmartPtr sp_tcp, const MsgBusPackHead& head, bo
     boost::shared_array<char> outbuffer( new char[rsp.Size()] );
     rsp.PackData(outbuffer.get());
 
-    if( sp_tcp )
-        sp_tcp->SendData(outbuffer.get(), rsp.Size());
+    if( sp_tcp )
+        server_send_frame(sp_tcp, SharedFrame(outbuffer, rsp.Size()));
+}
+
+void process_unregister_req(TcpSockSmartPtr sp_tcp, const MsgBusPackHead& head, boost::shared_array<char> bodybuffer, uint32_t body_len)
+{
+    MsgBusUnRegisterReq unreg_req;
+    unreg_req.UnPackBody(bodybuffer.get());
+    string service_name(unreg_req.service_name);
+
+    if(service_name == "")
+    {
+        return;
+    }
+    else
+    {
+        ClientHost host = unreg_req.service_host;
+        g_log.Log(lv_debug, "receive unregister request, name:%s.", service_name.c_str());
+        if(host.ip().empty())
+        {
+            if(sp_tcp)
+            {
+                std::string ip;
+                unsigned short int port;
+                sp_tcp->GetDestHost(ip, port);
+                host.set_ip(ip);
+            }
+            else
+            {
+                return;
+            }
+        }
+        unregister_client_from_service(service_name, host);
+    }
+}
+
+// parse the msgid from the message content packed by the client: the sender name and the msgid
+// both with 1 byte length before, then the param with 4 bytes length.
+bool get_content_msgid(const char* content, uint32_t content_len, std::string& msgid)
+{
+    if(content_len < 1)
+        return false;
+    uint32_t pos = 1 + (uint8_t)content[0];
+    if(content_len < pos + 1)
+        return false;
+    uint8_t msgid_len = (uint8_t)content[pos];
+    ++pos;
+    if(content_len - pos < msgid_len)
+        return false;
+    msgid.assign(content + pos, msgid_len);
+    return true;
+}
+
+// the received body is relayed as it is, only the dest name and the length are parsed.
+void process_sendmsg_req(TcpSockSmartPtr sp_tcp, const MsgBusPackHead& head, boost::shared_array<char> framebuffer)
+{
+    MsgBusPackHead relayhead(0, REQ_SENDMSG);
+    uint32_t head_len = relayhead.Size();
+    const char* body = framebuffer.get() + head_len;
+    uint32_t msg_len = 0;
+    bool is_valid = head.body_len >= 2*MAX_SERVICE_NAME + sizeof(msg_len);
+    if(is_valid)
+    {
+        memcpy(&msg_len, body + 2*MAX_SERVICE_NAME, sizeof(msg_len));
+        msg_len = ntohl(msg_len);
+        is_valid = head.body_len - 2*MAX_SERVICE_NAME - sizeof(msg_len) >= msg_len;
+    }
+    string dest_name;
+    bool is_exist = false;
+    bool is_available = false;
+    // the messages from the peers are only delivered to the local clients without response.
+    bool from_peer = is_peer_link(sp_tcp);
+    if(is_valid)
+    {
+        dest_name.assign(body, strnlen(body, MAX_SERVICE_NAME));
+        // support the prefix matching of client_name , so we can send messages to group of clients.
+        ServiceExistVisitor exist_visitor;
+        get_active_index()->VisitPrefixMatching(dest_name, exist_visitor);
+        if(!exist_visitor.is_available && !from_peer)
+            get_remote_index()->VisitPrefixMatching(dest_name, exist_visitor);
+        is_exist = exist_visitor.is_exist;
+        // the message to the services with all the replicas unavailable would be dropped.
+        is_available = exist_visitor.is_available;
+    }
+    MsgBusSendMsgRsp rsp;
+    rsp.msg_id = head.msg_id;
+    rsp.ret_code = 0;
+    rsp.err_msg_len = 2;
+
+    std::string errmsg;
+    if(is_available)
+    {
+        // forward the data to other client. the v1 head is packed in the room before the body,
+        // the data after the message content is dropped as before.
+        relayhead.body_len = 2*MAX_SERVICE_NAME + sizeof(msg_len) + msg_len;
+        relayhead.PackHead(framebuffer.get());
+        uint32_t frame_len = head_len + relayhead.body_len;
+
+        // 转发数据
+        if(dest_name == "")
+        {
+            BroadcastTask btask;
+            btask.frames.frame = SharedFrame(framebuffer, frame_len);
+            get_content_msgid(body + 2*MAX_SERVICE_NAME + sizeof(msg_len), msg_len, btask.msgid);
+            encode_shared_frames(btask.frames);
+            if(from_peer)
+            {
+                btask.from_link = sp_tcp;
+                btask.from_server = get_peer_server_name(sp_tcp);
+            }
+            btask.source = sp_tcp->GetFD();
+            msgbus_queue_broadcast(btask);
+            if(!from_peer)
+                send_to_peer_links(btask.frames.frame, true);
+        }
+        else
+        {
+            ReqTask ctask;
+            ctask.source = sp_tcp->GetFD();
+            ctask.client_name = dest_name;
+            ctask.data_len = frame_len;
+            ctask.data = framebuffer;
+            ctask.from_peer = from_peer;
+            msgbus_queue_reqtoclient(ctask);
+        }
+
+    }
+    else if(!is_valid)
+    {
+        g_log.Log(lv_warn, "invalid sendmsg request from client fd:%d, body len:%u.", sp_tcp->GetFD(), head.body_len);
+        rsp.ret_code = 1;
+        errmsg = "invalid message.";
+    }
+    else if(is_exist)
+    {
+        rsp.ret_code = 1;
+        errmsg = "dest client not available.";
+    }
+    else
+    {
+        rsp.ret_code = 1;
+        errmsg = "dest client not found.";
+        rsp.err_msg_len = errmsg.size() + 1;
+    }
+
+    // until I know, all implementation of std::string's storage is contiguous. 
+    errmsg.push_back('\0');
+    rsp.err_msg_len = errmsg.size();
+    rsp.SetVarData( &errmsg[0] );
+
+    boost::shared_array<char> rspbuffer(new char[rsp.Size()]);
+    rsp.PackData(rspbuffer.get());
+    if(sp_tcp && !from_peer)
+        server_send_frame(sp_tcp, SharedFrame(rspbuffer, rsp.Size()));
+}
+
+void process_getclient_req(TcpSockSmartPtr sp_tcp, const MsgBusPackHead& head, boost::shared_array<char> bodybuffer, uint32_t body_len)
+{
+    MsgBusGetClientReq req;
+    req.UnPackBody(bodybuffer.get());
+    string dest_name(req.dest_name);
+    //g_log.Log(lv_debug, "receive get client info request, client name:%s.", dest_name.c_str());
+
+    MsgBusGetClientRsp rsp;
+    rsp.msg_id = head.msg_id;
+    strncpy(rsp.dest_name, req.dest_name, MAX_SERVICE_NAME);
+    //g_log.Log(lv_debug, "rsp client name:%s.", rsp.dest_name);
+
+    ClientHostContainer::value_type host;
+    AvailableServiceIndexT::ValuePtr entry = get_available_index()->Find(dest_name);
+    bool is_found = entry && msgbus_select_best_client(*entry, host);
+    if(!is_found)
+    {
+        // the receivers on the peer servers can be connected directly as well.
+        RemoteServiceIndexT::ValuePtr remote_entry = get_remote_index()->Find(dest_name);
+        is_found = remote_entry && msgbus_select_best_client(remote_entry->available, host);
+    }
+    if(is_found)
+    {
+        rsp.ret_code = 0;
+        rsp.dest_host = host;
+    }
+    else
+    {
+        rsp.ret_code = 1;
+    }
+    boost::shared_array<char> outbuffer( new char[rsp.Size()] );
+    rsp.PackData(outbuffer.get());
+    if(sp_tcp)
+        server_send_frame(sp_tcp, SharedFrame(outbuffer, rsp.Size()));
+}
+
+void process_pbbody_data(TcpSockSmartPtr sp_tcp, const MsgBusPackHead& head, boost::shared_array<char> bodybuffer, uint32_t body_len)
+{
+    MsgBusPackPBType pbbody;
+
+    pbbody.UnPackBody(bodybuffer.get(), body_len);
+    string pbtype(pbbody.GetPBType());
+    string pbdata(pbbody.GetPBData(), pbbody.pbdata_len);
+    PBHandlerContainerT::const_iterator cit = s_pb_handlers.find(pbtype);
+    if(cit != s_pb_handlers.end())
+    {
+        if(cit->second->NeedRegister() && !check_register_client(sp_tcp) && !is_peer_link(sp_tcp))
+        {
+            LOG(g_log, lv_warn, "The client %d has not been registered, ignore the pbtype:%s.",
+                sp_tcp->GetFD(), pbtype.c_str());
+            return;
+        }
+        cit->second->onPbData(sp_tcp, head, pbtype, pbdata);
+    }
+    else
+    {
+        g_log.Log(lv_warn, "unknown pbtype:%s of protocol buffer data.", pbtype.c_str());
+    }
+}
+
+// pack the protocol buffer message to a BODY_PBTYPE frame.
+SharedFrame pack_pbbody_frame(const google::protobuf::Message& pbmsg, uint32_t msg_id)
+{
+    MsgBusPackPBType packpb;
+    packpb.msg_id = msg_id;
+    std::string pbtype = pbmsg.GetDescriptor()->full_name();
+    pbtype.push_back('\0');
+    packpb.pbtype_len = pbtype.size();
+    // until I know, all implementation of std::string's storage is contiguous. 
+    int size = pbmsg.ByteSize();
+    boost::shared_array<char> pbdata(new char[size]);
+    pbmsg.SerializeToArray(pbdata.get(), size);
+    packpb.pbdata_len = size; 
+    packpb.SetVarData(&pbtype[0], pbdata.get());
+
+    boost::shared_array<char> outbuffer( new char[packpb.Size()] );
+    packpb.PackData(outbuffer.get(), packpb.Size());
+    return SharedFrame(outbuffer, packpb.Size());
+}
+
+void onQueryServicesReq(TcpSockSmartPtr sp_tcp, const MsgBusPackHead& head, PBQueryServicesReq* req)
+{
+    std::string prefix = req->match_prefix();
+    g_log.Log(lv_debug, "receive query service requst, prefix:%s", prefix.c_str());
+    PBQueryServicesRsp rsp;
+    QueryServicesVisitor query_visitor(rsp);
+    get_available_index()->VisitWithPrefix(prefix, query_visitor);
+    get_remote_index()->VisitWithPrefix(prefix, query_visitor);
+    g_log.Log(lv_debug, "msgid:%u, rsp query services : %s", head.msg_id, rsp.ShortDebugString().c_str());
+    if(sp_tcp)
+        server_send_frame(sp_tcp, pack_pbbody_frame(rsp, head.msg_id));
+}
+
+bool is_peer_link(TcpSockSmartPtr sp_tcp)
+{
+    if(!s_federation_enabled)
+        return false;
+    boost::shared_ptr<const TcpSockContainerT> links = get_peer_links();
+    return links->find((long)sp_tcp.get()) != links->end();
+}
+
+bool is_outbound_link(TcpSockSmartPtr sp_tcp)
+{
+    if(!s_federation_enabled)
+        return false;
+    boost::shared_ptr<const TcpSockContainerT> links = get_outbound_links();
+    return links->find((long)sp_tcp.get()) != links->end();
+}
+
+std::string get_peer_server_name(TcpSockSmartPtr sp_tcp)
+{
+    core::common::locker_guard guard(g_peers_locker);
+    std::map<long, string>::const_iterator cit = s_peer_link_names.find((long)sp_tcp.get());
+    return cit == s_peer_link_names.end() ? string() : cit->second;
+}
+
+// return false if the link is added already.
+bool add_peer_link(TcpSockSmartPtr sp_tcp, bool outbound)
+{
+    core::common::locker_guard guard(g_peers_locker);
+    boost::shared_ptr<const TcpSockContainerT> links = get_peer_links();
+    if(links->find((long)sp_tcp.get()) != links->end())
+        return false;
+    boost::shared_ptr<TcpSockContainerT> newlinks(new TcpSockContainerT(*links));
+    (*newlinks)[(long)sp_tcp.get()] = sp_tcp;
+    boost::atomic_store(&s_peer_links, boost::shared_ptr<const TcpSockContainerT>(newlinks));
+    if(outbound)
+    {
+        boost::shared_ptr<TcpSockContainerT> newoutbound(new TcpSockContainerT(*get_outbound_links()));
+        (*newoutbound)[(long)sp_tcp.get()] = sp_tcp;
+        boost::atomic_store(&s_outbound_links, boost::shared_ptr<const TcpSockContainerT>(newoutbound));
+    }
+    return true;
+}
+
+// send to the peer links connected by this server or by the peers.
+void send_to_peer_links(const SharedFrame& frame, bool outbound)
+{
+    boost::shared_ptr<const TcpSockContainerT> links = get_peer_links();
+    boost::shared_ptr<const TcpSockContainerT> outbound_links = get_outbound_links();
+    TcpSockContainerT::const_iterator cit = links->begin();
+    while(cit != links->end())
+    {
+        if((outbound_links->find(cit->first) != outbound_links->end()) == outbound)
+            server_send_frame(cit->second, frame);
+        ++cit;
+    }
+}
+
+void fill_client_info(const ClientHost& host, PBClientInfo& client_info)
+{
+    uint32_t ip = 0;
+    inet_pton(AF_INET, host.ip().c_str(), &ip);
+    client_info.set_client_ip(ip);
+    client_info.set_client_port(host.port());
+    client_info.set_client_state(host.state());
+}
+
+// fill the clients of the service connected to this server, must be called with g_activeclients_locker held.
+void fill_local_service_clients(const std::string& service_name, PBServiceClients& service_info)
+{
+    service_info.set_service_name(service_name);
+    ActiveClientTcpContainer::const_iterator cit = active_clients.find(service_name);
+    if(cit == active_clients.end())
+        return;
+    TcpSockContainerT::const_iterator tcpit = cit->second.begin();
+    while(tcpit != cit->second.end())
+    {
+        TcpServicesMap::const_iterator hostit = tcp_services_map.find(tcpit->second->GetFD());
+        if(hostit != tcp_services_map.end())
+            fill_client_info(hostit->second, *service_info.add_client_info());
+        ++tcpit;
+    }
+}
+
+// send the delta of the service to all the peers, must be called with g_activeclients_locker
+// held, so the deltas are sent in the same order as the changes.
+void federation_sync_service(const std::string& service_name)
+{
+    if(!s_federation_enabled || get_peer_links()->empty())
+        return;
+    PBSyncServerData syncdata;
+    syncdata.set_server_name(s_server_name);
+    fill_local_service_clients(service_name, *syncdata.add_service_info());
+    send_to_peer_links(pack_pbbody_frame(syncdata, 0), false);
+}
+
+// send all the local services to the peer, it replaces all the services synced before.
+void federation_full_sync(TcpSockSmartPtr link)
+{
+    PBSyncServerData syncdata;
+    syncdata.set_server_name(s_server_name);
+    syncdata.set_full_sync(true);
+    // sent with the lock held, so no later delta is sent before it.
+    core::common::locker_guard guard(g_activeclients_locker);
+    ActiveClientTcpContainer::const_iterator cit = active_clients.begin();
+    while(cit != active_clients.end())
+    {
+        fill_local_service_clients(cit->first, *syncdata.add_service_info());
+        ++cit;
+    }
+    server_send_frame(link, pack_pbbody_frame(syncdata, 0));
 }
 
-void process_unregister_req(TcpSockSmartPtr sp_tcp, const MsgBusPackHead& head, boost::shared_array<char> bodybuffer, uint32_t body_len)
+// send the name of this server only on the link connected by this server, the peer syncs its
+// services back on the link.
+void federation_hello(TcpSockSmartPtr link)
 {
-    MsgBusUnRegisterReq unreg_req;
-    unreg_req.UnPackBody(bodybuffer.get());
-    string service_name(unreg_req.service_name);
+    PBSyncServerData syncdata;
+    syncdata.set_server_name(s_server_name);
+    server_send_frame(link, pack_pbbody_frame(syncdata, 0));
+}
 
-    if(service_name == "")
-    {
+// the services of the peers synced by the link are removed with it, until they are synced by other links.
+void federation_remove_link(TcpSockSmartPtr sp_tcp)
+{
+    if(!is_peer_link(sp_tcp))
         return;
+    core::common::locker_guard guard(g_peers_locker);
+    boost::shared_ptr<TcpSockContainerT> newlinks(new TcpSockContainerT(*get_peer_links()));
+    newlinks->erase((long)sp_tcp.get());
+    boost::atomic_store(&s_peer_links, boost::shared_ptr<const TcpSockContainerT>(newlinks));
+    if(is_outbound_link(sp_tcp))
+    {
+        boost::shared_ptr<TcpSockContainerT> newoutbound(new TcpSockContainerT(*get_outbound_links()));
+        newoutbound->erase((long)sp_tcp.get());
+        boost::atomic_store(&s_outbound_links, boost::shared_ptr<const TcpSockContainerT>(newoutbound));
     }
-    else
+    s_peer_link_names.erase((long)sp_tcp.get());
+    std::set<string> changed_services;
+    PeerServerContainerT::iterator peerit = s_peer_servers.begin();
+    while(peerit != s_peer_servers.end())
     {
-        ClientHost host = unreg_req.service_host;
-        g_log.Log(lv_debug, "receive unregister request, name:%s.", service_name.c_str());
-        if(host.ip().empty())
+        if(peerit->second.link == sp_tcp)
         {
-            if(sp_tcp)
-            {
-                std::string ip;
-                unsigned short int port;
-                sp_tcp->GetDestHost(ip, port);
-                host.set_ip(ip);
-            }
-            else
+            g_log.Log(lv_warn, "the link to the peer server %s is closed, fd:%d.", peerit->first.c_str(), sp_tcp->GetFD());
+            std::map<string, ClientHostContainer>::const_iterator cit = peerit->second.services.begin();
+            while(cit != peerit->second.services.end())
             {
-                return;
+                changed_services.insert(cit->first);
+                ++cit;
             }
+            s_peer_servers.erase(peerit++);
+        }
+        else
+        {
+            ++peerit;
         }
-        unregister_client_from_service(service_name, host);
+    }
+    std::set<string>::const_iterator nameit = changed_services.begin();
+    while(nameit != changed_services.end())
+    {
+        publish_remote_service(*nameit);
+        ++nameit;
     }
 }
 
-void process_sendmsg_req(TcpSockSmartPtr sp_tcp, const MsgBusPackHead& head, boost::shared_array<char> bodybuffer, uint32_t body_len)
+void onSyncServerData(TcpSockSmartPtr sp_tcp, const MsgBusPackHead& head, PBSyncServerData* syncdata)
 {
-    MsgBusSendMsgReq req;
-    //assert(body_len - sizeof(req.msg_id) - sizeof(req.msg_len) - MAX_SERVICE_NAME*2);
-    req.UnPackBody(bodybuffer.get(), body_len);
-    string dest_name(req.dest_name);
-    //g_log.Log(lv_debug, "server relay sendmsg from client:%s, content:%s. dest:%s", 
-    //    string(req.from_name).c_str(), req.GetMsgContent(), dest_name.c_str());
-    // support the prefix matching of client_name , so we can send messages to group of clients.
-    bool is_exist = false;
+    if(!s_federation_enabled || syncdata->server_name() == s_server_name)
+        return;
+    // the sync on the link connected by the peer is only the hello, the link becomes a peer link
+    // and gets the syncs of this server if the peer is listed.
+    if(!is_outbound_link(sp_tcp))
     {
-        core::common::locker_guard guard(g_activeclients_locker);
-        ActiveClientTcpContainer::const_iterator cit = active_clients.begin();
-        while(cit != active_clients.end())
+        if(is_peer_link(sp_tcp))
+            return;
+        std::string ip;
+        unsigned short int port;
+        sp_tcp->GetDestHost(ip, port);
+        if(s_peer_ips.find(ip) == s_peer_ips.end())
+        {
+            g_log.Log(lv_warn, "refuse the link of %s from %s:%d not listed as a peer, fd:%d.",
+                syncdata->server_name().c_str(), ip.c_str(), port, sp_tcp->GetFD());
+            return;
+        }
+        if(add_peer_link(sp_tcp, false))
         {
-            if(is_prefix_matching(cit->first, dest_name))
             {
-                if(cit->second.size() > 0)
-                {
-                    is_exist = true;
-                    break;
-                }
+                core::common::locker_guard guard(g_peers_locker);
+                s_peer_link_names[(long)sp_tcp.get()] = syncdata->server_name();
             }
-            ++cit;
+            g_log.Log(lv_warn, "the peer server %s linked, fd:%d.", syncdata->server_name().c_str(), sp_tcp->GetFD());
+            federation_full_sync(sp_tcp);
         }
+        return;
     }
-    MsgBusSendMsgRsp rsp;
-    rsp.msg_id = head.msg_id;
-    rsp.ret_code = 0;
-    rsp.err_msg_len = 2;
+    core::common::locker_guard guard(g_peers_locker);
+    PeerServer& peer = s_peer_servers[syncdata->server_name()];
+    std::set<string> changed_services;
+    std::map<string, ClientHostContainer>::iterator it = peer.services.begin();
+    while(it != peer.services.end())
+    {
+        // all the routes to the peer are changed to the new link.
+        if(syncdata->full_sync() || peer.link != sp_tcp)
+            changed_services.insert(it->first);
+        ++it;
+    }
+    peer.link = sp_tcp;
+    s_peer_link_names[(long)sp_tcp.get()] = syncdata->server_name();
+    if(syncdata->full_sync())
+        peer.services.clear();
+    for(int i = 0; i < syncdata->service_info_size(); ++i)
+    {
+        const PBServiceClients& service_info = syncdata->service_info(i);
+        ClientHostContainer hosts;
+        for(int j = 0; j < service_info.client_info_size(); ++j)
+        {
+            const PBClientInfo& client_info = service_info.client_info(j);
+            uint32_t ip = client_info.client_ip();
+            char ipstr[INET_ADDRSTRLEN] = {0};
+            inet_ntop(AF_INET, &ip, ipstr, sizeof(ipstr));
+            ClientHost host(ipstr, client_info.client_port());
+            host.set_state((kServerBusyState)client_info.client_state());
+            hosts.push_back(host);
+        }
+        if(hosts.empty())
+            peer.services.erase(service_info.service_name());
+        else
+            peer.services[service_info.service_name()] = hosts;
+        changed_services.insert(service_info.service_name());
+    }
+    std::set<string>::const_iterator nameit = changed_services.begin();
+    while(nameit != changed_services.end())
+    {
+        publish_remote_service(*nameit);
+        ++nameit;
+    }
+}
 
-    std::string errmsg;
-    if(is_exist)
+// fill the receivers of the service which GETCLIENT selects from, the local ones first.
+void fill_service_receivers(const std::string& service_name, PBServiceClients& service_info)
+{
+    service_info.set_service_name(service_name);
+    AvailableServiceIndexT::ValuePtr entry = get_available_index()->Find(service_name);
+    if(entry)
+    {
+        for(size_t i = 0; i < entry->hosts.size(); ++i)
+            fill_client_info(entry->hosts[i], *service_info.add_client_info());
+        return;
+    }
+    RemoteServiceIndexT::ValuePtr remote_entry = get_remote_index()->Find(service_name);
+    if(remote_entry)
     {
-        // forward the data to other client.
-        boost::shared_array<char> outbuffer(new char[req.Size()]);
-        req.PackData(outbuffer.get());
+        for(size_t i = 0; i < remote_entry->available.hosts.size(); ++i)
+            fill_client_info(remote_entry->available.hosts[i], *service_info.add_client_info());
+    }
+}
 
-        // 转发数据
-        if(dest_name == "")
+// push the current receivers of the changed service to the subscribers of it, the changes of
+// the same service may be pushed more than once, and the latest one wins.
+void notify_service_subscribers(const std::string& service_name)
+{
+    core::common::locker_guard guard(g_subscribers_locker);
+    if(s_service_subscribers.empty())
+        return;
+    SharedFrame frame;
+    ServiceSubscriberContainerT::const_iterator cit = s_service_subscribers.begin();
+    while(cit != s_service_subscribers.end())
+    {
+        std::set<string>::const_iterator prefixit = cit->second.prefixes.begin();
+        while(prefixit != cit->second.prefixes.end())
         {
-            BroadcastTask btask;
-            btask.data_len = req.Size();
-            btask.data = outbuffer;
-            msgbus_queue_broadcast(btask);
+            if(service_name.compare(0, prefixit->size(), *prefixit) == 0)
+                break;
+            ++prefixit;
         }
-        else
+        if(prefixit != cit->second.prefixes.end())
         {
-            ReqTask ctask;
-            ctask.client_name = dest_name;
-            ctask.data_len = req.Size();
-            ctask.data = outbuffer;
-            msgbus_queue_reqtoclient(ctask);
+            if(frame.empty())
+            {
+                PBServiceChangeNotify notify;
+                fill_service_receivers(service_name, *notify.add_service_info());
+                frame = pack_pbbody_frame(notify, 0);
+            }
+            server_send_frame(cit->second.tcp, frame);
         }
+        ++cit;
+    }
+}
 
+// collect the receivers of the services for the new subscriber.
+struct SubscribeSnapshotVisitor
+{
+    SubscribeSnapshotVisitor(PBServiceChangeNotify& notify)
+        :notify_(notify)
+    {
     }
-    else
+    bool operator()(const AvailableServiceIndexT::ValuePtr& entry)
     {
-        rsp.ret_code = 1;
-        errmsg = "dest client not found.";
-        rsp.err_msg_len = errmsg.size() + 1;
+        AddService(entry->service_name);
+        return true;
     }
+    bool operator()(const RemoteServiceIndexT::ValuePtr& entry)
+    {
+        if(!entry->available.hosts.empty())
+            AddService(entry->service_name);
+        return true;
+    }
+    void AddService(const std::string& service_name)
+    {
+        if(service_names_.insert(service_name).second)
+            fill_service_receivers(service_name, *notify_.add_service_info());
+    }
+    PBServiceChangeNotify& notify_;
+    std::set<string> service_names_;
+};
 
-    // until I know, all implementation of std::string's storage is contiguous. 
-    errmsg.push_back('\0');
-    rsp.err_msg_len = errmsg.size();
-    rsp.SetVarData( &errmsg[0] );
-
-    boost::shared_array<char> rspbuffer(new char[rsp.Size()]);
-    rsp.PackData(rspbuffer.get());
-    if(sp_tcp)
-        sp_tcp->SendData(rspbuffer.get(), rsp.Size());
+void onSubscribeServicesReq(TcpSockSmartPtr sp_tcp, const MsgBusPackHead& head, PBSubscribeServicesReq* req)
+{
+    const std::string& prefix = req->match_prefix();
+    g_log.Log(lv_debug, "receive %s services request, prefix:%s, fd:%d.", req->unsubscribe() ? "unsubscribe" : "subscribe",
+        prefix.c_str(), sp_tcp->GetFD());
+    PBServiceChangeNotify notify;
+    // the snapshot is responded with the lock held, so no older change is pushed after it.
+    core::common::locker_guard guard(g_subscribers_locker);
+    if(req->unsubscribe())
+    {
+        ServiceSubscriberContainerT::iterator it = s_service_subscribers.find((long)sp_tcp.get());
+        if(it != s_service_subscribers.end())
+        {
+            it->second.prefixes.erase(prefix);
+            if(it->second.prefixes.empty())
+                s_service_subscribers.erase(it);
+        }
+    }
+    else
+    {
+        ServiceSubscriber& subscriber = s_service_subscribers[(long)sp_tcp.get()];
+        subscriber.tcp = sp_tcp;
+        subscriber.prefixes.insert(prefix);
+        SubscribeSnapshotVisitor snapshot_visitor(notify);
+        get_available_index()->VisitWithPrefix(prefix, snapshot_visitor);
+        get_remote_index()->VisitWithPrefix(prefix, snapshot_visitor);
+    }
+    server_send_frame(sp_tcp, pack_pbbody_frame(notify, head.msg_id));
 }
 
-void process_getclient_req(TcpSockSmartPtr sp_tcp, const MsgBusPackHead& head, boost::shared_array<char> bodybuffer, uint32_t body_len)
+void onGetClientsReq(TcpSockSmartPtr sp_tcp, const MsgBusPackHead& head, PBGetClientsReq* req)
 {
-    MsgBusGetClientReq req;
-    req.UnPackBody(bodybuffer.get());
-    string dest_name(req.dest_name);
-    //g_log.Log(lv_debug, "receive get client info request, client name:%s.", dest_name.c_str());
-
-    MsgBusGetClientRsp rsp;
-    rsp.msg_id = head.msg_id;
-    strncpy(rsp.dest_name, req.dest_name, MAX_SERVICE_NAME);
-    //g_log.Log(lv_debug, "rsp client name:%s.", rsp.dest_name);
+    g_log.Log(lv_debug, "receive get clients request, %d services, fd:%d.", req->service_name_size(), sp_tcp->GetFD());
+    PBServiceChangeNotify rsp;
+    for(int i = 0; i < req->service_name_size(); ++i)
+        fill_service_receivers(req->service_name(i), *rsp.add_service_info());
+    server_send_frame(sp_tcp, pack_pbbody_frame(rsp, head.msg_id));
+}
 
-    ClientHostContainer::value_type host;
-    core::common::locker_guard guard(g_activeclients_locker);
-    ServiceContainer::const_iterator cit = available_services.find(dest_name);
-    if(cit != available_services.end() && msgbus_select_best_client(cit->second, host))
+void onRegisterServicesReq(TcpSockSmartPtr sp_tcp, const MsgBusPackHead& head, PBRegisterServicesReq* req)
+{
+    ClientHost host;
+    if(req->client_info().client_ip() != 0)
     {
-        rsp.ret_code = 0;
-        rsp.dest_host = host;
+        uint32_t ip = req->client_info().client_ip();
+        char ipstr[INET_ADDRSTRLEN] = {0};
+        inet_ntop(AF_INET, &ip, ipstr, sizeof(ipstr));
+        host.set_ip(ipstr);
     }
-    else
+    host.set_port(req->client_info().client_port());
+    host.set_state((kServerBusyState)req->client_info().client_state());
+    PBRegisterServicesRsp rsp;
+    for(int i = 0; i < req->service_name_size(); ++i)
     {
-        rsp.ret_code = 1;
+        std::string errmsg;
+        if(!register_client_service(sp_tcp, req->service_name(i), host, errmsg))
+        {
+            *rsp.add_failed_service_name() = req->service_name(i);
+            *rsp.add_err_msg() = errmsg;
+        }
     }
-    boost::shared_array<char> outbuffer( new char[rsp.Size()] );
-    rsp.PackData(outbuffer.get());
-    if(sp_tcp)
-        sp_tcp->SendData(outbuffer.get(), rsp.Size());
+    server_send_frame(sp_tcp, pack_pbbody_frame(rsp, head.msg_id));
 }
 
-void process_pbbody_data(TcpSockSmartPtr sp_tcp, const MsgBusPackHead& head, boost::shared_array<char> bodybuffer, uint32_t body_len)
+void onAdvertiseMessagesReq(TcpSockSmartPtr sp_tcp, const MsgBusPackHead& head, PBAdvertiseMessagesReq* req)
 {
-    MsgBusPackPBType pbbody;
+    boost::shared_ptr<ClientTcpCodec> tcpcodec = get_tcp_codec(sp_tcp);
+    if(!tcpcodec)
+        return;
+    boost::shared_ptr<MessageInterest> interest(new MessageInterest());
+    interest->msgids.insert(req->message_name().begin(), req->message_name().end());
+    interest->msgid_prefixes.assign(req->message_prefix().begin(), req->message_prefix().end());
+    g_log.Log(lv_debug, "client fd:%d advertised %d messages and %d prefixes.", sp_tcp->GetFD(),
+        req->message_name_size(), req->message_prefix_size());
+    boost::atomic_store(&tcpcodec->interest, boost::shared_ptr<const MessageInterest>(interest));
+}
 
-    pbbody.UnPackBody(bodybuffer.get(), body_len);
-    string pbtype(pbbody.GetPBType());
-    string pbdata(pbbody.GetPBData(), pbbody.pbdata_len);
-    PBHandlerContainerT::const_iterator cit = s_pb_handlers.find(pbtype);
-    if(cit != s_pb_handlers.end())
+// list the messages advertised by the replicas of the service, the prefixes end with '*'.
+void onQueryMessagesReq(TcpSockSmartPtr sp_tcp, const MsgBusPackHead& head, PBQueryMessagesReq* req)
+{
+    const std::string& match_prefix = req->match_prefix();
+    std::set<string> names;
+    ActiveServiceIndexT::ValuePtr entry = get_active_index()->Find(req->service_name());
+    for(size_t i = 0; entry && i < entry->replicas.size(); ++i)
     {
-        cit->second->onPbData(sp_tcp, head, pbtype, pbdata);
+        if(!entry->replicas[i].conn)
+            continue;
+        boost::shared_ptr<const MessageInterest> interest = boost::atomic_load(&entry->replicas[i].conn->interest);
+        if(!interest)
+            continue;
+        std::set<string>::const_iterator cit = interest->msgids.lower_bound(match_prefix);
+        while(cit != interest->msgids.end() && cit->compare(0, match_prefix.size(), match_prefix) == 0)
+        {
+            names.insert(*cit);
+            ++cit;
+        }
+        for(size_t j = 0; j < interest->msgid_prefixes.size(); ++j)
+        {
+            if(interest->msgid_prefixes[j].compare(0, match_prefix.size(), match_prefix) == 0)
+                names.insert(interest->msgid_prefixes[j] + "*");
+        }
     }
-    else
+    PBQueryMessagesRsp rsp;
+    rsp.set_service_name(req->service_name());
+    std::set<string>::const_iterator nameit = names.begin();
+    while(nameit != names.end())
     {
-        g_log.Log(lv_warn, "unknown pbtype:%s of protocol buffer data.", pbtype.c_str());
+        *rsp.add_message_name() = *nameit;
+        ++nameit;
     }
+    server_send_frame(sp_tcp, pack_pbbody_frame(rsp, head.msg_id));
 }
 
-void onQueryServicesReq(TcpSockSmartPtr sp_tcp, const MsgBusPackHead& head, PBQueryServicesReq* req)
+// called in the inner loop of the peer link when the connect to the peer is finished.
+void federation_onConnect(TcpSockSmartPtr link, bool connected)
 {
-    std::string prefix = req->match_prefix();
-    g_log.Log(lv_debug, "receive query service requst, prefix:%s", prefix.c_str());
-    PBQueryServicesRsp rsp;
+    std::string ip;
+    unsigned short int port;
+    link->GetDestHost(ip, port);
+    if(!connected)
     {
-        core::common::locker_guard guard(g_activeclients_locker);
-        ServiceContainer::const_iterator cit = available_services.begin();
-        while(cit != available_services.end())
+        g_log.Log(lv_debug, "connect to the peer server %s:%d failed.", ip.c_str(), port);
+        // the failed link is closed without onClose, it is connected again in the next round.
+        core::common::locker_guard guard(g_tcpcodecs_locker);
+        tcp_codecs.erase((long)link.get());
+        return;
+    }
+    link->SetTimeout(KEEP_ALIVE_TIME);
+    add_peer_link(link, true);
+    g_log.Log(lv_warn, "connected to the peer server %s:%d, fd:%d.", ip.c_str(), port, link->GetFD());
+    federation_hello(link);
+}
+
+// connect to the peer servers and keep the links, and send the full sync periodically to repair
+// the lost deltas and the hello to keep the links alive. the peers are connected asynchronously, so a dead
+// peer does not hold up the others.
+void* msgbus_federation_thread( void* param )
+{
+    SockHandler tcpcb = get_client_sockhandler();
+    tcpcb.onConnect = boost::bind(federation_onConnect, _1, _2);
+    int fullsync_wait = 0;
+    while(!s_netmsgbus_server_terminate)
+    {
+        for(size_t i = 0; i < s_peer_addrs.size(); ++i)
         {
-            if(cit->first.find(prefix) != std::string::npos)
+            PeerAddr& peer = s_peer_addrs[i];
+            // the link still connecting is not closed, it is closed if the connect failed.
+            if(peer.link && !peer.link->IsClosed())
+                continue;
+            peer.link.reset();
+            TcpSockSmartPtr link(new TcpSock());
+            if(!link->AsyncConnect(peer.ip, peer.port, TIMEOUT_SHORT*1000))
             {
-                std::string *name = rsp.add_service_name();
-                *name = cit->first;
+                g_log.Log(lv_debug, "connect to the peer server %s:%d failed.", peer.ip.c_str(), peer.port);
+                continue;
             }
-            ++cit;
-        } 
+            // the peer link is served as a client, the frames from it are processed in the same way.
+            setup_client_tcp(link, tcpcb);
+            if(!EventLoopPool::AddTcpSockToInnerLoop(link))
+            {
+                link->Close();
+                core::common::locker_guard guard(g_tcpcodecs_locker);
+                tcp_codecs.erase((long)link.get());
+                continue;
+            }
+            peer.link = link;
+        }
+        fullsync_wait += FEDERATION_CHECK_SEC;
+        if(fullsync_wait >= FEDERATION_FULLSYNC_SEC)
+        {
+            fullsync_wait = 0;
+            boost::shared_ptr<const TcpSockContainerT> links = get_peer_links();
+            TcpSockContainerT::const_iterator cit = links->begin();
+            while(cit != links->end())
+            {
+                if(is_outbound_link(cit->second))
+                    federation_hello(cit->second);
+                else
+                    federation_full_sync(cit->second);
+                ++cit;
+            }
+        }
+        sleep(FEDERATION_CHECK_SEC);
     }
-    MsgBusPackPBType packpb;
-    packpb.msg_id = head.msg_id;
-    std::string pbtype = PBQueryServicesRsp::descriptor()->full_name();
-    pbtype.push_back('\0');
-    packpb.pbtype_len = pbtype.size();
-    // until I know, all implementation of std::string's storage is contiguous. 
-    int size = rsp.ByteSize();
-    boost::shared_array<char> pbdata(new char[size]);
-    rsp.SerializeToArray(pbdata.get(), size);
-    g_log.Log(lv_debug, "msgid:%u, rsp query services : %s", head.msg_id, std::string(pbdata.get(), size).c_str());
-    packpb.pbdata_len = size; 
-    packpb.SetVarData(&pbtype[0], pbdata.get());
+    return 0;
+}
 
-    boost::shared_array<char> outbuffer( new char[packpb.Size()] );
-    packpb.PackData(outbuffer.get(), packpb.Size());
-    if(sp_tcp)
-        sp_tcp->SendData(outbuffer.get(), packpb.Size());
+// sum the queued bytes of the clients, each client is counted once for all its services.
+struct QueuedBytesVisitor
+{
+    QueuedBytesVisitor()
+        :total(0)
+    {
+    }
+    bool operator()(const ActiveServiceIndexT::ValuePtr& entry)
+    {
+        for(size_t i = 0; i < entry->replicas.size(); ++i)
+        {
+            if(counted.insert((long)entry->replicas[i].tcp.get()).second)
+                total += entry->replicas[i].tcp->GetQueuedBytes();
+        }
+        return true;
+    }
+    std::set<long> counted;
+    size_t total;
+};
+
+// sample the queued bytes of all the clients for the server cap.
+void* msgbus_outbound_check_thread( void* param )
+{
+    while(!s_netmsgbus_server_terminate)
+    {
+        QueuedBytesVisitor visitor;
+        get_active_index()->VisitWithPrefix("", visitor);
+        if(visitor.total >= s_server_cap_bytes && s_total_queued_bytes < s_server_cap_bytes)
+            g_log.Log(lv_warn, "the queued bytes of all the clients reached the cap, queued:%zu.", visitor.total);
+        s_total_queued_bytes = visitor.total;
+        usleep(SLOW_CONSUMER_CHECK_US);
+    }
+    return 0;
+}
+
+// copy the relayed frame with the dest name replaced.
+SharedFrame copy_relay_frame(const ReqTask& reqtask, const std::string& dest_name)
+{
+    boost::shared_array<char> data(new char[reqtask.data_len]);
+    memcpy(data.get(), reqtask.data.get(), reqtask.data_len);
+    char* dest = data.get() + MsgBusPackHead().Size();
+    memset(dest, 0, MAX_SERVICE_NAME);
+    memcpy(dest, dest_name.data(), std::min<size_t>(dest_name.size(), MAX_SERVICE_NAME));
+    return SharedFrame(data, reqtask.data_len);
 }
 
-// 发送请求或广播数据到其他客户端的处理线程
+// 发送请求或广播数据到其他客户端的处理线程, 每个relay shard一个
 void* msgbus_process_thread( void* param )
 {
+    RelayShard& shard = *(RelayShard*)param;
     while(true)
     {
         std::deque< ReqTask > running_reqtask_list;
@@ -841,25 +2259,24 @@ void* msgbus_process_thread( void* param )
         bool hasreqtask = false;
         bool hasbroadtask = false;
         {
-            core::common::locker_guard guard(g_reqtask_locker);
-            while(reqtoclient_task_container.empty() && broadcast_task_container.empty())
+            core::common::locker_guard guard(shard.reqtask_locker);
+            while(shard.reqtoclient_task_container.empty() && shard.broadcast_task_container.empty())
             {
                 if( s_netmsgbus_server_terminate )
                     return 0;
-                g_reqtask_cond.wait(g_reqtask_locker);
+                shard.reqtask_cond.wait(shard.reqtask_locker);
             }
             if( s_netmsgbus_server_terminate )
                 return 0;
             
-            if(!reqtoclient_task_container.empty())
+            if(!shard.reqtoclient_task_container.empty())
             {
-                running_reqtask_list.swap( reqtoclient_task_container );
-                //reqtoclient_task_container.pop_front();
+                running_reqtask_list.swap( shard.reqtoclient_task_container );
                 hasreqtask = true;
             }
-            if(!broadcast_task_container.empty())
+            if(!shard.broadcast_task_container.empty())
             {
-                running_broadcast_task_list.swap( broadcast_task_container );
+                running_broadcast_task_list.swap( shard.broadcast_task_container );
                 hasbroadtask = true;
             }
         }
@@ -868,31 +2285,55 @@ void* msgbus_process_thread( void* param )
             while(!running_reqtask_list.empty())
             {
                 ReqTask& reqtask = running_reqtask_list.front();
-                TcpSockContainerT destclients;
+                SelectBestClientVisitor select_visitor;
+                if(reqtask.from_peer)
+                {
+                    // the peer has resolved the prefix and forwards to the exact service.
+                    ActiveServiceIndexT::ValuePtr entry = get_active_index()->Find(reqtask.client_name);
+                    if(entry)
+                        select_visitor(entry);
+                }
+                else
                 {
-                    core::common::locker_guard guard(g_activeclients_locker);
-                    ActiveClientTcpContainer::const_iterator cit = active_clients.begin();
-                    while(cit != active_clients.end())
+                    get_active_index()->VisitPrefixMatching(reqtask.client_name, select_visitor);
+                }
+                std::map<long, ActiveReplica>& destclients = select_visitor.destclients;
+                // the frame is queued to the v1 dest tcps without copy, and encoded once for all
+                // the v2 dests if any.
+                SharedFrame reqframe(reqtask.data, reqtask.data_len);
+                SharedWireFrames reqframes;
+                reqframes.frame = reqframe;
+                std::map<long, ActiveReplica>::iterator destit = destclients.begin();
+                while(destit != destclients.end())
+                {
+                    const boost::shared_ptr<ClientTcpCodec>& tcpcodec = destit->second.conn;
+                    if(tcpcodec && tcpcodec->codec->IsCompactEnabled())
                     {
-                        if(is_prefix_matching(cit->first, reqtask.client_name))
-                        {
-                            //g_log.Log(lv_debug, "matching name %s vs %s", cit->first.c_str(), reqtask.client_name.c_str());
-                            TcpSockSmartPtr destclient;
-                            if(msgbus_select_best_client(cit->second, destclient))
-                            {
-                                destclients[(long)destclient.get()] = destclient;
-                            }
-                        }
-                        ++cit;
+                        encode_shared_frames(reqframes);
+                        break;
                     }
+                    ++destit;
                 }
-                TcpSockContainerT::iterator destit = destclients.begin();
+                destit = destclients.begin();
                 while(destit != destclients.end())
                 {
-                    if(destit->second)
-                        destit->second->SendData(reqtask.data.get(), reqtask.data_len);
+                    server_send_relay(destit->second, reqframes);
                     ++destit;
                 }
+                if(s_federation_enabled && !reqtask.from_peer)
+                {
+                    SelectRemoteRouteVisitor route_visitor;
+                    get_remote_index()->VisitPrefixMatching(reqtask.client_name, route_visitor);
+                    std::map<std::string, TcpSockSmartPtr>::const_iterator routeit = route_visitor.destroutes.begin();
+                    while(routeit != route_visitor.destroutes.end())
+                    {
+                        if(routeit->first == reqtask.client_name)
+                            server_send_frame(routeit->second, reqframe);
+                        else
+                            server_send_frame(routeit->second, copy_relay_frame(reqtask, routeit->first));
+                        ++routeit;
+                    }
+                }
                 running_reqtask_list.pop_front();
             }
         }
@@ -900,35 +2341,9 @@ void* msgbus_process_thread( void* param )
         {
             while(!running_broadcast_task_list.empty())
             {
-                BroadcastTask& broadcast_task = running_broadcast_task_list.front();
-                ActiveClientTcpContainer allclients;
-                {
-                    core::common::locker_guard guard(g_activeclients_locker);
-                    ActiveClientTcpContainer::const_iterator cit = active_clients.begin();
-                    while(cit != active_clients.end())
-                    {
-                        //TcpSockSmartPtr destclient;
-                        TcpSockSmartPtr destclient;
-                        if(msgbus_select_best_client(cit->second, destclient))
-                        {
-                            allclients[cit->first][(long)destclient.get()] = destclient;
-                        }
-                        ++cit;
-                    }
-                }
-                ActiveClientTcpContainer::iterator allit = allclients.begin();
-                while( allit != allclients.end() )
-                {
-                    TcpSockContainerT::iterator destit = allit->second.begin();
-                    while(destit != allit->second.end())
-                        //for(size_t i = 0;i < allcit->second.size(); ++i)
-                    {
-                        if( destit->second )
-                            destit->second->SendData(broadcast_task.data.get(), broadcast_task.data_len);
-                        ++destit;
-                    }
-                    ++allit;
-                }
+                // the current index is an immutable snapshot, visiting it needs no lock and no copy.
+                BroadcastVisitor broadcast_visitor(running_broadcast_task_list.front());
+                get_active_index()->VisitWithPrefix("", broadcast_visitor);
                 running_broadcast_task_list.pop_front();
             }
         }
@@ -956,26 +2371,144 @@ int main(int argc, char* argv[])
     {
         s_server_port = MSGBUS_SERVER_DEFAULT_PORT;
     }
+    // the listen backlog of each loop.
+    if(argc > 2)
+    {
+        s_server_backlog = strtol(argv[2], NULL, 10);
+        if(s_server_backlog <= 0)
+            s_server_backlog = MSGBUS_SERVER_DEFAULT_BACKLOG;
+    }
+    // compress the relayed messages and responses not less than this bytes, the compression
+    // runs in the relay shards which relay the messages.
+    if(argc > 3)
+    {
+        long compress_min_bytes = strtol(argv[3], NULL, 10);
+        s_compress_min_bytes = compress_min_bytes > 0 ? (uint32_t)compress_min_bytes : 0;
+    }
+    // the number of the relay shards forwarding the messages, default one for each cpu.
+    long relay_shard_num = 0;
+    if(argc > 4)
+        relay_shard_num = strtol(argv[4], NULL, 10);
+    if(relay_shard_num <= 0)
+    {
+        relay_shard_num = sysconf(_SC_NPROCESSORS_ONLN);
+        if(relay_shard_num <= 0)
+            relay_shard_num = 1;
+    }
+    // the load balance policy to select the replica of a service: p2c(default), rr, least, random.
+    kLoadBalancePolicy lb_policy = LB_POWER_OF_TWO;
+    if(argc > 5 && !LoadBalancer::ParsePolicy(argv[5], lb_policy))
+        printf("unknown load balance policy %s, use p2c.\n", argv[5]);
+    s_load_balancer = LoadBalancer::Create(lb_policy);
+    // the name of this server in the federation and the peer servers as ip[:port][,ip[:port]...],
+    // the federation is enabled by the name. this server gets the services of the peers listed with
+    // the port only, the peer listed without the port links to this server to get the services.
+    if(argc > 6 && argv[6][0] != '\0')
+    {
+        s_server_name = argv[6];
+        s_federation_enabled = true;
+    }
+    if(s_federation_enabled && argc > 7)
+    {
+        std::string peers(argv[7]);
+        size_t pos = 0;
+        while(pos < peers.size())
+        {
+            size_t end = peers.find(',', pos);
+            if(end == std::string::npos)
+                end = peers.size();
+            std::string peer = peers.substr(pos, end - pos);
+            size_t colon = peer.rfind(':');
+            PeerAddr addr;
+            addr.port = colon == std::string::npos ? 0 : strtol(peer.c_str() + colon + 1, NULL, 10);
+            if(colon == std::string::npos)
+            {
+                if(!peer.empty())
+                    s_peer_ips.insert(peer);
+            }
+            else if(addr.port == 0)
+            {
+                printf("invalid peer server %s, should be ip[:port].\n", peer.c_str());
+            }
+            else
+            {
+                addr.ip = peer.substr(0, colon);
+                s_peer_addrs.push_back(addr);
+                s_peer_ips.insert(addr.ip);
+            }
+            pos = end + 1;
+        }
+    }
+    // the outbound budget of each client in bytes, the policy for the slow clients: drop(default),
+    // conflate, disconnect, and the cap of the queued bytes of all the clients. 0 for no limit.
+    if(argc > 8)
+        s_client_budget_bytes = (size_t)strtoull(argv[8], NULL, 10);
+    if(argc > 9)
+    {
+        std::string policy(argv[9]);
+        if(policy == "drop")
+            s_slow_policy = SLOW_DROP;
+        else if(policy == "conflate")
+            s_slow_policy = SLOW_CONFLATE;
+        else if(policy == "disconnect")
+            s_slow_policy = SLOW_DISCONNECT;
+        else
+            printf("unknown slow consumer policy %s, use drop.\n", argv[9]);
+    }
+    if(argc > 10)
+        s_server_cap_bytes = (size_t)strtoull(argv[10], NULL, 10);
     threadpool::init_thread_pool();
     // message bus server will offer two tcp connection, one for the register of a service, 
     // another for communicating with other msgbus server.
     pthread_t register_thread;
-    pthread_t process_thread;
     SimpleLogger::Instance().Init(utility::GetModulePath() + "/msgbus_server_log.log", lv_debug);
 
-    EventLoopPool::InitEventLoopPool(100);
+    // one inner loop for each cpu, and each loop accepts its own clients.
+    EventLoopPool::InitEventLoopPool();
     // register all protocol buffer data handler.
     regist_pbdata_handler<NetMsgBus::PBQueryServicesReq>(onQueryServicesReq);
+    // the peer servers are known by their first sync.
+    regist_pbdata_handler<NetMsgBus::PBSyncServerData>(onSyncServerData, false);
+    regist_pbdata_handler<NetMsgBus::PBSubscribeServicesReq>(onSubscribeServicesReq);
+    regist_pbdata_handler<NetMsgBus::PBAdvertiseMessagesReq>(onAdvertiseMessagesReq);
+    regist_pbdata_handler<NetMsgBus::PBQueryMessagesReq>(onQueryMessagesReq);
+    regist_pbdata_handler<NetMsgBus::PBGetClientsReq>(onGetClientsReq);
+    regist_pbdata_handler<NetMsgBus::PBRegisterServicesReq>(onRegisterServicesReq, false);
 
     s_netmsgbus_server_terminate = false;
+    // the relay shards must be ready before any message is received.
+    boost::shared_ptr<RelayShardContainerT> relay_shards(new RelayShardContainerT());
+    for(long i = 0; i < relay_shard_num; ++i)
+    {
+        boost::shared_ptr<RelayShard> shard(new RelayShard());
+        shard->shard_index = relay_shards->size();
+        relay_shards->push_back(shard);
+    }
+    s_relay_shards = relay_shards;
+    for(size_t i = 0; i < s_relay_shards->size(); ++i)
+    {
+        RelayShard& shard = *(*s_relay_shards)[i];
+        if (0 != pthread_create(&shard.process_thread, NULL, msgbus_process_thread, &shard))
+        {
+            g_log.Log(lv_error, "msgbus_process_thread create failed!" );
+            return -1;
+        }
+    }
     if (0 != pthread_create(&register_thread, NULL, msgbus_server_accept_thread,NULL))
     {
         g_log.Log(lv_error, "msgbus_register_thread create failed!" );
         return -1;
     }
-    if (0 != pthread_create(&process_thread, NULL, msgbus_process_thread,NULL))
+    pthread_t federation_thread;
+    if (s_federation_enabled && 0 != pthread_create(&federation_thread, NULL, msgbus_federation_thread, NULL))
+    {
+        g_log.Log(lv_error, "msgbus_federation_thread create failed!" );
+        return -1;
+    }
+    pthread_t outbound_check_thread;
+    if (s_server_cap_bytes > 0 && 0 != pthread_create(&outbound_check_thread, NULL, msgbus_outbound_check_thread, NULL))
     {
-        g_log.Log(lv_error, "msgbus_process_thread create failed!" );
+        g_log.Log(lv_error, "msgbus_outbound_check_thread create failed!" );
         return -1;
     }
 
@@ -984,12 +2517,19 @@ int main(int argc, char* argv[])
         sleep(1);
     }
 
+    for(size_t i = 0; i < s_relay_shards->size(); ++i)
     {
-        core::common::locker_guard guard(g_reqtask_locker);
-        g_reqtask_cond.notify_all();
+        RelayShard& shard = *(*s_relay_shards)[i];
+        core::common::locker_guard guard(shard.reqtask_locker);
+        shard.reqtask_cond.notify_all();
     }
     pthread_join(register_thread, NULL);
-    pthread_join(process_thread, NULL);
+    for(size_t i = 0; i < s_relay_shards->size(); ++i)
+        pthread_join((*s_relay_shards)[i]->process_thread, NULL);
+    if(s_federation_enabled)
+        pthread_join(federation_thread, NULL);
+    if(s_server_cap_bytes > 0)
+        pthread_join(outbound_check_thread, NULL);
 
     EventLoopPool::DestroyEventLoopPool();
     g_log.Log(lv_debug, "msgbus server is down!");
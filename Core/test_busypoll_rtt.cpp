@@ -0,0 +1,168 @@
+// 比较阻塞事件循环和忙轮询事件循环下tcp往返延迟
+// usage: test_busypoll_rtt [msg_num] [msg_size] [spin_us] [sock_busy_poll_us] [port]
+// 客户端线程通过client loop发送消息, server loop收到后原样返回, 客户端线程等待返回后再发送下一个.
+// 先使用阻塞的事件循环测试, 然后打开两个事件循环的忙轮询再测试一次.
+// 忙轮询需要每个事件循环和发送线程各自独占一个cpu, cpu不足时自旋会抢占其它线程, 延迟反而变大.
+#include "threadpool.h"
+#include "EventLoopPool.h"
+#include "EventLoop.h"
+#include "TcpSock.h"
+#include "SimpleLogger.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <sched.h>
+#include <algorithm>
+#include <vector>
+#include <boost/bind.hpp>
+
+using namespace core;
+using namespace core::net;
+
+#define TEST_SERVER_LOOP "test_rtt_server"
+#define TEST_CLIENT_LOOP "test_rtt_client"
+
+static int64_t now_ns()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec*1000000000LL + ts.tv_nsec;
+}
+
+static size_t s_msg_size = 64;
+static volatile long s_echoed_num = 0;
+static volatile int s_connected = 0;
+
+static size_t onServerRead(TcpSockSmartPtr sp_tcp, const char* pdata, size_t size)
+{
+    // echo back all the data.
+    sp_tcp->SendData(pdata, size);
+    return size;
+}
+
+static bool onServerAccept(TcpSockSmartPtr sp_tcp)
+{
+    SockHandler cb;
+    cb.onRead = onServerRead;
+    sp_tcp->SetSockHandler(cb);
+    return true;
+}
+
+static size_t onClientRead(TcpSockSmartPtr sp_tcp, const char* pdata, size_t size)
+{
+    size_t msgnum = size/s_msg_size;
+    if(msgnum > 0)
+        __sync_fetch_and_add(&s_echoed_num, (long)msgnum);
+    return msgnum*s_msg_size;
+}
+
+static void onClientConnect(TcpSockSmartPtr sp_tcp, bool connected)
+{
+    s_connected = connected ? 1 : -1;
+}
+
+static void printResult(const char* name, std::vector<int64_t>& result)
+{
+    if(result.empty())
+        return;
+    std::sort(result.begin(), result.end());
+    size_t n = result.size();
+    printf("%-10s msgs:%8zu  p50:%8.1fus  p90:%8.1fus  p99:%8.1fus  p999:%8.1fus  max:%8.1fus\n",
+        name, n, result[n/2]/1000.0, result[n*9/10]/1000.0, result[n*99/100]/1000.0,
+        result[n*999/1000]/1000.0, result[n - 1]/1000.0);
+}
+
+static bool testRtt(const char* name, unsigned short port, int msg_num)
+{
+    TcpSockSmartPtr listen_tcp(new TcpSock());
+    if(!listen_tcp->Listen("127.0.0.1", port, 128, false))
+    {
+        printf("listen on port %d failed.\n", port);
+        return false;
+    }
+    SockHandler listen_cb;
+    listen_cb.onAccept = onServerAccept;
+    listen_tcp->SetSockHandler(listen_cb);
+    EventLoopPool::AddTcpSockToLoop(TEST_SERVER_LOOP, listen_tcp);
+
+    s_connected = 0;
+    TcpSockSmartPtr client_tcp(new TcpSock());
+    SockHandler client_cb;
+    client_cb.onRead = onClientRead;
+    client_cb.onConnect = onClientConnect;
+    client_tcp->SetSockHandler(client_cb);
+    if(!client_tcp->AsyncConnect("127.0.0.1", port, 3000))
+    {
+        listen_tcp->Close();
+        return false;
+    }
+    EventLoopPool::AddTcpSockToLoop(TEST_CLIENT_LOOP, client_tcp);
+    while(s_connected == 0)
+        sched_yield();
+    if(s_connected < 0)
+    {
+        printf("connect to port %d failed.\n", port);
+        listen_tcp->Close();
+        return false;
+    }
+
+    std::vector<char> msg(s_msg_size, 'x');
+    std::vector<int64_t> result;
+    result.reserve(msg_num);
+    s_echoed_num = 0;
+    // warm up
+    for(int i = 0; i < msg_num/10 + 1; ++i)
+    {
+        client_tcp->SendData(&msg[0], msg.size());
+        while(s_echoed_num < i + 1)
+            sched_yield();
+    }
+    s_echoed_num = 0;
+    for(int i = 0; i < msg_num; ++i)
+    {
+        int64_t start = now_ns();
+        client_tcp->SendData(&msg[0], msg.size());
+        while(s_echoed_num < i + 1)
+            sched_yield();
+        result.push_back(now_ns() - start);
+    }
+    printResult(name, result);
+    client_tcp->Close();
+    listen_tcp->Close();
+    return true;
+}
+
+int main(int argc, char* argv[])
+{
+    int msg_num = argc > 1 ? atoi(argv[1]) : 20000;
+    s_msg_size = argc > 2 ? (size_t)atoi(argv[2]) : 64;
+    int spin_us = argc > 3 ? atoi(argv[3]) : 50;
+    int sock_busy_poll_us = argc > 4 ? atoi(argv[4]) : 0;
+    unsigned short port = argc > 5 ? (unsigned short)atoi(argv[5]) : 19800;
+    if(s_msg_size == 0)
+        s_msg_size = 1;
+
+    SimpleLogger::Instance().Init("./test_busypoll_rtt.log", lv_warn);
+    threadpool::init_thread_pool();
+    EventLoopPool::InitEventLoopPool();
+    if(!EventLoopPool::CreateEventLoop(TEST_SERVER_LOOP) || !EventLoopPool::CreateEventLoop(TEST_CLIENT_LOOP))
+    {
+        printf("create event loop failed.\n");
+        return 1;
+    }
+    boost::shared_ptr<EventLoop> server_loop = EventLoopPool::GetEventLoop(TEST_SERVER_LOOP);
+    boost::shared_ptr<EventLoop> client_loop = EventLoopPool::GetEventLoop(TEST_CLIENT_LOOP);
+    printf("msgs:%d, msg size:%zu, spin:%dus, SO_BUSY_POLL:%dus\n", msg_num, s_msg_size, spin_us, sock_busy_poll_us);
+
+    testRtt("blocking", port, msg_num);
+
+    server_loop->SetBusyPoll(spin_us, sock_busy_poll_us);
+    client_loop->SetBusyPoll(spin_us, sock_busy_poll_us);
+    testRtt("busypoll", port + 1, msg_num);
+
+    EventLoopPool::DestroyEventLoopPool();
+    threadpool::destroy_thread_pool();
+    return 0;
+}
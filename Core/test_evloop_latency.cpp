@@ -0,0 +1,142 @@
+// 测试跨线程向事件循环投递任务的延迟
+// usage: test_evloop_latency [producer_num] [task_num_per_producer] [batch_size]
+// pingpong: 单个线程投递任务并等待任务执行完成后再投递下一个, 测试唤醒延迟.
+// burst: 多个线程同时批量投递任务, 测试合并唤醒后的延迟和吞吐量.
+#include "threadpool.h"
+#include "EventLoopPool.h"
+#include "EventLoop.h"
+#include "SimpleLogger.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <sched.h>
+#include <pthread.h>
+#include <algorithm>
+#include <vector>
+#include <boost/bind.hpp>
+
+using namespace core;
+using namespace core::net;
+
+#define TEST_LOOP_NAME "test_evloop_latency"
+
+static int64_t now_ns()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec*1000000000LL + ts.tv_nsec;
+}
+
+// only accessed in the loop thread.
+static std::vector<int64_t> s_latency_ns;
+static volatile long s_done_num = 0;
+
+static void onTask(int64_t queued_ns)
+{
+    s_latency_ns.push_back(now_ns() - queued_ns);
+    __sync_fetch_and_add(&s_done_num, 1);
+}
+
+static void printResult(const char* name, std::vector<int64_t>& result, int64_t used_ns)
+{
+    if(result.empty())
+        return;
+    std::sort(result.begin(), result.end());
+    size_t n = result.size();
+    printf("%-10s tasks:%8zu  p50:%8.1fus  p90:%8.1fus  p99:%8.1fus  p999:%8.1fus  max:%8.1fus  rate:%10.0f/s\n",
+        name, n, result[n/2]/1000.0, result[n*9/10]/1000.0, result[n*99/100]/1000.0,
+        result[n*999/1000]/1000.0, result[n - 1]/1000.0, n*1e9/(used_ns > 0 ? used_ns : 1));
+}
+
+static void waitDone(long total)
+{
+    while(s_done_num < total)
+        sched_yield();
+}
+
+static void testPingPong(boost::shared_ptr<EventLoop> loop, int task_num)
+{
+    s_done_num = 0;
+    s_latency_ns.clear();
+    s_latency_ns.reserve(task_num);
+    int64_t start = now_ns();
+    for(int i = 0; i < task_num; ++i)
+    {
+        loop->QueueTaskToLoop(boost::bind(&onTask, now_ns()));
+        waitDone(i + 1);
+    }
+    int64_t used = now_ns() - start;
+    // all the tasks are done, it is safe to access the result here.
+    std::vector<int64_t> result(s_latency_ns);
+    printResult("pingpong", result, used);
+}
+
+struct ProducerParam
+{
+    boost::shared_ptr<EventLoop> loop;
+    int task_num;
+    int batch;
+};
+
+static void* producerThread(void* param)
+{
+    ProducerParam* p = (ProducerParam*)param;
+    for(int i = 0; i < p->task_num; ++i)
+    {
+        p->loop->QueueTaskToLoop(boost::bind(&onTask, now_ns()));
+        if((i + 1) % p->batch == 0)
+            sched_yield();
+    }
+    return 0;
+}
+
+static void testBurst(boost::shared_ptr<EventLoop> loop, int producer_num, int task_num, int batch)
+{
+    s_done_num = 0;
+    s_latency_ns.clear();
+    s_latency_ns.reserve(producer_num*task_num);
+    ProducerParam param;
+    param.loop = loop;
+    param.task_num = task_num;
+    param.batch = batch > 0 ? batch : 1;
+    std::vector<pthread_t> tids(producer_num);
+    int64_t start = now_ns();
+    for(int i = 0; i < producer_num; ++i)
+    {
+        pthread_create(&tids[i], NULL, &producerThread, &param);
+    }
+    for(int i = 0; i < producer_num; ++i)
+    {
+        pthread_join(tids[i], NULL);
+    }
+    waitDone((long)producer_num*task_num);
+    int64_t used = now_ns() - start;
+    std::vector<int64_t> result(s_latency_ns);
+    printResult("burst", result, used);
+}
+
+int main(int argc, char* argv[])
+{
+    int producer_num = argc > 1 ? atoi(argv[1]) : 4;
+    int task_num = argc > 2 ? atoi(argv[2]) : 100000;
+    int batch = argc > 3 ? atoi(argv[3]) : 64;
+
+    SimpleLogger::Instance().Init("./test_evloop_latency.log", lv_warn);
+    threadpool::init_thread_pool();
+    EventLoopPool::InitEventLoopPool();
+    if(!EventLoopPool::CreateEventLoop(TEST_LOOP_NAME))
+    {
+        printf("create event loop failed.\n");
+        return 1;
+    }
+    boost::shared_ptr<EventLoop> loop = EventLoopPool::GetEventLoop(TEST_LOOP_NAME);
+    printf("producers:%d, tasks per producer:%d, batch:%d\n", producer_num, task_num, batch);
+    testPingPong(loop, task_num/10 > 0 ? task_num/10 : 1);
+    testBurst(loop, producer_num, task_num, batch);
+
+    EventLoopPool::DestroyEventLoopPool();
+    threadpool::destroy_thread_pool();
+    return 0;
+}
@@ -0,0 +1,84 @@
+// 测试按整数选择分片的均匀性
+// usage: test_hash_shard [key_num]
+// 连续的 fd 和 16 字节对齐的堆指针在 2, 3, 4, 8, 16 个分片中的分布都应该是均匀的.
+#include "CommonUtility.hpp"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+using namespace core;
+
+static int s_failed_num = 0;
+
+#define CHECK(cond) do { \
+    if(!(cond)) { \
+        printf("%s:%d check failed: %s\n", __FILE__, __LINE__, #cond); \
+        ++s_failed_num; \
+    } \
+} while(0)
+
+// whether every shard gets the keys within 20% of the average.
+static bool isSpreadEvenly(const char* name, const std::vector<uint64_t>& keys, size_t shard_num)
+{
+    std::vector<size_t> counts(shard_num, 0);
+    for(size_t i = 0; i < keys.size(); ++i)
+    {
+        ++counts[utility::HashShard(keys[i], shard_num)];
+    }
+    double average = (double)keys.size()/shard_num;
+    bool even = true;
+    for(size_t i = 0; i < shard_num; ++i)
+    {
+        if(counts[i] < average*0.8 || counts[i] > average*1.2)
+            even = false;
+    }
+    if(!even)
+    {
+        printf("%s in %zu shards:", name, shard_num);
+        for(size_t i = 0; i < shard_num; ++i)
+            printf(" %zu", counts[i]);
+        printf("\n");
+    }
+    return even;
+}
+
+int main(int argc, char* argv[])
+{
+    int key_num = argc > 1 ? atoi(argv[1]) : 10000;
+    std::vector<uint64_t> fds;
+    for(int i = 0; i < key_num; ++i)
+    {
+        fds.push_back(3 + i);
+    }
+    // the sockets alive at the same time, allocated as the tcp objects are.
+    std::vector<char*> buffers;
+    std::vector<uint64_t> pointers;
+    for(int i = 0; i < key_num; ++i)
+    {
+        buffers.push_back(new char[256]);
+        pointers.push_back((uint64_t)buffers.back());
+    }
+    CHECK(pointers.front() % 16 == 0);
+
+    const size_t shard_nums[] = {1, 2, 3, 4, 8, 16};
+    for(size_t i = 0; i < sizeof(shard_nums)/sizeof(shard_nums[0]); ++i)
+    {
+        CHECK(isSpreadEvenly("fds", fds, shard_nums[i]));
+        CHECK(isSpreadEvenly("pointers", pointers, shard_nums[i]));
+    }
+    // the same key always goes to the same shard.
+    CHECK(utility::HashShard(12345, 8) == utility::HashShard(12345, 8));
+
+    for(size_t i = 0; i < buffers.size(); ++i)
+    {
+        delete[] buffers[i];
+    }
+    if(s_failed_num > 0)
+    {
+        printf("%d checks failed.\n", s_failed_num);
+        return 1;
+    }
+    printf("all checks passed.\n");
+    return 0;
+}
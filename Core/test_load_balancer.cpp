@@ -0,0 +1,243 @@
+// 测试服务副本的负载均衡策略
+// usage: test_load_balancer [select_num]
+// policy: 策略名的解析和创建, 没有可用副本时返回 -1, 不可用(UNAVAILABLE)的副本从不被选中.
+// rr: 按顺序轮流选择可用的副本. least: 选择负载代价最小的副本, 代价相同时均匀选择.
+// random: 按忙碌状态的权重 4:3:2 随机选择. p2c: 两个随机副本中选择负载较小的一个.
+#include "MsgBusLoadBalancer.hpp"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+using namespace NetMsgBus;
+
+static int s_failed_num = 0;
+
+#define CHECK(cond) do { \
+    if(!(cond)) { \
+        printf("%s:%d check failed: %s\n", __FILE__, __LINE__, #cond); \
+        ++s_failed_num; \
+    } \
+} while(0)
+
+class VectorLoadGetter : public ReplicaLoadGetter
+{
+public:
+    ReplicaLoad operator()(size_t index) const
+    {
+        return loads[index];
+    }
+    void Add(kServerBusyState busy_state, long inflight = 0, size_t queued_bytes = 0)
+    {
+        ReplicaLoad load;
+        load.busy_state = busy_state;
+        load.inflight = inflight;
+        load.queued_bytes = queued_bytes;
+        loads.push_back(load);
+    }
+    std::vector<ReplicaLoad> loads;
+};
+
+static const kLoadBalancePolicy s_all_policies[] = {LB_POWER_OF_TWO, LB_ROUND_ROBIN,
+    LB_LEAST_LOADED, LB_WEIGHTED_RANDOM};
+#define ALL_POLICY_NUM (sizeof(s_all_policies)/sizeof(s_all_policies[0]))
+
+// return the times each replica is selected, the last one counts the failed selections.
+static std::vector<int> countSelected(kLoadBalancePolicy policy, const VectorLoadGetter& loads, int select_num)
+{
+    boost::shared_ptr<LoadBalancer> balancer = LoadBalancer::Create(policy);
+    volatile unsigned long cursor = 0;
+    std::vector<int> selected(loads.loads.size() + 1, 0);
+    for(int i = 0; i < select_num; ++i)
+    {
+        int index = balancer->Select(loads, loads.loads.size(), cursor);
+        if(index < 0 || index >= (int)loads.loads.size())
+            ++selected.back();
+        else
+            ++selected[index];
+    }
+    return selected;
+}
+
+// whether the ratio of a to b is near the expected one.
+static bool isRatioNear(int a, int b, double expected)
+{
+    if(b == 0)
+        return false;
+    double ratio = (double)a/b;
+    return ratio > expected*0.9 && ratio < expected*1.1;
+}
+
+static void testPolicy()
+{
+    kLoadBalancePolicy policy = LB_ROUND_ROBIN;
+    CHECK(LoadBalancer::ParsePolicy("p2c", policy) && policy == LB_POWER_OF_TWO);
+    CHECK(LoadBalancer::ParsePolicy("rr", policy) && policy == LB_ROUND_ROBIN);
+    CHECK(LoadBalancer::ParsePolicy("least", policy) && policy == LB_LEAST_LOADED);
+    CHECK(LoadBalancer::ParsePolicy("random", policy) && policy == LB_WEIGHTED_RANDOM);
+    CHECK(!LoadBalancer::ParsePolicy("", policy));
+    CHECK(!LoadBalancer::ParsePolicy("RR", policy));
+    CHECK(!LoadBalancer::ParsePolicy("roundrobin", policy));
+    CHECK(policy == LB_WEIGHTED_RANDOM);
+
+    CHECK(dynamic_cast<PowerOfTwoBalancer*>(LoadBalancer::Create(LB_POWER_OF_TWO).get()) != NULL);
+    CHECK(dynamic_cast<RoundRobinBalancer*>(LoadBalancer::Create(LB_ROUND_ROBIN).get()) != NULL);
+    CHECK(dynamic_cast<LeastLoadedBalancer*>(LoadBalancer::Create(LB_LEAST_LOADED).get()) != NULL);
+    CHECK(dynamic_cast<WeightedRandomBalancer*>(LoadBalancer::Create(LB_WEIGHTED_RANDOM).get()) != NULL);
+}
+
+static void testUnavailable(int select_num)
+{
+    VectorLoadGetter none;
+    VectorLoadGetter all_unavailable;
+    all_unavailable.Add(UNAVAILABLE);
+    all_unavailable.Add(UNAVAILABLE);
+    all_unavailable.Add(UNAVAILABLE);
+    // the unavailable replicas are the least loaded ones.
+    VectorLoadGetter mixed;
+    mixed.Add(UNAVAILABLE);
+    mixed.Add(HIGH, 100, 1024*1024);
+    mixed.Add(UNAVAILABLE);
+    mixed.Add(LOW, 50);
+    mixed.Add(UNAVAILABLE);
+    VectorLoadGetter only_one;
+    only_one.Add(UNAVAILABLE);
+    only_one.Add(UNAVAILABLE);
+    only_one.Add(HIGH, 1000);
+    only_one.Add(UNAVAILABLE);
+    for(size_t i = 0; i < ALL_POLICY_NUM; ++i)
+    {
+        kLoadBalancePolicy policy = s_all_policies[i];
+        CHECK(countSelected(policy, none, 10).back() == 10);
+        CHECK(countSelected(policy, all_unavailable, 10).back() == 10);
+        std::vector<int> selected = countSelected(policy, mixed, select_num);
+        CHECK(selected[0] == 0 && selected[2] == 0 && selected[4] == 0 && selected.back() == 0);
+        selected = countSelected(policy, only_one, select_num);
+        CHECK(selected[2] == select_num);
+        if(s_failed_num > 0)
+        {
+            printf("policy %d failed.\n", (int)policy);
+            return;
+        }
+    }
+}
+
+static void testRoundRobin()
+{
+    boost::shared_ptr<LoadBalancer> balancer = LoadBalancer::Create(LB_ROUND_ROBIN);
+    volatile unsigned long cursor = 0;
+    VectorLoadGetter loads;
+    loads.Add(LOW);
+    loads.Add(HIGH, 1000);
+    loads.Add(MIDDLE);
+    // the load does not change the order.
+    for(int i = 0; i < 10; ++i)
+    {
+        CHECK(balancer->Select(loads, loads.loads.size(), cursor) == i % 3);
+    }
+    // the unavailable replica is skipped.
+    loads.loads[1].busy_state = UNAVAILABLE;
+    cursor = 0;
+    for(int i = 0; i < 10; ++i)
+    {
+        CHECK(balancer->Select(loads, loads.loads.size(), cursor) == (i % 2 == 0 ? 0 : 2));
+    }
+    // the cursor is kept by the caller, so each service has its own order.
+    volatile unsigned long other_cursor = 2;
+    CHECK(balancer->Select(loads, loads.loads.size(), other_cursor) == 2);
+    CHECK(balancer->Select(loads, loads.loads.size(), other_cursor) == 0);
+    CHECK(balancer->Select(loads, loads.loads.size(), other_cursor) == 2);
+}
+
+static void testLeastLoaded(int select_num)
+{
+    boost::shared_ptr<LoadBalancer> balancer = LoadBalancer::Create(LB_LEAST_LOADED);
+    volatile unsigned long cursor = 0;
+    VectorLoadGetter loads;
+    loads.Add(LOW, 5);
+    loads.Add(LOW, 2);
+    loads.Add(LOW, 3);
+    CHECK(balancer->Select(loads, loads.loads.size(), cursor) == 1);
+    // 8KB waiting in the outbound queue counts as 2 requests.
+    loads.loads[1].queued_bytes = 8192;
+    CHECK(balancer->Select(loads, loads.loads.size(), cursor) == 2);
+    // the cost is scaled by the busy state: (1 + 0)/2 of HIGH is less than (1 + 3)/4 of LOW.
+    loads.loads[0].busy_state = HIGH;
+    loads.loads[0].inflight = 0;
+    CHECK(balancer->Select(loads, loads.loads.size(), cursor) == 0);
+    loads.loads[0].inflight = 2;
+    CHECK(balancer->Select(loads, loads.loads.size(), cursor) == 2);
+
+    // the equally loaded replicas are chosen evenly.
+    VectorLoadGetter equal;
+    equal.Add(MIDDLE, 1);
+    equal.Add(MIDDLE, 1);
+    equal.Add(LOW, 10);
+    std::vector<int> selected = countSelected(LB_LEAST_LOADED, equal, select_num);
+    CHECK(selected[2] == 0);
+    CHECK(isRatioNear(selected[0], selected[1], 1.0));
+}
+
+static void testWeightedRandom(int select_num)
+{
+    VectorLoadGetter loads;
+    // the load other than the busy state is ignored.
+    loads.Add(LOW, 1000);
+    loads.Add(MIDDLE);
+    loads.Add(HIGH, 0, 1024*1024);
+    loads.Add(UNAVAILABLE);
+    std::vector<int> selected = countSelected(LB_WEIGHTED_RANDOM, loads, select_num);
+    CHECK(selected[3] == 0 && selected.back() == 0);
+    CHECK(isRatioNear(selected[0], selected[2], 4.0/2));
+    CHECK(isRatioNear(selected[1], selected[2], 3.0/2));
+    printf("random LOW:MIDDLE:HIGH = %d:%d:%d\n", selected[0], selected[1], selected[2]);
+}
+
+static void testPowerOfTwo(int select_num)
+{
+    boost::shared_ptr<LoadBalancer> balancer = LoadBalancer::Create(LB_POWER_OF_TWO);
+    volatile unsigned long cursor = 0;
+    // both are compared if there are only two.
+    VectorLoadGetter two;
+    two.Add(LOW, 10);
+    two.Add(LOW, 1);
+    for(int i = 0; i < 100; ++i)
+    {
+        CHECK(balancer->Select(two, two.loads.size(), cursor) == 1);
+    }
+    VectorLoadGetter single;
+    single.Add(HIGH, 100);
+    CHECK(balancer->Select(single, single.loads.size(), cursor) == 0);
+
+    // the most loaded one is never chosen, the least loaded one is chosen the most.
+    VectorLoadGetter loads;
+    loads.Add(LOW, 0);
+    loads.Add(LOW, 10);
+    loads.Add(LOW, 20);
+    loads.Add(LOW, 30);
+    std::vector<int> selected = countSelected(LB_POWER_OF_TWO, loads, select_num);
+    CHECK(selected[3] == 0 && selected.back() == 0);
+    CHECK(selected[0] > selected[1] && selected[1] > selected[2] && selected[2] > 0);
+    // the chance of the least loaded one is 1 - (3/4)*(2/3).
+    CHECK(isRatioNear(selected[0], select_num, 0.5));
+    printf("p2c by load 0:10:20:30 = %d:%d:%d:%d\n", selected[0], selected[1], selected[2], selected[3]);
+}
+
+int main(int argc, char* argv[])
+{
+    int select_num = argc > 1 ? atoi(argv[1]) : 90000;
+    srand(1);
+    testPolicy();
+    testUnavailable(select_num);
+    testRoundRobin();
+    testLeastLoaded(select_num);
+    testWeightedRandom(select_num);
+    testPowerOfTwo(select_num);
+    if(s_failed_num > 0)
+    {
+        printf("%d checks failed.\n", s_failed_num);
+        return 1;
+    }
+    printf("all checks passed.\n");
+    return 0;
+}
@@ -0,0 +1,287 @@
+// 测试不可变的前缀树 RadixTrie
+// usage: test_radix_trie [operation_num]
+// basic: 查找, 插入, 删除, 节点分裂和合并后的查找结果.
+// visit: VisitPrefixMatching 和 VisitWithPrefix 的访问结果, 访问者返回 false 时停止.
+// random: 随机插入删除并与 std::map 的结果比较, 旧版本的内容不受新版本修改的影响.
+#include "RadixTrie.hpp"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+using namespace core::common;
+
+typedef RadixTrie<std::string> TrieT;
+typedef std::map<std::string, std::string> MapT;
+
+static int s_failed_num = 0;
+
+#define CHECK(cond) do { \
+    if(!(cond)) { \
+        printf("%s:%d check failed: %s\n", __FILE__, __LINE__, #cond); \
+        ++s_failed_num; \
+    } \
+} while(0)
+
+// the value of each key is the key itself, so the visited keys can be collected.
+// the values of the random test are all different, they are compared instead of the keys.
+static TrieT::ValuePtr makeValue(const std::string& key)
+{
+    return TrieT::ValuePtr(new std::string(key));
+}
+
+struct CollectVisitor
+{
+    explicit CollectVisitor(size_t limit = (size_t)-1)
+        :limit(limit),
+        visited(0)
+    {
+    }
+    bool operator()(const TrieT::ValuePtr& value)
+    {
+        keys.insert(*value);
+        ++visited;
+        return keys.size() < limit;
+    }
+    size_t limit;
+    size_t visited;
+    std::set<std::string> keys;
+};
+
+static bool isValue(const TrieT& trie, const std::string& key, const std::string& value)
+{
+    TrieT::ValuePtr found = trie.Find(key);
+    return found && *found == value;
+}
+
+static std::set<std::string> prefixMatching(const MapT& expected, const std::string& key)
+{
+    std::set<std::string> keys;
+    for(MapT::const_iterator cit = expected.begin(); cit != expected.end(); ++cit)
+    {
+        const std::string& k = cit->first;
+        if(key.compare(0, k.size(), k) == 0 || k.compare(0, key.size(), key) == 0)
+            keys.insert(cit->second);
+    }
+    return keys;
+}
+
+static std::set<std::string> withPrefix(const MapT& expected, const std::string& prefix)
+{
+    std::set<std::string> keys;
+    for(MapT::const_iterator cit = expected.begin(); cit != expected.end(); ++cit)
+    {
+        if(cit->first.compare(0, prefix.size(), prefix) == 0)
+            keys.insert(cit->second);
+    }
+    return keys;
+}
+
+static bool isSame(const TrieT& trie, const MapT& expected, const std::vector<std::string>& all_keys)
+{
+    if(trie.Size() != expected.size() || trie.Empty() != expected.empty())
+        return false;
+    for(size_t i = 0; i < all_keys.size(); ++i)
+    {
+        TrieT::ValuePtr value = trie.Find(all_keys[i]);
+        MapT::const_iterator cit = expected.find(all_keys[i]);
+        if(cit == expected.end() ? value.get() != NULL : (!value || *value != cit->second))
+            return false;
+    }
+    return true;
+}
+
+static bool isVisitSame(const TrieT& trie, const MapT& expected, const std::string& key)
+{
+    CollectVisitor matching;
+    trie.VisitPrefixMatching(key, matching);
+    CollectVisitor prefixed;
+    trie.VisitWithPrefix(key, prefixed);
+    // each key is visited only once.
+    return matching.keys == prefixMatching(expected, key) && matching.visited == matching.keys.size() &&
+        prefixed.keys == withPrefix(expected, key) && prefixed.visited == prefixed.keys.size();
+}
+
+static void testBasic()
+{
+    TrieT empty;
+    CHECK(empty.Empty());
+    CHECK(!empty.Find(""));
+    CHECK(!empty.Find("a"));
+
+    TrieT trie = empty.Set("test.service", makeValue("test.service"));
+    CHECK(trie.Size() == 1);
+    CHECK(empty.Empty());
+    CHECK(isValue(trie, "test.service", "test.service"));
+    CHECK(!trie.Find("test."));
+    CHECK(!trie.Find("test.service.a"));
+    CHECK(!trie.Find(""));
+
+    // split the edge in the middle, at the end, and add a key below.
+    trie = trie.Set("test.server", makeValue("test.server"));
+    trie = trie.Set("test.", makeValue("test."));
+    trie = trie.Set("test.service.a", makeValue("test.service.a"));
+    CHECK(trie.Size() == 4);
+    CHECK(isValue(trie, "test.server", "test.server"));
+    CHECK(isValue(trie, "test.", "test."));
+    CHECK(isValue(trie, "test.service", "test.service"));
+    CHECK(isValue(trie, "test.service.a", "test.service.a"));
+    CHECK(!trie.Find("test.serv"));
+    CHECK(!trie.Find("test"));
+
+    // replace the value.
+    TrieT replaced = trie.Set("test.", makeValue("replaced"));
+    CHECK(replaced.Size() == 4);
+    CHECK(isValue(replaced, "test.", "replaced"));
+    CHECK(isValue(trie, "test.", "test."));
+
+    // remove the keys, the nodes left are merged.
+    TrieT removed = trie.Set("test.service", TrieT::ValuePtr());
+    CHECK(removed.Size() == 3);
+    CHECK(!removed.Find("test.service"));
+    CHECK(isValue(removed, "test.service.a", "test.service.a"));
+    CHECK(isValue(trie, "test.service", "test.service"));
+    // removing the key which does not exist changes nothing.
+    CHECK(removed.Set("test.serv", TrieT::ValuePtr()).Size() == 3);
+    CHECK(removed.Set("test.service", TrieT::ValuePtr()).Size() == 3);
+    CHECK(removed.Set("other", TrieT::ValuePtr()).Size() == 3);
+    removed = removed.Set("test.", TrieT::ValuePtr());
+    removed = removed.Set("test.server", TrieT::ValuePtr());
+    CHECK(removed.Size() == 1);
+    CHECK(isValue(removed, "test.service.a", "test.service.a"));
+    removed = removed.Set("test.service.a", TrieT::ValuePtr());
+    CHECK(removed.Empty());
+    CHECK(!removed.Find("test.service.a"));
+
+    // the empty key is the root.
+    TrieT root = trie.Set("", makeValue(""));
+    CHECK(root.Size() == 5);
+    CHECK(isValue(root, "", ""));
+    CHECK(root.Set("", TrieT::ValuePtr()).Size() == 4);
+}
+
+static void testVisit()
+{
+    const char* keys[] = {"a", "a.b", "a.b.c", "a.bc", "a.c", "b", "ab"};
+    TrieT trie;
+    MapT expected;
+    for(size_t i = 0; i < sizeof(keys)/sizeof(keys[0]); ++i)
+    {
+        trie = trie.Set(keys[i], makeValue(keys[i]));
+        expected[keys[i]] = keys[i];
+    }
+
+    CollectVisitor matching;
+    trie.VisitPrefixMatching("a.b", matching);
+    std::set<std::string> result;
+    result.insert("a");
+    result.insert("a.b");
+    result.insert("a.b.c");
+    result.insert("a.bc");
+    CHECK(matching.keys == result);
+
+    CollectVisitor prefixed;
+    trie.VisitWithPrefix("a.b", prefixed);
+    result.erase("a");
+    CHECK(prefixed.keys == result);
+
+    const char* visit_keys[] = {"", "a", "a.", "a.b", "a.b.", "a.b.c.d", "a.bcd", "ac", "b", "c"};
+    for(size_t i = 0; i < sizeof(visit_keys)/sizeof(visit_keys[0]); ++i)
+    {
+        if(!isVisitSame(trie, expected, visit_keys[i]))
+        {
+            printf("visit %s failed.\n", visit_keys[i]);
+            ++s_failed_num;
+        }
+    }
+
+    // stop visiting if the visitor returns false.
+    CollectVisitor first_two(2);
+    trie.VisitPrefixMatching("a.b.c", first_two);
+    CHECK(first_two.visited == 2);
+    CollectVisitor first_one(1);
+    trie.VisitWithPrefix("", first_one);
+    CHECK(first_one.visited == 1);
+}
+
+static void testRandom(int operation_num)
+{
+    // the keys from a small alphabet share many prefixes.
+    std::vector<std::string> all_keys;
+    all_keys.push_back("");
+    for(int len = 1; len <= 4; ++len)
+    {
+        size_t end = all_keys.size();
+        for(size_t i = 0; i < end; ++i)
+        {
+            if(all_keys[i].size() != (size_t)len - 1)
+                continue;
+            all_keys.push_back(all_keys[i] + "a");
+            all_keys.push_back(all_keys[i] + "b");
+            all_keys.push_back(all_keys[i] + ".");
+        }
+    }
+
+    srand(1);
+    TrieT trie;
+    MapT expected;
+    // the old versions must keep their contents.
+    std::vector<std::pair<TrieT, MapT> > versions;
+    for(int i = 0; i < operation_num; ++i)
+    {
+        const std::string& key = all_keys[rand() % all_keys.size()];
+        if(rand() % 3 == 0)
+        {
+            trie = trie.Set(key, TrieT::ValuePtr());
+            expected.erase(key);
+        }
+        else
+        {
+            char value[32];
+            snprintf(value, sizeof(value), "%d", i);
+            trie = trie.Set(key, TrieT::ValuePtr(new std::string(value)));
+            expected[key] = value;
+        }
+        if(!isSame(trie, expected, all_keys))
+        {
+            printf("operation %d on %s failed.\n", i, key.c_str());
+            ++s_failed_num;
+            return;
+        }
+        if(i % 100 == 0)
+        {
+            versions.push_back(std::make_pair(trie, expected));
+            for(size_t j = 0; j < all_keys.size(); j += 7)
+            {
+                if(!isVisitSame(trie, expected, all_keys[j]))
+                {
+                    printf("operation %d visit %s failed.\n", i, all_keys[j].c_str());
+                    ++s_failed_num;
+                    return;
+                }
+            }
+        }
+    }
+    for(size_t i = 0; i < versions.size(); ++i)
+    {
+        CHECK(isSame(versions[i].first, versions[i].second, all_keys));
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    int operation_num = argc > 1 ? atoi(argv[1]) : 2000;
+    testBasic();
+    testVisit();
+    testRandom(operation_num);
+    if(s_failed_num > 0)
+    {
+        printf("%d checks failed.\n", s_failed_num);
+        return 1;
+    }
+    printf("all checks passed.\n");
+    return 0;
+}
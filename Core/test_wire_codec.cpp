@@ -0,0 +1,470 @@
+// 测试 v2 紧凑协议的编解码
+// usage: test_wire_codec
+// roundtrip: 编码后再解码应得到原始的 v1 帧, 重复发送的名字使用编号.
+// names: 名字表满(MAX_INTERNED_NAMES)后新名字直接内联发送, 已分配编号的名字不受影响.
+// interop: 对端只支持 v1 时不编码, v2 解码端兼容 v1 帧.
+// compress: 压缩和字典更新, 字典数量和大小的限制, 多块解压, 超过 4MB 的消息不压缩.
+#include "msgbus_def.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <arpa/inet.h>
+#include <string>
+
+using namespace NetMsgBus;
+
+// the same as the limits in msgbus_def.cpp.
+#define TEST_MAX_INTERNED_NAMES 4096
+#define TEST_MAX_DICT_MSGIDS    256
+#define TEST_MAX_DICT_BYTES     32768
+#define TEST_MAX_INFLATED_BODY_LEN  (4*1024*1024)
+#define TEST_COMPRESS_THRESHOLD 64
+
+static int s_failed_num = 0;
+
+#define CHECK(cond) do { \
+    if(!(cond)) { \
+        printf("%s:%d check failed: %s\n", __FILE__, __LINE__, #cond); \
+        ++s_failed_num; \
+    } \
+} while(0)
+
+// 1 byte sender len + sender + 1 byte msgid len + msgid + 4 bytes param len + param.
+static std::string makeNetMsgContent(const std::string& sender, const std::string& msgid, const std::string& param)
+{
+    std::string content;
+    content.push_back((char)sender.size());
+    content.append(sender);
+    content.push_back((char)msgid.size());
+    content.append(msgid);
+    uint32_t param_len = htonl(param.size());
+    content.append((const char*)&param_len, sizeof(param_len));
+    content.append(param);
+    return content;
+}
+
+static std::string makeSendMsgFrame(const std::string& dest, const std::string& from, std::string content)
+{
+    MsgBusSendMsgReq req;
+    strncpy(req.dest_name, dest.c_str(), MAX_SERVICE_NAME);
+    strncpy(req.from_name, from.c_str(), MAX_SERVICE_NAME);
+    req.msg_len = content.size();
+    req.SetVarData(&content[0]);
+    std::string frame(req.Size(), '\0');
+    req.PackData(&frame[0]);
+    return frame;
+}
+
+// decode the encoded frame and compare it with the v1 frame.
+static bool isDecodedSame(MsgBusWireCodec& decoder, const std::string& encoded, const std::string& frame)
+{
+    MsgBusPackHead orig_head;
+    orig_head.UnPackHead(frame.data());
+    MsgBusPackHead head;
+    const char* body = NULL;
+    int ret = decoder.DecodeFrame(encoded.data(), encoded.size(), head, body);
+    uint32_t head_len = orig_head.Size();
+    return ret == (int)encoded.size() && head.msg_type == orig_head.msg_type &&
+        head.body_type == orig_head.body_type && head.msg_id == orig_head.msg_id &&
+        head_len + head.body_len == frame.size() &&
+        memcmp(body, frame.data() + head_len, head.body_len) == 0;
+}
+
+static bool encodeAndCheck(MsgBusWireCodec& encoder, MsgBusWireCodec& decoder, const std::string& frame, size_t* wire_len = NULL)
+{
+    std::string encoded;
+    if(!encoder.EncodeFrame(frame.data(), frame.size(), encoded))
+        return false;
+    if(wire_len)
+        *wire_len = encoded.size();
+    return isDecodedSame(decoder, encoded, frame);
+}
+
+// the words are repeated but not in order, so the content is compressed but not too much.
+static std::string makeWords(size_t len, unsigned int seed)
+{
+    std::string words;
+    words.reserve(len + 32);
+    srand(seed);
+    while(words.size() < len)
+    {
+        char word[32];
+        snprintf(word, sizeof(word), "word%d ", rand() % 500);
+        words.append(word);
+    }
+    words.resize(len);
+    return words;
+}
+
+static void putVarint(std::string& out, uint32_t v)
+{
+    while(v >= 0x80)
+    {
+        out.push_back((char)((v & 0x7f) | 0x80));
+        v >>= 7;
+    }
+    out.push_back((char)v);
+}
+
+static uint32_t getVarint(const std::string& data, size_t& pos)
+{
+    uint32_t v = 0;
+    for(int shift = 0; pos < data.size() && shift < 35; shift += 7)
+    {
+        uint8_t b = (uint8_t)data[pos++];
+        v |= (uint32_t)(b & 0x7f) << shift;
+        if((b & 0x80) == 0)
+            break;
+    }
+    return v;
+}
+
+struct CompressInfo
+{
+    bool compressed;
+    bool dict_update;
+    uint32_t raw_len;
+    uint32_t dict_id;
+    // the offset of the raw length in the encoded frame.
+    size_t raw_len_pos;
+};
+
+// magic + version + type flags + body type + varint msg id + varint body len + body,
+// the compressed body: algorithm + varint raw len + varint dict id + deflated data.
+static CompressInfo getCompressInfo(const std::string& encoded)
+{
+    CompressInfo info = CompressInfo();
+    uint8_t type_flags = (uint8_t)encoded[3];
+    info.compressed = (type_flags & MSGBUS_FLAG_COMPRESSED) != 0;
+    info.dict_update = (type_flags & MSGBUS_FLAG_DICT_UPDATE) != 0;
+    if(!info.compressed)
+        return info;
+    size_t pos = 5;
+    getVarint(encoded, pos);
+    getVarint(encoded, pos);
+    ++pos;
+    info.raw_len_pos = pos;
+    info.raw_len = getVarint(encoded, pos);
+    info.dict_id = getVarint(encoded, pos);
+    return info;
+}
+
+static bool encodeAndCheck(MsgBusWireCodec& encoder, MsgBusWireCodec& decoder, const std::string& frame, CompressInfo& info, size_t* wire_len = NULL)
+{
+    std::string encoded;
+    if(!encoder.EncodeFrame(frame.data(), frame.size(), encoded))
+        return false;
+    info = getCompressInfo(encoded);
+    if(wire_len)
+        *wire_len = encoded.size();
+    return isDecodedSame(decoder, encoded, frame);
+}
+
+static void testRoundTrip()
+{
+    MsgBusWireCodec encoder, decoder;
+    encoder.OnPeerVersion(MSGBUS_HEAD_VERSION);
+    decoder.OnPeerVersion(MSGBUS_HEAD_VERSION);
+
+    std::string netmsg = makeSendMsgFrame("dest.service", "from.service",
+        makeNetMsgContent("from.service", "test.msgid", "param data"));
+    size_t first_len = 0;
+    size_t second_len = 0;
+    CHECK(encodeAndCheck(encoder, decoder, netmsg, &first_len));
+    CHECK(first_len < netmsg.size());
+    // the names are sent by the ids the second time.
+    CHECK(encodeAndCheck(encoder, decoder, netmsg, &second_len));
+    CHECK(second_len < first_len);
+
+    std::string raw = makeSendMsgFrame("dest.service", "", "raw content which is not a netmsg");
+    CHECK(encodeAndCheck(encoder, decoder, raw));
+    std::string empty = makeSendMsgFrame("dest.service", "from.service", "");
+    CHECK(encodeAndCheck(encoder, decoder, empty));
+
+    // other frames keep the body as it is.
+    MsgBusSendMsgRsp rsp;
+    rsp.msg_id = 12345;
+    rsp.ret_code = 1;
+    std::string err_msg("dest client not found.");
+    rsp.err_msg_len = err_msg.size() + 1;
+    rsp.SetVarData(&err_msg[0]);
+    std::string rsp_frame(rsp.Size(), '\0');
+    rsp.PackData(&rsp_frame[0]);
+    CHECK(encodeAndCheck(encoder, decoder, rsp_frame));
+
+    // the frame is not complete until the last byte is received.
+    std::string encoded;
+    CHECK(encoder.EncodeFrame(netmsg.data(), netmsg.size(), encoded));
+    MsgBusPackHead head;
+    const char* body = NULL;
+    for(size_t len = 0; len < encoded.size(); ++len)
+    {
+        CHECK(decoder.DecodeFrame(encoded.data(), len, head, body) == 0);
+    }
+    CHECK(isDecodedSame(decoder, encoded, netmsg));
+    // a broken magic.
+    encoded[0] = (char)~encoded[0];
+    CHECK(decoder.DecodeFrame(encoded.data(), encoded.size(), head, body) < 0);
+    // an id which is not bound before.
+    MsgBusWireCodec fresh_decoder;
+    std::string resent;
+    CHECK(encoder.EncodeFrame(netmsg.data(), netmsg.size(), resent));
+    CHECK(fresh_decoder.DecodeFrame(resent.data(), resent.size(), head, body) < 0);
+}
+
+static void testNameOverflow()
+{
+    MsgBusWireCodec encoder, decoder;
+    encoder.OnPeerVersion(MSGBUS_HEAD_VERSION);
+    decoder.OnPeerVersion(MSGBUS_HEAD_VERSION);
+
+    char name[MAX_SERVICE_NAME];
+    // the from name takes the first id.
+    for(int i = 0; i < TEST_MAX_INTERNED_NAMES + 100; ++i)
+    {
+        snprintf(name, sizeof(name), "dest.%d", i);
+        std::string frame = makeSendMsgFrame(name, "from", "content");
+        if(!encodeAndCheck(encoder, decoder, frame))
+        {
+            printf("name %d round trip failed.\n", i);
+            ++s_failed_num;
+            break;
+        }
+    }
+    // the interned names still use the ids.
+    std::string interned = makeSendMsgFrame("dest.0", "from", "content");
+    CHECK(encodeAndCheck(encoder, decoder, interned));
+    snprintf(name, sizeof(name), "dest.%d", TEST_MAX_INTERNED_NAMES - 2);
+    std::string last_interned = makeSendMsgFrame(name, "from", "content");
+    size_t interned_len = 0;
+    CHECK(encodeAndCheck(encoder, decoder, last_interned, &interned_len));
+
+    // the names after the table is full are always sent inline.
+    snprintf(name, sizeof(name), "dest.%d", TEST_MAX_INTERNED_NAMES - 1);
+    std::string inline_name = makeSendMsgFrame(name, "from", "content");
+    size_t first_len = 0;
+    size_t second_len = 0;
+    CHECK(encodeAndCheck(encoder, decoder, inline_name, &first_len));
+    CHECK(encodeAndCheck(encoder, decoder, inline_name, &second_len));
+    CHECK(first_len == second_len);
+    CHECK(interned_len < first_len);
+}
+
+static void testInterop()
+{
+    std::string frame = makeSendMsgFrame("dest.service", "from.service",
+        makeNetMsgContent("from.service", "test.msgid", "param data"));
+    std::string encoded;
+
+    // the peer version is unknown before any frame is received.
+    MsgBusWireCodec codec;
+    CHECK(!codec.IsCompactEnabled());
+    CHECK(!codec.EncodeFrame(frame.data(), frame.size(), encoded));
+
+    // the old peer only knows v1.
+    codec.OnPeerVersion(0x0001);
+    CHECK(!codec.IsCompactEnabled());
+    CHECK(!codec.IsCompressEnabled());
+    CHECK(!codec.EncodeFrame(frame.data(), frame.size(), encoded));
+
+    // the v1 frame from the old peer is decoded as it is.
+    std::string old_frame(frame);
+    uint16_t old_version = htons(0x0001);
+    memcpy(&old_frame[1], &old_version, sizeof(old_version));
+    MsgBusPackHead head;
+    const char* body = NULL;
+    MsgBusWireCodec decoder;
+    CHECK(decoder.DecodeFrame(old_frame.data(), old_frame.size() - 1, head, body) == 0);
+    CHECK(decoder.DecodeFrame(old_frame.data(), old_frame.size(), head, body) == (int)old_frame.size());
+    CHECK(head.body_type == REQ_SENDMSG);
+    CHECK(body == old_frame.data() + head.Size());
+    CHECK(!decoder.IsCompactEnabled());
+
+    // the v1 frame from the new peer enables v2 for the reply.
+    CHECK(decoder.DecodeFrame(frame.data(), frame.size(), head, body) == (int)frame.size());
+    CHECK(decoder.IsCompactEnabled());
+    CHECK(decoder.EncodeFrame(frame.data(), frame.size(), encoded));
+
+    // a v1 frame in the v2 stream is still accepted.
+    MsgBusWireCodec encoder;
+    encoder.OnPeerVersion(MSGBUS_HEAD_VERSION);
+    CHECK(encodeAndCheck(encoder, codec, frame));
+    CHECK(isDecodedSame(codec, frame, frame));
+    CHECK(encodeAndCheck(encoder, codec, frame));
+
+    // the frame without the connection state is decoded by any v2 peer.
+    std::string shared;
+    CHECK(MsgBusWireCodec::EncodeSharedFrame(frame.data(), frame.size(), 0, shared));
+    MsgBusWireCodec shared_decoder;
+    CHECK(isDecodedSame(shared_decoder, shared, frame));
+    CHECK(isDecodedSame(shared_decoder, shared, frame));
+}
+
+static void testCompress()
+{
+    MsgBusWireCodec encoder, decoder;
+    encoder.SetCompressThreshold(TEST_COMPRESS_THRESHOLD);
+    decoder.SetCompressThreshold(TEST_COMPRESS_THRESHOLD);
+    encoder.OnPeerVersion(MSGBUS_HEAD_VERSION);
+    decoder.OnPeerVersion(MSGBUS_HEAD_VERSION);
+    CHECK(encoder.IsCompressEnabled());
+    CompressInfo info;
+
+    // the small body is not compressed, but the dictionary is still updated.
+    std::string small = makeSendMsgFrame("dest", "from", makeNetMsgContent("from", "msgid.small", "x"));
+    CHECK(encodeAndCheck(encoder, decoder, small, info));
+    CHECK(!info.compressed);
+    CHECK(info.dict_update);
+    // the raw content has no msgid and no dictionary.
+    std::string raw = makeSendMsgFrame("dest", "from", makeWords(1024, 1));
+    CHECK(encodeAndCheck(encoder, decoder, raw, info));
+    CHECK(info.compressed);
+    CHECK(!info.dict_update);
+    CHECK(info.dict_id == 0);
+
+    // the body of the same msgid is compressed with the last body as the dictionary.
+    std::string first = makeSendMsgFrame("dest", "from", makeNetMsgContent("from", "msgid.words", makeWords(2048, 2)));
+    std::string second = makeSendMsgFrame("dest", "from", makeNetMsgContent("from", "msgid.words", makeWords(2048, 2) + "changed"));
+    size_t first_len = 0;
+    size_t second_len = 0;
+    CHECK(encodeAndCheck(encoder, decoder, first, info, &first_len));
+    CHECK(info.compressed && info.dict_update);
+    CHECK(info.dict_id == 0);
+    CHECK(encodeAndCheck(encoder, decoder, second, info, &second_len));
+    CHECK(info.compressed && info.dict_update);
+    CHECK(info.dict_id != 0);
+    CHECK(second_len*4 < first_len);
+    // the decoder without the dictionary can not decompress it.
+    std::string encoded;
+    CHECK(encoder.EncodeFrame(second.data(), second.size(), encoded));
+    MsgBusWireCodec fresh_decoder;
+    MsgBusPackHead head;
+    const char* body = NULL;
+    CHECK(fresh_decoder.DecodeFrame(encoded.data(), encoded.size(), head, body) < 0);
+    CHECK(isDecodedSame(decoder, encoded, second));
+
+    // no compression and no dictionary if the peer does not support.
+    MsgBusWireCodec plain_encoder, plain_decoder;
+    plain_encoder.SetCompressThreshold(TEST_COMPRESS_THRESHOLD);
+    plain_encoder.OnPeerVersion((MSGBUS_PROTOCOL_MAX << 8) | MSGBUS_PROTOCOL_V1);
+    CHECK(!plain_encoder.IsCompressEnabled());
+    CHECK(encodeAndCheck(plain_encoder, plain_decoder, first, info));
+    CHECK(!info.compressed && !info.dict_update);
+}
+
+static void testDictLimits()
+{
+    MsgBusWireCodec encoder, decoder;
+    encoder.SetCompressThreshold(TEST_COMPRESS_THRESHOLD);
+    encoder.OnPeerVersion(MSGBUS_HEAD_VERSION);
+    CompressInfo info;
+    std::string param = makeWords(512, 3);
+
+    // the names share the ids, "dest" takes the first and "from" takes the second.
+    char msgid[64];
+    int dict_msgid_num = TEST_MAX_DICT_MSGIDS - 2;
+    for(int i = 0; i < dict_msgid_num + 10; ++i)
+    {
+        snprintf(msgid, sizeof(msgid), "msgid.%d", i);
+        std::string frame = makeSendMsgFrame("dest", "from", makeNetMsgContent("from", msgid, param));
+        CHECK(encodeAndCheck(encoder, decoder, frame, info));
+        CHECK(info.compressed);
+        CHECK(info.dict_update == (i < dict_msgid_num));
+    }
+    // only the msgids with the dictionaries use them.
+    snprintf(msgid, sizeof(msgid), "msgid.%d", dict_msgid_num - 1);
+    std::string last_dict = makeSendMsgFrame("dest", "from", makeNetMsgContent("from", msgid, param));
+    CHECK(encodeAndCheck(encoder, decoder, last_dict, info));
+    CHECK(info.dict_id == (uint32_t)TEST_MAX_DICT_MSGIDS);
+    snprintf(msgid, sizeof(msgid), "msgid.%d", dict_msgid_num);
+    std::string no_dict = makeSendMsgFrame("dest", "from", makeNetMsgContent("from", msgid, param));
+    CHECK(encodeAndCheck(encoder, decoder, no_dict, info));
+    CHECK(!info.dict_update);
+    CHECK(info.dict_id == 0);
+
+    // only the tail of the large body is kept as the dictionary, on both sides.
+    std::string large_param = makeWords(TEST_MAX_DICT_BYTES*3, 4);
+    std::string large = makeSendMsgFrame("dest", "from", makeNetMsgContent("from", "msgid.0", large_param));
+    CHECK(encodeAndCheck(encoder, decoder, large, info));
+    CHECK(info.dict_update);
+    large_param.replace(TEST_MAX_DICT_BYTES*2, 7, "changed");
+    large = makeSendMsgFrame("dest", "from", makeNetMsgContent("from", "msgid.0", large_param));
+    CHECK(encodeAndCheck(encoder, decoder, large, info));
+    CHECK(info.dict_id != 0);
+    std::string after_large = makeSendMsgFrame("dest", "from", makeNetMsgContent("from", "msgid.0", param));
+    CHECK(encodeAndCheck(encoder, decoder, after_large, info));
+    CHECK(info.dict_id != 0);
+}
+
+static void testLargeBody()
+{
+    MsgBusWireCodec encoder, decoder;
+    encoder.SetCompressThreshold(TEST_COMPRESS_THRESHOLD);
+    encoder.OnPeerVersion(MSGBUS_HEAD_VERSION);
+    CompressInfo info;
+
+    // inflated in many chunks.
+    std::string multi_chunk = makeSendMsgFrame("dest", "from", makeWords(1024*1024 + 123, 5));
+    CHECK(encodeAndCheck(encoder, decoder, multi_chunk, info));
+    CHECK(info.compressed);
+    CHECK(info.raw_len > 1024*1024);
+
+    // the body over the limit of inflating is sent without compression.
+    std::string over_limit = makeSendMsgFrame("dest", "from", makeWords(TEST_MAX_INFLATED_BODY_LEN + 1, 6));
+    CHECK(encodeAndCheck(encoder, decoder, over_limit, info));
+    CHECK(!info.compressed);
+    std::string under_limit = makeSendMsgFrame("dest", "from", makeWords(TEST_MAX_INFLATED_BODY_LEN - 64, 6));
+    CHECK(encodeAndCheck(encoder, decoder, under_limit, info));
+    CHECK(info.compressed);
+
+    // the raw length must be the same as the inflated length.
+    std::string encoded;
+    CHECK(encoder.EncodeFrame(multi_chunk.data(), multi_chunk.size(), encoded));
+    info = getCompressInfo(encoded);
+    uint8_t low_bits = (uint8_t)encoded[info.raw_len_pos] & 0x7f;
+    CHECK(low_bits > 0 && low_bits < 0x7f);
+    MsgBusPackHead head;
+    const char* body = NULL;
+    std::string shorter(encoded);
+    shorter[info.raw_len_pos] = (char)((uint8_t)shorter[info.raw_len_pos] - 1);
+    CHECK(decoder.DecodeFrame(shorter.data(), shorter.size(), head, body) < 0);
+    std::string longer(encoded);
+    longer[info.raw_len_pos] = (char)((uint8_t)longer[info.raw_len_pos] + 1);
+    CHECK(decoder.DecodeFrame(longer.data(), longer.size(), head, body) < 0);
+    CHECK(isDecodedSame(decoder, encoded, multi_chunk));
+
+    // the raw length which is impossible for the compressed data is refused before inflating.
+    std::string bomb;
+    bomb.push_back(encoded[0]);
+    uint16_t version = htons((MSGBUS_COMPRESS_ALGS << 12) | (MSGBUS_PROTOCOL_MAX << 8) | MSGBUS_PROTOCOL_V2);
+    bomb.append((const char*)&version, sizeof(version));
+    bomb.push_back((char)(1 | MSGBUS_FLAG_COMPRESSED));
+    bomb.push_back((char)((((uint32_t)RSP_SENDMSG >> 16) << 5) | ((uint32_t)RSP_SENDMSG & 0xffff)));
+    putVarint(bomb, 1);
+    std::string compressed_body;
+    compressed_body.push_back((char)COMPRESS_ZLIB);
+    putVarint(compressed_body, TEST_MAX_INFLATED_BODY_LEN);
+    putVarint(compressed_body, 0);
+    compressed_body.append(16, '\0');
+    putVarint(bomb, compressed_body.size());
+    bomb.append(compressed_body);
+    CHECK(decoder.DecodeFrame(bomb.data(), bomb.size(), head, body) < 0);
+}
+
+int main(int argc, char* argv[])
+{
+    testRoundTrip();
+    testNameOverflow();
+    testInterop();
+    testCompress();
+    testDictLimits();
+    testLargeBody();
+    if(s_failed_num > 0)
+    {
+        printf("%d checks failed.\n", s_failed_num);
+        return 1;
+    }
+    printf("all checks passed.\n");
+    return 0;
+}
@@ -12,12 +12,14 @@ SHELLROOT := $(shell pwd)
 
 PBCC := protoc
 PBCCFLAGS := --cpp_out=.
+# the boost in the default include path is used if BOOST_ROOT is empty.
+BOOST_INC := $(if $(BOOST_ROOT),-I$(BOOST_ROOT))
 ifeq ($(BUILD),release)
 # for release version
-CPPFLAGS :=  -O3 -g -DNDEBUG -D__STDC_FORMAT_MACROS -fPIC -I$(BOOST_ROOT)
+CPPFLAGS :=  -O3 -g -DNDEBUG -D__STDC_FORMAT_MACROS -fPIC $(BOOST_INC)
 else
 # for debug version
-CPPFLAGS :=  -O0  -D__STDC_FORMAT_MACROS -Wall -fPIC -g -pg -I$(BOOST_ROOT)
+CPPFLAGS :=  -O0  -D__STDC_FORMAT_MACROS -Wall -fPIC -g -pg $(BOOST_INC)
 endif
 LDFLAGS := -L. -L$(BINDIR) -L$(LIBDIR) -Wl,-rpath,./ -Wl,-rpath-link,$(SHELLROOT)/$(BINDIR):$(SHELLROOT)/$(LIBDIR)
 SHARED  := -shared